@@ -32,205 +32,119 @@
 #include "triangle.h"
 
 /**
-* Calls the triangulate() C-routine 
+* Calls the triangulate() C-routine once and hands its output buffers over to the caller.
 *
-* Note: all output arrays should be preallocated by the caller!
+* Note: the output arrays are allocated by Triangle and must be released with FreeTriangulation.
+*       All node, triangle and edge numbers are zero based.
 *
 * \param[in]  jatri triangulate mode: When 2,  create points (samples),
 *             when 1, produce final Delaunay triangulation.
 *             when 3, produce final Delaunay triangulation AND
-*             edgeidx/triedge arrays (see below).
-* \param[in]  xs Coordinates of input points.
+*             edgelist/neighborlist arrays (see below).
+* \param[in]  xy Interleaved coordinates of input points (x0, y0, x1, y1, ...).
 *             When jatri==2: points of bounding polygon (segment points).
 *             When jatri==1 or 3: all points in grid (output from a previous
-*             tricall).
-* \param[in]  ns Number of input points (in xs/ys).
-* \param[out] indx Array that will be filled with node numbers for each
-*             triangle. Nr. of filled elements equals numtri*3.
-* \param[inout] numtri Number of produced triangles (out) and max nr of triangles possible in indx array (in).
-* \param[out] edgeidx (only when jatri==3)
-*             Array that will be filled with node numbers for each
-*             edge. Nr. of filled elements equals numedge*3.
-* \param[out] numedge Number of produced edges.
-* \param[out] triedge (only when jatri==3)
-*             Array that will be filled with edge numbers for
-*             triangle. Nr. of filled elements equals numtr*3.
-* \param[out] xs3 Only when jatri==2. Coordinates of all points/nodes
-*             in the triangular grid.
-* \param[inout] ns3 out: number of generated points in grid, in: if >0 used to check array size of xs3 and ys3 (not used if jatri=1)
+*             tricall). The array is read only and not copied.
+* \param[in]  ns Number of input points (in xy).
 * \param[in]  trisize Only used when generating points (jatri==2).
 *             Maximum area for generated triangles.
+* \param[out] numtri Number of produced triangles.
+* \param[out] trianglelist Node numbers for each triangle (numtri*3 elements).
+* \param[out] numedge Number of produced edges (only when jatri==3).
+* \param[out] edgelist (only when jatri==3) Node numbers for each edge (numedge*2 elements).
+* \param[out] neighborlist (only when jatri==3) For each triangle, the triangle opposite
+*             to each of its nodes, -1 on the boundary (numtri*3 elements).
+* \param[out] numpoints Number of points in the grid (only when jatri==2).
+* \param[out] pointlist (only when jatri==2) Interleaved coordinates of all points/nodes
+*             in the triangular grid (numpoints*2 elements).
 */
 
-void Triangulation(int *jatri, REAL *xs, REAL *ys, int *ns, int *indx, int *numtri, int *edgeidx, int *numedge, int *triedge, REAL *xs3, REAL *ys3, int *ns3, REAL *trisize)
+void TriangulateOnce(int jatri, REAL *xy, int ns, REAL trisize, int *numtri, int **trianglelist, int *numedge, int **edgelist, int **neighborlist, int *numpoints, REAL **pointlist)
 {
+    struct triangulateio in, out;
 
-    struct triangulateio in, mid, out, vorout;
-
-    int number, i, j, itri, maxnumtri;
-    int *trinumedge;
+    int i;
     char opties[256];
 
-    maxnumtri = *numtri; // input numtri indicates (max) array size.
-
-                         /* Define input points. */
-    in.numberofpoints = *ns;
-    number = in.numberofpoints * 2 * sizeof(REAL);
-    in.pointlist = (REAL *)malloc(number);
-    for (i = 0; i< *ns; i++) {
-        in.pointlist[2 * i] = xs[i];
-        in.pointlist[2 * i + 1] = ys[i];
-    }
-
+    /* Define input points, used in place. */
+    in.numberofpoints = ns;
+    in.pointlist = xy;
     in.numberofpointattributes = 0;
-    number = in.numberofpoints * in.numberofpointattributes * sizeof(REAL);
-    in.pointattributelist = (REAL *)NULL; 
+    in.pointattributelist = (REAL *)NULL;
     in.pointmarkerlist = (int *)NULL;
+    in.segmentlist = (int *)NULL;
+    in.segmentmarkerlist = (int *)NULL;
+    in.numberofsegments = 0;
 
-    if (*jatri == 1 || *jatri == 3) {
-        in.numberofsegments = 0;
-    }
-
-    else {
-        in.numberofsegments = *ns;
+    if (jatri == 2)
+    {
+        in.numberofsegments = ns;
         in.segmentlist = (int *)malloc(in.numberofsegments * 2 * sizeof(int));
-        in.segmentmarkerlist = (int *)NULL;
-        for (i = 0; i< *ns; i++) {
+        for (i = 0; i < ns; i++) {
             in.segmentlist[2 * i] = i;
             in.segmentlist[2 * i + 1] = i + 1;
         }
-        in.segmentlist[2 * (*ns - 1) + 1] = 0;
+        in.segmentlist[2 * (ns - 1) + 1] = 0;
     }
 
     in.numberofholes = 0;
     in.numberofregions = 0;
-    in.regionlist = (REAL *)NULL; /* malloc(in.numberofregions * 4 * sizeof(REAL)); */
-    in.holelist = (REAL *)NULL;   /* malloc(in.numberofregions * 4 * sizeof(REAL)); */
-    mid.pointlist = (REAL *)NULL;            /* Not needed if -N switch used. */
-                                             /* Not needed if -N switch used or number of point attributes is zero: */
-    mid.pointattributelist = (REAL *)NULL;
-    mid.pointmarkerlist = (int *)NULL; /* Not needed if -N or -B switch used. */
-    mid.trianglelist = (int *)NULL;          /* Not needed if -E switch used. */
-                                             /* Not needed if -E switch used or number of triangle attributes is zero: */
-    mid.triangleattributelist = (REAL *)NULL;
-    mid.neighborlist = (int *)NULL;         /* Needed only if -n switch used. */
-                                            /* Needed only if segments are output (-p or -c) and -P not used: */
-    mid.segmentlist = (int *)NULL;
-    /* Needed only if segments are output (-p or -c) and -P and -B not used: */
-    mid.segmentmarkerlist = (int *)NULL;
-    mid.edgelist = (int *)NULL;             /* Needed only if -e switch used. */
-    mid.edgemarkerlist = (int *)NULL;   /* Needed if -e used and -B not used. */
-
-    vorout.pointlist = (REAL *)NULL;        /* Needed only if -v switch used. */
-                                            /* Needed only if -v switch used and number of attributes is not zero: */
-    vorout.pointattributelist = (REAL *)NULL;
-    vorout.edgelist = (int *)NULL;          /* Needed only if -v switch used. */
-    vorout.normlist = (REAL *)NULL;         /* Needed only if -v switch used. */
-
-                                            /* Triangulate the points.  Switches are chosen to read and write a  */
-                                            /*   PSLG (p), preserve the convex hull (c), number everything from  */
-                                            /*   zero (z), assign a regional attribute to each element (A), and  */
-                                            /*   produce an edge list (e), a Voronoi diagram (v), and a triangle */
-                                            /*   neighbor list (n).                                              */
-
-    if (*jatri == 1) 
+    in.regionlist = (REAL *)NULL;
+    in.holelist = (REAL *)NULL;
+
+    out.pointlist = (REAL *)NULL;
+    out.pointattributelist = (REAL *)NULL;
+    out.pointmarkerlist = (int *)NULL;
+    out.trianglelist = (int *)NULL;
+    out.triangleattributelist = (REAL *)NULL;
+    out.neighborlist = (int *)NULL;
+    out.segmentlist = (int *)NULL;
+    out.segmentmarkerlist = (int *)NULL;
+    out.edgelist = (int *)NULL;
+    out.edgemarkerlist = (int *)NULL;
+
+    /* Switches: quiet (Q), read a PSLG (p), preserve the convex hull (c), number everything from */
+    /*   zero (z), no node (N), boundary marker (B) or segment (P) output, produce an edge list (e) */
+    /*   and a triangle neighbor list (n).                                                          */
+    if (jatri == 1)
     {
-        /* triangulate("pcAevnQP", &in, &mid, &vorout); */
-
-        triangulate("-Qpc", &in, &mid, &vorout);
-
+        triangulate("QpczNBP", &in, &out, (struct triangulateio *)NULL);
     }
-    else if (*jatri == 3) 
+    else if (jatri == 3)
     {
-        /* Also produce edge-to-node mapping and tri-to-edge mapping
-        (uses quite a bit more memory!) */
-        triangulate("-Qpc-e-v", &in, &mid, &vorout);
-
-        *numedge = mid.numberofedges;
-        for (i = 0; i < *numedge * 2; i++) {
-            edgeidx[i] = mid.edgelist[i];
-        }
-
-        /* trinumedge array maintains current nr of edges already
-        registered for each triangle. */
-        trinumedge = (int*)malloc(mid.numberoftriangles * sizeof(int));
-        for (i = 0; i < mid.numberoftriangles; i++) trinumedge[i] = 0;
-
-        /* For all edges, use Voronoi nodes (==triangle nrs) to register
-        the 3 edge nrs for each triangle. (mapping trinr -> edgenrs) */
-        for (i = 0; i < *numedge; i++) {
-            for (j = 0; j < 2; j++) {
-                itri = vorout.edgelist[2 * i + j]; // left or right triangle.
-                if (itri <= 0) continue;
-                triedge[3 * (itri - 1) + trinumedge[itri - 1]] = i + 1;
-                trinumedge[itri - 1] = trinumedge[itri - 1] + 1;
-            }
-        }
-        free(trinumedge);
+        triangulate("QpczNBPen", &in, &out, (struct triangulateio *)NULL);
     }
-    else 
+    else
     {
-        i = sprintf(opties, "-Q-Y-q30.0-D-a%f", *trisize);
-
-        triangulate(opties, &in, &mid, &vorout);
-
-        //    check size of xs3, ys3 if *ns3>0
-        if (*ns3 > 0 & mid.numberofpoints > *ns3) {
-            printf("tricall: unsufficient mem for nodes in xs3, ys3 (%d > %d)\n", mid.numberofpoints, *ns3);
-            *numtri = -*numtri; // serves as error indicator
-            *ns3 = -mid.numberofpoints; // serves as error indicator
-        }
-        else {
-            for (i = 0; i< mid.numberofpoints; i++) {
-                if (i <= mid.numberofpoints) {
-                    xs3[i] = mid.pointlist[2 * i];
-                    ys3[i] = mid.pointlist[2 * i + 1];
-                }
-            }
-            *ns3 = mid.numberofpoints;
-        }
-
-    }
-
-
-
-    *numtri = mid.numberoftriangles;
-    if (*numtri > maxnumtri) 
-    {
-        printf("Triangulation: unsufficient mem for triangle nodes in indx (%d > %d)\n", *numtri, maxnumtri);
-        *numtri = -*numtri; // serves as error indicator
-    }
-    else {
-        for (i = 0; i< *numtri * 3; i++) {
-            indx[i] = mid.trianglelist[i];
-        }
+        sprintf(opties, "QzBP-Y-q30.0-D-a%f", trisize);
+        triangulate(opties, &in, &out, (struct triangulateio *)NULL);
     }
 
-    /* Free all allocated arrays, including those allocated by Triangle. */
-
-    free(in.pointlist);
-    free(in.pointattributelist);
-    free(in.pointmarkerlist);
-    free(in.regionlist);
-
-    free(mid.pointlist);
-    free(mid.pointattributelist);
-    free(mid.pointmarkerlist);
-    free(mid.trianglelist);
-
-    free(mid.triangleattributelist);
-
-    /* free(mid.trianglearealist);
-    free(mid.neighborlist); */
-    free(mid.segmentlist);
-    free(mid.segmentmarkerlist);
-    free(mid.edgelist);
-    free(mid.edgemarkerlist);
+    *numtri = out.numberoftriangles;
+    *trianglelist = out.trianglelist;
+    *numedge = jatri == 3 ? out.numberofedges : 0;
+    *edgelist = out.edgelist;
+    *neighborlist = out.neighborlist;
+    *numpoints = jatri == 2 ? out.numberofpoints : 0;
+    *pointlist = out.pointlist;
+
+    /* Free all other arrays allocated here or by Triangle. */
+    free(in.segmentlist);
+    free(out.pointattributelist);
+    free(out.pointmarkerlist);
+    free(out.triangleattributelist);
+    free(out.segmentlist);
+    free(out.segmentmarkerlist);
+    free(out.edgemarkerlist);
+}
 
-    free(vorout.pointlist);
-    free(vorout.pointattributelist);
-    free(vorout.edgelist);
-    free(vorout.normlist);
-
-    return;
-}
\ No newline at end of file
+/**
+* Releases the output buffers returned by TriangulateOnce.
+*/
+void FreeTriangulation(int *trianglelist, int *edgelist, int *neighborlist, REAL *pointlist)
+{
+    free(trianglelist);
+    free(edgelist);
+    free(neighborlist);
+    free(pointlist);
+}
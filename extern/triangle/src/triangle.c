@@ -644,18 +644,25 @@ struct memorypool {
 };
 
 
-/* Global constants.                                                         */
-
-REAL splitter;       /* Used to split REAL factors for exact multiplication. */
-REAL epsilon;                             /* Floating-point machine epsilon. */
-REAL resulterrbound;
-REAL ccwerrboundA, ccwerrboundB, ccwerrboundC;
-REAL iccerrboundA, iccerrboundB, iccerrboundC;
-REAL o3derrboundA, o3derrboundB, o3derrboundC;
+/* Global constants.  They are thread local, so that independent            */
+/*   triangulations can run concurrently on different threads.               */
+
+#if defined(_MSC_VER)
+#define TRIANGLE_THREAD_LOCAL __declspec(thread)
+#else
+#define TRIANGLE_THREAD_LOCAL __thread
+#endif
+
+TRIANGLE_THREAD_LOCAL REAL splitter;       /* Used to split REAL factors for exact multiplication. */
+TRIANGLE_THREAD_LOCAL REAL epsilon;                             /* Floating-point machine epsilon. */
+TRIANGLE_THREAD_LOCAL REAL resulterrbound;
+TRIANGLE_THREAD_LOCAL REAL ccwerrboundA, ccwerrboundB, ccwerrboundC;
+TRIANGLE_THREAD_LOCAL REAL iccerrboundA, iccerrboundB, iccerrboundC;
+TRIANGLE_THREAD_LOCAL REAL o3derrboundA, o3derrboundB, o3derrboundC;
 
 /* Random number seed is not constant, but I've made it global anyway.       */
 
-unsigned long randomseed;                     /* Current random number seed. */
+TRIANGLE_THREAD_LOCAL unsigned long randomseed;                     /* Current random number seed. */
 
 
 /* Mesh data structure.  Triangle operates on only one mesh, but the mesh    */
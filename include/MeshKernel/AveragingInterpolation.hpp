@@ -27,9 +27,13 @@
 
 #pragma once
 
+#include <memory>
+
 #include <MeshKernel/Constants.hpp>
+#include <MeshKernel/MemoryUsage.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/RTree.hpp>
+#include <MeshKernel/SampleBins.hpp>
 
 namespace meshkernel
 {
@@ -70,6 +74,13 @@ namespace meshkernel
     ///
     /// -   For the \ref MeshLocations Edges location, the interpolated values at the node are
     ///     averaged.
+    ///
+    /// When there are many more samples than locations, the SimpleAveraging, Max, Min and
+    /// MinAbsValue methods operate on \ref SampleBins instead of the samples. Each search
+    /// uses the bins at a resolution matched to the size of the search area. The aggregated
+    /// values are used for the bins entirely inside the search polygon, the bins straddling
+    /// its boundary are evaluated on their samples, so that the results are equal to the ones
+    /// computed on the samples. The samples are never binned when their values are transformed.
     class AveragingInterpolation
     {
     public:
@@ -110,6 +121,10 @@ namespace meshkernel
             return m_results;
         }
 
+        /// @brief Adds the allocations of the results, the visited samples and the sample bins
+        /// @param[in,out] memoryUsage The memory usage to add to
+        void AccumulateMemoryUsage(MemoryUsage& memoryUsage) const;
+
     private:
         /// @brief Compute the averaging results in polygon
         /// @param[in] polygon The bounding polygon where the samples are included
@@ -119,6 +134,25 @@ namespace meshkernel
                               Point interpolationPoint,
                               double& result);
 
+        /// @brief Compute the averaging results in polygon from the aggregated samples
+        /// @param[in] searchPolygon The search polygon
+        /// @param[in] interpolationPoint The interpolation point
+        /// @param[in] searchRadiusSquared The squared search radius
+        /// @param[out] result The resulting value
+        void ComputeOnPolygonFromBins(const std::vector<Point>& searchPolygon,
+                                      Point interpolationPoint,
+                                      double searchRadiusSquared,
+                                      double& result);
+
+        /// @brief Gets the value of the sample closest to a point, from the aggregated samples
+        /// @param[in] interpolationPoint The interpolation point
+        /// @return The value of the closest sample (missing value if there are no samples)
+        [[nodiscard]] double GetClosestSampleValueFromBins(Point interpolationPoint);
+
+        /// @brief Determines if the samples should be aggregated in bins
+        /// @return True if the samples are many more than the locations and the method supports bins
+        [[nodiscard]] bool IsSampleBinningEffective() const;
+
         /// @brief Compute the interpolated results on designed location
         /// @return the interpolated results
         [[nodiscard]] std::vector<double> ComputeOnLocations();
@@ -142,8 +176,10 @@ namespace meshkernel
         bool m_useClosestSampleIfNoneAvailable = false; ///< Whether to use the closest sample if there is none available
         bool m_transformSamples = false;                ///< Wheher to transform samples
 
-        RTree m_samplesRtree;               ///< The samples tree
-        std::vector<double> m_results;      ///< The results
-        std::vector<bool> m_visitedSamples; ///< The visited samples
+        RTree m_samplesRtree;                     ///< The samples tree
+        std::unique_ptr<SampleBins> m_sampleBins; ///< The aggregated samples, if used instead of the samples
+        std::vector<RTree> m_binsRTrees;          ///< For each bins level, the bins tree (built on first use)
+        std::vector<double> m_results;            ///< The results
+        std::vector<bool> m_visitedSamples;       ///< The visited samples
     };
 } // namespace meshkernel
@@ -60,6 +60,7 @@ namespace meshkernel
     const size_t maximumNumberOfNodesPerFace = 8;                                 ///< Maximum number of nodes per face
     const size_t maximumNumberOfConnectedNodes = maximumNumberOfEdgesPerNode * 4; ///< Maximum number of connected nodes
     const double minimumCellArea = 1e-12;                                         ///< Minimum cell area
+    const double minimumFaceArea = 1e-8;                                          ///< Faces with a smaller area are degenerate, their area is set to this value
     const double weightCircumCenter = 1.0;                                        ///< Weight circum center
     const size_t numNodesQuads = 4;                                               ///< Number of nodes in a quadrilateral
     const size_t numNodesInTriangle = 3;                                          ///< Number of nodes in a triangle
@@ -73,6 +74,13 @@ namespace meshkernel
     const double mergingDistance = 0.001;                                    ///< Merging distance
     const double mergingDistanceSquared = mergingDistance * mergingDistance; ///< Merging distance squared
 
+    // averaging
+    const size_t minimumSamplesPerLocationForBinning = 100; ///< Averaging aggregates the samples in bins when there are more samples per location
+
+    // triangulation
+    const size_t maximumNumberOfPointsPerTriangulationTile = 1000000; ///< Point sets larger than this are triangulated in tiles
+    const double triangulationTileOverlap = 0.1;                      ///< Overlap of the triangulation tiles, as a fraction of the tile size
+
     // physical constants
     const double gravity = 9.81; ///< Gravitational acceleration on earth (m/s^2)
 
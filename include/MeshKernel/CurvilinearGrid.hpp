@@ -34,6 +34,9 @@
 namespace meshkernel
 {
     /// @brief A class representing a curvilinear grid
+    ///
+    /// The grid nodes are stored contiguously in row-major order (m-major, n fastest),
+    /// so the node (m, n) is located at m * GetNumNNodes() + n.
     class CurvilinearGrid
     {
 
@@ -45,19 +48,57 @@ namespace meshkernel
         /// @brief Create a new curvilinear grid
         /// @param[in] m Number of columns (horizontal direction)
         /// @param[in] n Number of rows (vertical direction)
-        CurvilinearGrid(size_t m, size_t n)
+        CurvilinearGrid(size_t m, size_t n) : m_numMNodes(m + 1),
+                                              m_numNNodes(n + 1),
+                                              m_gridNodes(m_numMNodes * m_numNNodes, {doubleMissingValue, doubleMissingValue})
         {
-            m_grid.resize(m + 1, std::vector<Point>(n + 1, {doubleMissingValue, doubleMissingValue}));
         }
 
         /// @brief Sets the point to the curvilinear grid
         /// @param[in] grid Input grid points
         CurvilinearGrid(const std::vector<std::vector<Point>>& grid)
         {
-            CurvilinearGrid(grid.size(), grid[0].size());
-            m_grid = grid;
+            if (grid.empty() || grid[0].empty())
+            {
+                return;
+            }
+
+            m_numMNodes = grid.size();
+            m_numNNodes = grid[0].size();
+            m_gridNodes.reserve(m_numMNodes * m_numNNodes);
+            for (const auto& gridLine : grid)
+            {
+                m_gridNodes.insert(m_gridNodes.end(), gridLine.begin(), gridLine.end());
+            }
         }
 
-        std::vector<std::vector<Point>> m_grid; ///< Member variable storing the grid
+        /// @brief Gets the number of nodes in m direction
+        /// @return The number of nodes in m direction
+        [[nodiscard]] size_t GetNumMNodes() const { return m_numMNodes; }
+
+        /// @brief Gets the number of nodes in n direction
+        /// @return The number of nodes in n direction
+        [[nodiscard]] size_t GetNumNNodes() const { return m_numNNodes; }
+
+        /// @brief Checks if the grid has no nodes
+        /// @return True if the grid is empty
+        [[nodiscard]] bool IsEmpty() const { return m_gridNodes.empty(); }
+
+        /// @brief Gets the node at position (m, n)
+        /// @param[in] m The index in m direction
+        /// @param[in] n The index in n direction
+        /// @return A reference to the node
+        [[nodiscard]] Point& Node(size_t m, size_t n) { return m_gridNodes[m * m_numNNodes + n]; }
+
+        /// @brief Gets the node at position (m, n)
+        /// @param[in] m The index in m direction
+        /// @param[in] n The index in n direction
+        /// @return A const reference to the node
+        [[nodiscard]] const Point& Node(size_t m, size_t n) const { return m_gridNodes[m * m_numNNodes + n]; }
+
+    private:
+        size_t m_numMNodes = 0;         ///< The number of nodes in m direction
+        size_t m_numNNodes = 0;         ///< The number of nodes in n direction
+        std::vector<Point> m_gridNodes; ///< The grid nodes, stored row-major
     };
 } // namespace meshkernel
@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -141,16 +142,20 @@ namespace meshkernel
                                          size_t& subLayerIndex);
 
         /// @brief Grow layer at layer index
+        /// The front workspaces persist between layers, so growing a layer only costs the size of the active front
         /// @param layerIndex The layer index to grow
         void GrowLayer(size_t layerIndex);
 
+        /// @brief Allocates the front workspaces once and resets the part used by the previous layer
+        void ResetFrontWorkspaces();
+
         /// @brief Compute the maximum allowable grid layer growth time self crossings (comp_tmax_self)
         /// @param coordinates The coordinates to grow
         /// @param velocities The velocities
         /// @param maximumGridLayerGrowTime The maximum grow layer time
         void ComputeMaximumGridLayerGrowTime(const std::vector<Point>& coordinates,
                                              const std::vector<Point>& velocities,
-                                             std::vector<double>& maximumGridLayerGrowTime) const;
+                                             std::vector<double>& maximumGridLayerGrowTime);
 
         /// @brief Copy growth velocities to the advancing front, add points at front corners corners (copy_vel_to_front)
         /// @brief layerIndex
@@ -163,16 +168,20 @@ namespace meshkernel
         void CopyVelocitiesToFront(size_t layerIndex,
                                    const std::vector<Point>& previousVelocities,
                                    size_t& numFrontPoints,
-                                   std::vector<std::vector<size_t>>& gridPointsIndices,
+                                   std::vector<std::array<size_t, 2>>& gridPointsIndices,
                                    std::vector<Point>& frontGridPoints,
                                    std::vector<Point>& velocities);
 
         /// @brief Computes the points at front, which have to be moved.
+        ///
+        /// The front position of each column is updated from the previous call, scanning only the layers from firstChangedLayer
+        /// @brief firstChangedLayer The lowest layer changed since the previous call
         /// @brief gridPointsIndices
         /// @brief frontGridPoints
         /// @brief numFrontPoints
         /// @returns
-        void FindFront(std::vector<std::vector<size_t>>& gridPointsIndices,
+        void FindFront(size_t firstChangedLayer,
+                       std::vector<std::array<size_t, 2>>& gridPointsIndices,
                        std::vector<Point>& frontGridPoints,
                        size_t& numFrontPoints);
 
@@ -275,8 +284,9 @@ namespace meshkernel
 
         /// @brief Computes the intersection of two splines, one must have only two nodes (get_crosssplines)
         /// @brief index
+        /// @param[in] crossingCandidates The splines that may cross the spline at index
         /// @returns
-        void GetSplineIntersections(size_t index);
+        void GetSplineIntersections(size_t index, const std::vector<size_t>& crossingCandidates);
 
         /// @brief Generate a gridline on a spline with a prescribed maximum mesh width (make_gridline)
         /// @param[in] splineIndex
@@ -354,5 +364,19 @@ namespace meshkernel
         std::vector<size_t> m_subLayerGridPoints;                                     ///< Sublayer grid points
         std::vector<std::vector<size_t>> m_numPerpendicularFacesOnSubintervalAndEdge; ///< Perpendicular faces on subinterval and edge
         std::vector<std::vector<double>> m_growFactorOnSubintervalAndEdge;            ///< Grow factor on subinterval and edge
+
+        // front workspaces, persistent between layers
+        std::vector<Point> m_velocityVectorAtGridPoints;             ///< Growth velocities at the grid points of the active layer
+        std::vector<Point> m_activeLayerPoints;                      ///< The points of the layer being grown
+        std::vector<std::array<size_t, 2>> m_frontGridPointsIndices; ///< For each front point, the (m, layer) indices
+        std::vector<Point> m_frontGridPoints;                        ///< The front points
+        std::vector<Point> m_frontVelocities;                        ///< The front velocities
+        size_t m_numFrontWorkspaceUsed = 0;                          ///< Number of front workspace entries written since the last reset
+        std::vector<size_t> m_newValidFrontNodes;                    ///< Valid front nodes after the current time step
+        std::vector<double> m_maximumGridLayerGrowTime;              ///< Maximum grow time of each front edge
+        std::vector<double> m_edgeWidth;                             ///< Width of each front edge
+        std::vector<double> m_edgeIncrement;                         ///< Width increment of each front edge
+        std::vector<int> m_frontPosition;                            ///< For each column, the last layer in the front, kept between the FindFront calls
+        size_t m_lastGrownLayer = sizetMissingValue;                 ///< The layer grown by the last GrowLayer call
     };
 } // namespace meshkernel
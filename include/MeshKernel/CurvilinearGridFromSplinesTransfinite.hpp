@@ -30,6 +30,7 @@
 #include <memory>
 #include <vector>
 
+#include <MeshKernel/Entities.hpp>
 #include <MeshKernelApi/CurvilinearParameters.hpp>
 
 namespace meshkernel
@@ -53,6 +54,9 @@ namespace meshkernel
         void ComputeIntersections();
 
         /// Computes the curvilinear grid from the splines using transfinite interpolation
+        ///
+        /// When all patch boundaries are discretized by the splines the patches are independent,
+        /// and they are interpolated in parallel
         /// @param curvilinearGrid
         void Compute(CurvilinearGrid& curvilinearGrid);
 
@@ -85,6 +89,31 @@ namespace meshkernel
         template <typename T>
         void SwapColumns(std::vector<std::vector<T>>& v, size_t firstColumn, size_t secondColumn) const;
 
+        /// @brief Checks if all the nodes on the patch boundaries have been discretized by the splines
+        /// @param[in] curvilinearGrid The curvilinear grid with the discretized splines
+        /// @param[in] numMPatches The number of patches in m direction
+        /// @param[in] numNPatches The number of patches in n direction
+        /// @returns True if the patches can be interpolated independently
+        [[nodiscard]] bool ArePatchBoundariesValid(const CurvilinearGrid& curvilinearGrid,
+                                                   size_t numMPatches,
+                                                   size_t numNPatches) const;
+
+        /// @brief Fills the invalid nodes of one patch with the transfinite interpolation of its sides
+        /// @param[in] mPatch The patch index in m direction
+        /// @param[in] nPatch The patch index in n direction
+        /// @param[in,out] sideOne The first side of the patch
+        /// @param[in,out] sideTwo The second side of the patch
+        /// @param[in,out] sideThree The third side of the patch
+        /// @param[in,out] sideFour The fourth side of the patch
+        /// @param[in,out] curvilinearGrid The curvilinear grid to fill
+        void FillPatch(size_t mPatch,
+                       size_t nPatch,
+                       std::vector<Point>& sideOne,
+                       std::vector<Point>& sideTwo,
+                       std::vector<Point>& sideThree,
+                       std::vector<Point>& sideFour,
+                       CurvilinearGrid& curvilinearGrid) const;
+
         /// Compute the distances following an exponential increase
         /// @param[in] factor
         /// @param[in] leftDistance
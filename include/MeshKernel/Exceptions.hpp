@@ -18,6 +18,19 @@ namespace meshkernel
         explicit AlgorithmError(const char* msg) : runtime_error(msg) {}
     };
 
+    /// @brief Custom exception to describe an operation stopped because its cancellation was requested
+    class OperationCancelledError : public std::runtime_error
+    {
+    public:
+        /// @brief Exception for cancelled operations accepting a string
+        /// @param msg the error message string
+        explicit OperationCancelledError(const std::string& msg) : runtime_error(msg) {}
+
+        /// @brief Exception for cancelled operations accepting a char array
+        /// @param msg the pointer to the error message char array
+        explicit OperationCancelledError(const char* msg) : runtime_error(msg) {}
+    };
+
     /// @brief Custom exception to describe an error caused by an invalid mesh at a specific location
     class MeshGeometryError : public std::runtime_error
     {
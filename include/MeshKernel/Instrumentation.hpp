@@ -0,0 +1,106 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace meshkernel
+{
+    /// @brief The accumulated measurements of an instrumented section or counter
+    struct InstrumentationEntry
+    {
+        std::string m_name;          ///< The section or counter name
+        size_t m_count = 0;          ///< The number of executions of the section, or the counter value
+        double m_totalSeconds = 0.0; ///< The total time spent in the section
+        double m_maxSeconds = 0.0;   ///< The longest time spent in a single execution of the section
+    };
+
+    /// @brief Collects the timers placed on the operations and the counters placed on the hot paths
+    ///
+    /// Each thread records in its own entries, so instrumented sections inside parallel loops do not contend.
+    /// The sections are instrumented with the MESHKERNEL_TIME_SCOPE and MESHKERNEL_COUNT macros,
+    /// which compile to nothing unless MESHKERNEL_INSTRUMENTATION is defined (CMake option MESHKERNEL_ENABLE_INSTRUMENTATION, off by default).
+    /// Timers read the clock twice, so they are not placed on single queries: those are counted.
+    class Instrumentation
+    {
+    public:
+        /// @brief Records one execution of a section
+        /// @param[in] name The section name
+        /// @param[in] seconds The time spent in the section
+        static void Record(std::string_view name, double seconds);
+
+        /// @brief Increments a counter
+        /// @param[in] name The counter name
+        /// @param[in] increment The increment
+        static void Count(std::string_view name, size_t increment);
+
+        /// @brief Gets the measurements of all threads
+        /// @returns The entries, sorted by decreasing total time
+        [[nodiscard]] static std::vector<InstrumentationEntry> GetReport();
+
+        /// @brief Clears the measurements of all threads
+        static void Reset();
+    };
+
+    /// @brief Records the time spent between its construction and destruction
+    class ScopedTimer
+    {
+    public:
+        /// @brief Constructor, starts the timer
+        /// @param[in] name The section name, a string literal
+        explicit ScopedTimer(const char* name) : m_name(name), m_start(std::chrono::steady_clock::now()) {}
+
+        /// @brief Destructor, records the elapsed time
+        ~ScopedTimer()
+        {
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_start;
+            Instrumentation::Record(m_name, elapsed.count());
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        const char* m_name;                            ///< The section name
+        std::chrono::steady_clock::time_point m_start; ///< The start time
+    };
+
+} // namespace meshkernel
+
+#if defined(MESHKERNEL_INSTRUMENTATION)
+/// @brief Times the enclosing scope
+#define MESHKERNEL_TIME_SCOPE(name) const meshkernel::ScopedTimer meshKernelScopedTimer(name)
+/// @brief Increments a counter
+#define MESHKERNEL_COUNT(name, increment) meshkernel::Instrumentation::Count(name, increment)
+#else
+#define MESHKERNEL_TIME_SCOPE(name)
+#define MESHKERNEL_COUNT(name, increment)
+#endif
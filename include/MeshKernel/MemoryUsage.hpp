@@ -0,0 +1,111 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <climits>
+#include <map>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace meshkernel
+{
+    /// @brief Detects std::vector, used for accounting the allocations of nested vectors
+    template <typename T>
+    struct IsVector : std::false_type
+    {
+    };
+
+    /// @brief Detects std::vector, used for accounting the allocations of nested vectors
+    template <typename T, typename A>
+    struct IsVector<std::vector<T, A>> : std::true_type
+    {
+    };
+
+    /// @brief Gets the bytes allocated by a vector, including the allocations of nested vectors
+    /// @tparam T The value type
+    /// @param[in] values The vector
+    /// @returns The allocated bytes
+    template <typename T>
+    [[nodiscard]] size_t GetVectorMemoryUsage(const std::vector<T>& values)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            return values.capacity() / CHAR_BIT;
+        }
+        else
+        {
+            size_t bytes = values.capacity() * sizeof(T);
+            if constexpr (IsVector<T>::value)
+            {
+                for (const auto& nested : values)
+                {
+                    bytes += GetVectorMemoryUsage(nested);
+                }
+            }
+            return bytes;
+        }
+    }
+
+    /// @brief The bytes allocated by the subsystems of a mesh kernel instance
+    ///
+    /// The allocated capacity is accounted, not the size in use
+    class MemoryUsage
+    {
+    public:
+        /// @brief Adds bytes to a subsystem
+        /// @param[in] subsystem The subsystem name
+        /// @param[in] bytes The allocated bytes
+        void Add(const std::string& subsystem, size_t bytes) { m_subsystems[subsystem] += bytes; }
+
+        /// @brief Adds the allocations of vectors to a subsystem
+        /// @param[in] subsystem The subsystem name
+        /// @param[in] vectors The vectors
+        template <typename... Vectors>
+        void AddVectors(const std::string& subsystem, const Vectors&... vectors)
+        {
+            Add(subsystem, (GetVectorMemoryUsage(vectors) + ...));
+        }
+
+        /// @brief Gets the bytes allocated by all subsystems
+        /// @returns The total bytes
+        [[nodiscard]] size_t GetTotal() const
+        {
+            return std::accumulate(m_subsystems.begin(), m_subsystems.end(), size_t{0}, [](size_t total, const auto& subsystem) { return total + subsystem.second; });
+        }
+
+        /// @brief Gets the bytes allocated by each subsystem
+        /// @returns The bytes by subsystem name
+        [[nodiscard]] const std::map<std::string, size_t>& GetSubsystems() const { return m_subsystems; }
+
+    private:
+        std::map<std::string, size_t> m_subsystems; ///< The allocated bytes by subsystem name
+    };
+
+} // namespace meshkernel
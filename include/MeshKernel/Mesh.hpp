@@ -28,6 +28,8 @@
 #pragma once
 
 #include <MeshKernel/Entities.hpp>
+#include <MeshKernel/MemoryUsage.hpp>
+#include <MeshKernel/NodeCoordinates.hpp>
 #include <MeshKernel/RTree.hpp>
 
 #include <vector>
@@ -88,11 +90,11 @@ namespace meshkernel
         Mesh() = default;
 
         /// @brief Construct a mesh starting from the edges and nodes
-        /// @param[in] edges The input edges
-        /// @param[in] nodes The input nodes
+        /// @param[in] edges The input edges, moved into the mesh when passed as temporaries
+        /// @param[in] nodes The input node coordinates, moved into the mesh when passed as temporaries
         /// @param[in] projection  The projection to use
-        Mesh(const std::vector<Edge>& edges,
-             const std::vector<Point>& nodes,
+        Mesh(std::vector<Edge> edges,
+             NodeCoordinates nodes,
              Projection projection);
 
         /// @brief Inquire if a node is on boundary
@@ -192,6 +194,7 @@ namespace meshkernel
         [[nodiscard]] size_t FindCommonNode(size_t firstEdgeIndex, size_t secondEdgeIndex) const;
 
         /// @brief Compute the lengths of all edges in one go
+        /// For cartesian meshes the lengths are computed from the coordinate arrays, without projection dispatch per edge
         void ComputeEdgesLengths();
 
         /// @brief Computes the edges centers  in one go
@@ -206,6 +209,9 @@ namespace meshkernel
         /// @brief Perform node and edges administration
         void AdministrateNodesEdges();
 
+        /// @brief Rebuilds the node and edge R-trees already in use, if the nodes or the edges changed
+        void UpdateRTrees();
+
         /// @brief Sort mesh edges in conterclockwise orther (Sort_links_ccw)
         /// @param[in] node The node index for which sorting should take place
         void SortEdgesInCounterClockWiseOrder(size_t node);
@@ -219,6 +225,13 @@ namespace meshkernel
         /// @param[in] meshLocation The mesh location for which the RTree is build
         void BuildTree(MeshLocations meshLocation);
 
+        /// @brief Adds the allocations of the nodes, edges, faces and R-trees
+        /// @param[in,out] memoryUsage The memory usage to add to
+        void AccumulateMemoryUsage(MemoryUsage& memoryUsage) const;
+
+        /// @brief Releases the R-trees, they are rebuilt on demand
+        void ReleaseCaches();
+
         /// @brief Search the locations sorted by proximity to a point.
         /// @param[in] point The reference point.
         /// @param[in] meshLocation The mesh location (e.g. nodes, edge centers or face circumcenters).
@@ -242,7 +255,7 @@ namespace meshkernel
         size_t GetNearestNeighborIndex(size_t index, MeshLocations meshLocation);
 
         // nodes
-        std::vector<Point> m_nodes;                    ///< The mesh nodes (xk, yk)
+        NodeCoordinates m_nodes;                       ///< The mesh nodes (xk, yk)
         std::vector<std::vector<size_t>> m_nodesEdges; ///< For each node, the indices of connected edges (nod%lin)
         std::vector<size_t> m_nodesNumEdges;           ///< For each node, the number of connected edges (nmk)
         std::vector<int> m_nodeMask;                   ///< The node mask (kc)
@@ -268,13 +281,15 @@ namespace meshkernel
         Projection m_projection; ///< The projection used
 
         // counters
-        size_t m_numFaces = 0;                  ///< Number of valid faces (nump)
-        size_t m_numNodes = 0;                  ///< Number of valid nodes in m_nodes
-        size_t m_numEdges = 0;                  ///< Number of valid edges in m_edges
-        bool m_nodesRTreeRequiresUpdate = true; ///< m_nodesRTree requires an update
-        bool m_edgesRTreeRequiresUpdate = true; ///< m_edgesRTree requires an update
-        RTree m_nodesRTree;                     ///< Spatial R-Tree used to inquire node nodes
-        RTree m_edgesRTree;                     ///< Spatial R-Tree used to inquire edges centers
-        RTree m_facesRTree;                     ///< Spatial R-Tree used to inquire face circumcenters
+        size_t m_numFaces = 0;                    ///< Number of valid faces (nump)
+        size_t m_numNodes = 0;                    ///< Number of valid nodes in m_nodes
+        size_t m_numEdges = 0;                    ///< Number of valid edges in m_edges
+        bool m_nodesRTreeRequiresUpdate = true;   ///< m_nodesRTree requires an update
+        bool m_edgesRTreeRequiresUpdate = true;   ///< m_edgesRTree requires an update
+        bool m_boundaryLoopsRequireUpdate = true; ///< The boundary loops require an update, the topology changed or the administration renumbered the nodes
+        bool m_facesRequireUpdate = true;         ///< The face administration requires an update, the topology changed after the last face search
+        RTree m_nodesRTree;                       ///< Spatial R-Tree used to inquire node nodes
+        RTree m_edgesRTree;                       ///< Spatial R-Tree used to inquire edges centers
+        RTree m_facesRTree;                       ///< Spatial R-Tree used to inquire face circumcenters
     };
 } // namespace meshkernel
@@ -28,8 +28,8 @@
 #pragma once
 #include <vector>
 
-#include <Meshkernel/Entities.hpp>
-#include <Meshkernel/Mesh.hpp>
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Mesh.hpp>
 
 /// \namespace meshkernel
 /// @brief Contains the logic of the C++ static library
@@ -45,13 +45,21 @@ namespace meshkernel
         Mesh1D() = default;
 
         /// @brief Construct a mesh1d starting from the edges and nodes
-        /// @param[in] edges The input edges
-        /// @param[in] nodes The input nodes
+        /// @param[in] edges The input edges, moved into the mesh when passed as temporaries
+        /// @param[in] nodes The input nodes, copied into the node coordinate arrays
         /// @param[in] projection  The projection to use
-        Mesh1D(const std::vector<Edge>& edges,
+        Mesh1D(std::vector<Edge> edges,
                const std::vector<Point>& nodes,
                Projection projection);
 
+        /// @brief Construct a mesh1d starting from the edges and the node coordinate arrays
+        /// @param[in] edges The input edges, moved into the mesh when passed as temporaries
+        /// @param[in] nodes The input node coordinates, moved into the mesh when passed as temporaries
+        /// @param[in] projection  The projection to use
+        Mesh1D(std::vector<Edge> edges,
+               NodeCoordinates nodes,
+               Projection projection);
+
         /// @brief Inquire if a mesh 1d-node is on boundary
         /// @param[in] node The node index
         /// @return If the node is on boundary
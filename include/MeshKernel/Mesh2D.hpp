@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 
 #include <MeshKernel/Entities.hpp>
@@ -79,33 +80,64 @@ namespace meshkernel
         Mesh2D() = default;
 
         /// @brief Construct a mesh2d starting from the edges and nodes
-        /// @param[in] edges The input edges
-        /// @param[in] nodes The input nodes
+        /// @param[in] edges The input edges, moved into the mesh when passed as temporaries
+        /// @param[in] nodes The input nodes, copied into the node coordinate arrays
         /// @param[in] projection The projection to use
         /// @param[in] administration Type of administration to perform
-        Mesh2D(const std::vector<Edge>& edges, const std::vector<Point>& nodes, Projection projection, AdministrationOptions administration = AdministrationOptions::AdministrateMeshEdgesAndFaces);
+        Mesh2D(std::vector<Edge> edges, const std::vector<Point>& nodes, Projection projection, AdministrationOptions administration = AdministrationOptions::AdministrateMeshEdgesAndFaces);
+
+        /// @brief Construct a mesh2d starting from the edges and the node coordinate arrays
+        /// @param[in] edges The input edges, moved into the mesh when passed as temporaries
+        /// @param[in] nodes The input node coordinates, moved into the mesh when passed as temporaries
+        /// @param[in] projection The projection to use
+        /// @param[in] administration Type of administration to perform
+        Mesh2D(std::vector<Edge> edges, NodeCoordinates nodes, Projection projection, AdministrationOptions administration = AdministrationOptions::AdministrateMeshEdgesAndFaces);
 
         /// @brief Converting constructor, from curvilinear grid to mesh (gridtonet)
+        /// The nodes, edges and faces are generated directly from the grid topology, in grid index order
         /// @param[in] curvilinearGrid The curvilinear grid to create the mesh from
         /// @param[in] projection The \ref Projection to use
         Mesh2D(const CurvilinearGrid& curvilinearGrid, Projection projection);
 
         /// @brief Create triangular grid from nodes (triangulatesamplestonetwork)
-        /// @param[in] nodes Input nodes
+        /// @param[in] nodes Input nodes, copied into the node coordinate arrays
         /// @param[in] polygons Selection polygon
         /// @param[in] projection The projection to use
-        Mesh2D(const std::vector<Point>& nodes, const Polygons& polygons, Projection projection);
+        /// @param[in] maximumNodesPerTile Larger node sets are triangulated in parallel tiles (0 to always use a single triangulation)
+        Mesh2D(const std::vector<Point>& nodes,
+               const Polygons& polygons,
+               Projection projection,
+               size_t maximumNodesPerTile = maximumNumberOfPointsPerTriangulationTile);
 
         /// @brief Add meshes: result is a mesh composed of the additions
-        /// firstMesh += secondmesh results in the second mesh being added to the first
+        /// firstMesh += secondmesh results in the second mesh being added to the first.
+        /// When both meshes have an up to date face administration, the administration of the second mesh is appended and the faces of the first mesh are not searched again
         /// @param[in] rhs The mesh to add
         /// @returns The resulting mesh
         Mesh2D& operator+=(Mesh2D const& rhs);
 
-        /// @brief Set internal flat copies of nodes and edges, so the pointer to the first entry is communicated with the front-end
+        /// @brief Checks if the face administration is current and would not be changed by \ref Administrate
+        /// @returns True if the mesh has no invalid or unconnected nodes, no invalid edges and faces found after the last topology change
+        [[nodiscard]] bool HasUpToDateFaceAdministration() const;
+
+        /// @brief Set internal flat copies of edges and faces, so the pointer to the first entry is communicated with the front-end
+        /// @note The node coordinates are not copied, the front-end gets the coordinate arrays of m_nodes.
+        /// The flat buffers keep their capacity between calls, repeated exchanges with the front-end do not reallocate them
         /// @param administrationOption Type of administration to perform
         void SetFlatCopies(AdministrationOptions administrationOption);
 
+        /// @brief Gets the bytes allocated by the mesh, by subsystem
+        /// @returns The memory usage
+        [[nodiscard]] MemoryUsage GetMemoryUsage() const;
+
+        /// @brief Adds the allocations of the mesh, of its flat copies and of its caches
+        /// @param[in,out] memoryUsage The memory usage to add to
+        void AccumulateMemoryUsage(MemoryUsage& memoryUsage) const;
+
+        /// @brief Releases the caches, the R-trees and the flat copies, they are rebuilt on demand
+        /// @note The pointers to the flat copies communicated to the front-end become invalid
+        void Shrink();
+
         /// @brief Perform mesh administration
         /// @param administrationOption Type of administration to perform
         void Administrate(AdministrationOptions administrationOption);
@@ -228,6 +260,17 @@ namespace meshkernel
         /// This threshold is the ration of the face area to the average area of neighboring faces.
         void DeleteSmallTrianglesAtBoundaries(double minFractionalAreaTriangles);
 
+        /// @brief Deletes degenerated triangles, small flow edges and small triangles at the boundaries in one pipeline
+        ///
+        /// Gives the result of \ref DeleteSmallFlowEdges followed by \ref DeleteSmallTrianglesAtBoundaries. Both stages detect
+        /// in parallel on the same administration: the small triangles are found next to the faces merged across the small
+        /// flow edges, without administrating the mesh in between. The deletions are applied in one batch and the mesh is
+        /// administrated once at the end. Degenerated triangles, if any, are collapsed and administrated beforehand,
+        /// because they change the circumcenters the flow edges are computed from.
+        /// @param[in] smallFlowEdgesThreshold The configurable threshold for detecting the small flow edges
+        /// @param[in] minFractionalAreaTriangles The threshold for the small triangles at the boundaries
+        void DeleteSmallFlowEdgesAndSmallTrianglesAtBoundaries(double smallFlowEdgesThreshold, double minFractionalAreaTriangles);
+
         /// @brief Computes m_nodesNodes, see class members
         void ComputeNodeNeighbours();
 
@@ -239,6 +282,26 @@ namespace meshkernel
         /// @return The smoothness at the edges
         [[nodiscard]] std::vector<double> GetSmoothness();
 
+        /// @brief Gets the orthogonality of an edge
+        /// @param[in] edge The edge index
+        /// @return The absolute normalized inner product of the edge and the segment connecting its face circumcenters, doubleMissingValue on the boundary
+        [[nodiscard]] double GetEdgeOrthogonality(size_t edge) const;
+
+        /// @brief Gets the smoothness of an edge
+        /// @param[in] edge The edge index
+        /// @return The ratio of the larger to the smaller area of its faces, doubleMissingValue on the boundary or next to faces smaller than minimumCellArea
+        [[nodiscard]] double GetEdgeSmoothness(size_t edge) const;
+
+        /// @brief Gets the ratio of the flow edge length to the cut off distance base of an edge (see \ref DeleteSmallFlowEdges)
+        /// @param[in] edge The edge index
+        /// @return The ratio, the edge crosses a small flow edge if it is smaller than the threshold. doubleMissingValue on the boundary
+        [[nodiscard]] double GetFlowEdgeLengthRatio(size_t edge) const;
+
+        /// @brief Determines if a face is an obtuse triangle
+        /// @param[in] face The face index
+        /// @return True if the face is a triangle with an obtuse angle
+        [[nodiscard]] bool IsObtuseTriangle(size_t face) const;
+
         /// @brief Gets the aspect ratios (the ratios edges lengths to flow edges lengths)
         /// @param[in,out] aspectRatios The aspect ratios (passed as reference to avoid re-allocation)
         void ComputeAspectRatios(std::vector<double>& aspectRatios);
@@ -264,19 +327,19 @@ namespace meshkernel
         [[nodiscard]] std::vector<size_t> SortedFacesAroundNode(size_t node) const;
 
         /// @brief Convert all mesh boundaries to a vector of polygon nodes, including holes (copynetboundstopol)
+        ///
+        /// The boundary loops (see \ref GetBoundaryLoops) are clipped loop by loop: each node is tested once against the polygon
+        /// and the loops are split at the nodes outside of it.
         /// @param[in] polygon The polygon where the operation is performed
         /// @return The resulting polygon mesh boundary
         [[nodiscard]] std::vector<Point> MeshBoundaryToPolygon(const std::vector<Point>& polygon);
 
-        /// @brief Constructs a polygon from the meshboundary, by walking through the mesh
-        /// @param[in] polygonNodes The input mesh
-        /// @param[in] isVisited the visited mesh nodes
-        /// @param[in] currentNode the current node
-        /// @param[out] meshBoundaryPolygon The resulting polygon points
-        void WalkBoundaryFromNode(const std::vector<Point>& polygonNodes,
-                                  std::vector<bool>& isVisited,
-                                  size_t& currentNode,
-                                  std::vector<Point>& meshBoundaryPolygon) const;
+        /// @brief Gets the mesh boundary loops
+        ///
+        /// The loops are built in one pass over the boundary edges and cached until the topology of the mesh changes
+        /// or the mesh is administrated again.
+        /// @return For each loop, the boundary nodes in walking order. A closed loop ends with its first node
+        [[nodiscard]] const std::vector<std::vector<size_t>>& GetBoundaryLoops();
 
         /// @brief Gets the hanging edges
         /// @return A vector with the indices of the hanging edges
@@ -302,8 +365,6 @@ namespace meshkernel
         [[nodiscard]] std::tuple<size_t, size_t> IsSegmentCrossingABoundaryEdge(const Point& firstPoint, const Point& secondPoint) const;
 
         // vectors for communicating with the client
-        std::vector<double> m_nodex;               ///< The nodes x-coordinate
-        std::vector<double> m_nodey;               ///< The nodes y-coordinate
         std::vector<double> m_nodez;               ///< The nodes z-coordinate
         std::vector<int> m_edgeNodes;              ///< For each edge, the nodes
         std::vector<int> m_faceNodes;              ///< For each face, the nodes
@@ -313,7 +374,9 @@ namespace meshkernel
 
         size_t m_maxNumNeighbours = 0; ///< Maximum number of neighbors
 
-        std::vector<Point> m_polygonNodesCache; ///< Cache to store the face nodes
+        std::vector<Point> m_polygonNodesCache; ///< Cache to store the face nodes, not to be used in parallel loops
+
+        std::vector<std::vector<size_t>> m_boundaryLoops; ///< The cached boundary loops (see \ref GetBoundaryLoops)
 
     private:
         /// @brief Find cells recursive, works with an arbitrary number of edges
@@ -338,6 +401,109 @@ namespace meshkernel
                                 std::vector<size_t>& sortedNodes,
                                 std::vector<Point>& nodalValues);
 
+        /// @brief Administrates the faces of a mesh converted from a curvilinear grid, using the grid cells instead of the face search
+        /// @param[in] numMNodes The number of grid nodes in m direction
+        /// @param[in] numNNodes The number of grid nodes in n direction
+        /// @param[in] nodeIndices For each grid node, the mesh node index (sizetMissingValue if the node is not in the mesh)
+        /// @param[in] mEdgeIndices For each grid edge in m direction, the mesh edge index
+        /// @param[in] nEdgeIndices For each grid edge in n direction, the mesh edge index
+        /// @returns False if the grid cells are degenerate or not consistently oriented. In this case the faces must be found with FindFaces
+        [[nodiscard]] bool AdministrateStructuredFaces(size_t numMNodes,
+                                                       size_t numNNodes,
+                                                       const std::vector<size_t>& nodeIndices,
+                                                       const std::vector<size_t>& mEdgeIndices,
+                                                       const std::vector<size_t>& nEdgeIndices);
+
+        /// @brief Appends an administrated mesh, offsetting its node, edge and face administration instead of searching the faces again.
+        /// The face geometry and the node types of the appended mesh are recomputed, because the nodes of both meshes might have been moved
+        /// @param[in] rhs The mesh to append, with an up to date face administration
+        void AppendAdministratedMesh(Mesh2D const& rhs);
+
+        /// @brief Triangulates nodes and collects the edges of the valid triangles inside the polygons
+        /// @param[in] nodes The nodes to triangulate
+        /// @param[in] polygons The selection polygons
+        /// @returns The edges, indexed in the input nodes
+        [[nodiscard]] std::vector<Edge> TriangulateNodes(const std::vector<Point>& nodes, const Polygons& polygons) const;
+
+        /// @brief Triangulates nodes in overlapping tiles (see \ref TriangulationTiles) in parallel and merges their edges
+        ///
+        /// Each tile keeps the triangles with the circumcenter in its core whose circumcircle lies inside the tile, these are
+        /// triangles of the triangulation of all nodes. Triangles of cocircular nodes share the circumcenter, so a single tile
+        /// decides how these nodes are triangulated. The triangles rejected by all tiles are then found with \ref FindMissingDelaunayTriangles
+        /// @param[in] nodes The nodes to triangulate
+        /// @param[in] polygons The selection polygons
+        /// @param[in] maximumNodesPerTile The target number of nodes in each tile
+        /// @returns The edges, indexed in the input nodes
+        [[nodiscard]] std::vector<Edge> TriangulateNodesInTiles(const std::vector<Point>& nodes,
+                                                                const Polygons& polygons,
+                                                                size_t maximumNodesPerTile) const;
+
+        /// @brief Finds the Delaunay triangles of the nodes that are missing from a partial triangulation
+        ///
+        /// The nodes of a missing triangle are on the border of the partial triangulation, so the missing triangles are
+        /// the triangles of the border nodes whose circumcircle contains no other node. When other nodes are on the
+        /// circumcircle, the triangle is rejected if it crosses an edge of the partial triangulation
+        /// @param[in] nodes The nodes
+        /// @param[in] triangles The triangles of the partial triangulation, which are Delaunay triangles of all nodes
+        /// @returns The missing triangles (some of them can also be in the partial triangulation)
+        [[nodiscard]] std::vector<std::array<size_t, 3>> FindMissingDelaunayTriangles(const std::vector<Point>& nodes,
+                                                                                      const std::vector<std::array<size_t, 3>>& triangles) const;
+
+        /// @brief Checks if a triangle crosses an edge connecting two nodes on its circumcircle
+        /// @param[in] nodes The nodes
+        /// @param[in] triangle The triangle nodes
+        /// @param[in] circleNodes The nodes on the triangle circumcircle, including the triangle nodes
+        /// @param[in] sortedEdges The edges, with the smallest node first, in ascending order
+        /// @returns True if an edge crosses the triangle
+        [[nodiscard]] bool IsTriangleCrossingEdges(const std::vector<Point>& nodes,
+                                                   const std::array<size_t, 3>& triangle,
+                                                   const std::vector<size_t>& circleNodes,
+                                                   const std::vector<Edge>& sortedEdges) const;
+
+        /// @brief Checks if a triangle is valid (\ref CheckTriangle) and its approximate center is inside the polygons
+        /// @param[in] faceNodes The triangle nodes
+        /// @param[in] nodes The nodes
+        /// @param[in] polygons The selection polygons
+        /// @returns If the triangle is used for the mesh
+        [[nodiscard]] bool IsTriangleSelected(const std::vector<size_t>& faceNodes, const std::vector<Point>& nodes, const Polygons& polygons) const;
+
+        /// @brief Computes the boundary loops from the edge-face counts of the current administration
+        void ComputeBoundaryLoops();
+
+        /// @brief Walks the unvisited boundary edges starting from a node
+        /// @param[in,out] isVisited The visited edges
+        /// @param[in,out] currentNode The start node, on return the last node reached
+        /// @param[in,out] loopNodes The nodes reached are appended
+        void WalkBoundaryFromNode(std::vector<bool>& isVisited,
+                                  size_t& currentNode,
+                                  std::vector<size_t>& loopNodes) const;
+
+        /// @brief Finds the degenerated triangles on the current administration, in parallel
+        /// @returns The indices of the triangles having collinear nodes
+        [[nodiscard]] std::vector<size_t> FindDegeneratedTriangles() const;
+
+        /// @brief Collapses degenerated triangles, without administrating the mesh
+        /// @param[in] degeneratedTriangles The indices of the degenerated triangles
+        void CollapseDegeneratedTriangles(const std::vector<size_t>& degeneratedTriangles);
+
+        /// @brief Finds the edges crossing small flow edges on the current administration, in parallel
+        /// @param[in] smallFlowEdgesThreshold The configurable threshold for detecting the small flow edges
+        /// @returns The indices of the edges crossing small flow edges
+        [[nodiscard]] std::vector<size_t> FindEdgesCrossingSmallFlowEdges(double smallFlowEdgesThreshold) const;
+
+        /// @brief Finds the small triangles at the boundaries on the current administration, in parallel
+        ///
+        /// The faces sharing a removed edge are considered merged, as the administration after the removal would find them
+        /// @param[in] minFractionalAreaTriangles The threshold on the ratio of the face area to the average area of neighboring faces
+        /// @param[in] removedEdges The internal edges to be removed before the small triangles are merged
+        /// @returns For each small triangle, the node to preserve and the two nodes to merge
+        [[nodiscard]] std::vector<std::array<size_t, 3>> FindSmallTrianglesAtBoundaries(double minFractionalAreaTriangles, const std::vector<size_t>& removedEdges = {}) const;
+
+        /// @brief Merges the nodes of small triangles at the boundaries, without administrating the mesh
+        /// @param[in] smallTrianglesNodes The small triangles nodes, as returned by \ref FindSmallTrianglesAtBoundaries
+        /// @returns True if any node was merged
+        bool MergeSmallTrianglesAtBoundaries(const std::vector<std::array<size_t, 3>>& smallTrianglesNodes);
+
         /// @brief Checks if a triangle has an acute angle (checktriangle)
         /// @param[in] faceNodes
         /// @param[in] nodes
@@ -0,0 +1,117 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <MeshKernel/Constants.hpp>
+
+namespace meshkernel
+{
+    class Mesh2D;
+
+    /// @brief Summary statistics and histogram of a quality metric
+    struct QualityStatistics
+    {
+        size_t m_numValues = 0;                ///< The number of valid values
+        double m_minimum = doubleMissingValue; ///< The minimum valid value
+        double m_maximum = doubleMissingValue; ///< The maximum valid value
+        double m_mean = doubleMissingValue;    ///< The mean of the valid values
+        std::vector<size_t> m_histogram;       ///< The number of valid values in equally wide bins between the minimum and the maximum
+    };
+
+    /// @brief Computes the quality metrics of a mesh in a single pass
+    ///
+    /// All per-edge metrics (orthogonality, smoothness and flow edge length ratio) and
+    /// per-face metrics (obtuse triangles) are computed in one parallel sweep over the
+    /// edges and the faces. The mesh topology must be administered, it is not modified.
+    /// The aspect ratios are not part of the sweep: they follow from the algorithm used by the orthogonalization
+    /// (\ref Mesh2D::ComputeAspectRatios), which scatters the lengths of opposite quadrilateral edges from a sweep
+    /// over the faces before a final sweep over the edges, so they are not a function of a single edge.
+    class MeshQuality
+    {
+    public:
+        /// @brief The quality metrics
+        enum class Metric
+        {
+            Orthogonality = 0,      ///< The edge orthogonality (\ref Mesh2D::GetEdgeOrthogonality)
+            Smoothness = 1,         ///< The edge smoothness (\ref Mesh2D::GetEdgeSmoothness)
+            AspectRatio = 2,        ///< The edge aspect ratio (\ref Mesh2D::ComputeAspectRatios)
+            FlowEdgeLengthRatio = 3 ///< The edge flow length ratio (\ref Mesh2D::GetFlowEdgeLengthRatio)
+        };
+
+        static constexpr size_t NumMetrics = 4; ///< The number of metrics
+
+        /// @brief Constructor
+        /// @param[in] mesh The mesh
+        /// @param[in] numHistogramBins The number of bins in the histograms
+        explicit MeshQuality(std::shared_ptr<Mesh2D> mesh, size_t numHistogramBins = 10);
+
+        /// @brief Computes all metrics and their statistics
+        void Compute();
+
+        /// @brief Gets the per-edge values of a metric
+        /// @param[in] metric The metric
+        /// @returns The values, doubleMissingValue where the metric is not defined
+        [[nodiscard]] const std::vector<double>& GetValues(Metric metric) const { return m_values[static_cast<size_t>(metric)]; }
+
+        /// @brief Gets the statistics of a metric
+        /// @param[in] metric The metric
+        /// @returns The statistics
+        [[nodiscard]] const QualityStatistics& GetStatistics(Metric metric) const { return m_statistics[static_cast<size_t>(metric)]; }
+
+        /// @brief Gets the obtuse triangles
+        /// @returns The indices of the faces being obtuse triangles
+        [[nodiscard]] const std::vector<size_t>& GetObtuseTriangles() const { return m_obtuseTriangles; }
+
+        /// @brief Gets the edges crossing small flow edges
+        /// @param[in] smallFlowEdgesThreshold The configurable threshold for detecting the small flow edges
+        /// @returns The indices of the edges crossing small flow edges
+        [[nodiscard]] std::vector<size_t> GetEdgesCrossingSmallFlowEdges(double smallFlowEdgesThreshold) const;
+
+        /// @brief Gets the name of a metric
+        /// @param[in] metric The metric
+        /// @returns The name
+        [[nodiscard]] static std::string GetMetricName(Metric metric);
+
+    private:
+        /// @brief Computes the statistics of the values of a metric
+        /// @param[in] values The values
+        /// @returns The statistics
+        [[nodiscard]] QualityStatistics ComputeStatistics(const std::vector<double>& values) const;
+
+        std::shared_ptr<Mesh2D> m_mesh;                         ///< Pointer to the mesh
+        size_t m_numHistogramBins;                              ///< The number of bins in the histograms
+        std::array<std::vector<double>, NumMetrics> m_values;   ///< For each metric, the values
+        std::array<QualityStatistics, NumMetrics> m_statistics; ///< For each metric, the statistics
+        std::vector<size_t> m_obtuseTriangles;                  ///< The obtuse triangles
+    };
+} // namespace meshkernel
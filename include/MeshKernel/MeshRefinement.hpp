@@ -31,6 +31,7 @@
 
 #include <MeshKernel/AveragingInterpolation.hpp>
 #include <MeshKernel/Entities.hpp>
+#include <MeshKernel/MemoryUsage.hpp>
 #include <MeshKernel/Polygons.hpp>
 #include <MeshKernel/RTree.hpp>
 #include <MeshKernelApi/InterpolationParameters.hpp>
@@ -119,6 +120,10 @@ namespace meshkernel
         /// 5. Connect hanging nodes if requested, DeleteIsolatedHangingnodes, ConnectHangingNodes
         void Compute();
 
+        /// @brief Adds the allocations of the refinement masks and caches, and of the averaging if refining based on samples
+        /// @param[in,out] memoryUsage The memory usage to add to
+        void AccumulateMemoryUsage(MemoryUsage& memoryUsage) const;
+
     private:
         /// @brief Finds if two edges are brothers, sharing an hanging node. Can be moved to Mesh2D
         void FindBrotherEdges();
@@ -0,0 +1,175 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <MeshKernel/Entities.hpp>
+
+namespace meshkernel
+{
+    // Forward declarations
+    class Mesh2D;
+
+    /// @brief A read-only view of a contiguous array, used to expose the memory-mapped snapshot sections
+    template <typename T>
+    class ArrayView
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] data The pointer to the first element
+        /// @param[in] size The number of elements
+        ArrayView(const T* data, size_t size) : m_data(data), m_size(size) {}
+
+        /// @brief The element at the given position
+        const T& operator[](size_t index) const { return m_data[index]; }
+
+        /// @brief The number of elements
+        [[nodiscard]] size_t size() const { return m_size; }
+
+        /// @brief Whether the view is empty
+        [[nodiscard]] bool empty() const { return m_size == 0; }
+
+        /// @brief The pointer to the first element
+        [[nodiscard]] const T* data() const { return m_data; }
+
+        /// @brief The iterator to the first element
+        [[nodiscard]] const T* begin() const { return m_data; }
+
+        /// @brief The iterator past the last element
+        [[nodiscard]] const T* end() const { return m_data + m_size; }
+
+    private:
+        const T* m_data = nullptr; ///< The first element
+        size_t m_size = 0;         ///< The number of elements
+    };
+
+    /// @brief A versioned binary snapshot of an administered Mesh2D, accessed through a read-only memory mapping.
+    ///
+    /// The snapshot stores the state computed by Mesh2D::Administrate in flat, 8-byte aligned arrays:
+    /// the node x- and y-coordinates, node-edge mapping and node types, the edges and edge-face mapping, and the face nodes, face edges,
+    /// circumcenters, mass centers and areas. Variable length mappings (node edges, face nodes and face edges)
+    /// are stored in compressed row format, as offsets followed by the concatenated indices.
+    ///
+    /// Opening a snapshot maps the file and validates the header and section bounds, nothing is parsed or copied.
+    /// The arrays can be queried directly through views into the mapping, without copies. They can also be turned
+    /// into an administered Mesh2D without calling Administrate. Mesh2D owns its arrays in vectors, so ToMesh2D
+    /// copies every section, and expands the compressed rows into nested vectors.
+    ///
+    /// Snapshots are written in the native byte order and are rejected when opened on a machine with a different one.
+    class MeshSnapshot
+    {
+    public:
+        /// @brief The version of the snapshot format written by this library
+        static constexpr std::uint32_t Version = 2;
+
+        /// @brief Writes the state of an administered mesh to a snapshot file
+        /// @param[in] filePath The path of the snapshot file, overwritten if it exists
+        /// @param[in] mesh The administered mesh
+        static void Write(const std::string& filePath, const Mesh2D& mesh);
+
+        /// @brief Memory-maps an existing snapshot file
+        /// @param[in] filePath The path of the snapshot file
+        explicit MeshSnapshot(const std::string& filePath);
+
+        MeshSnapshot(const MeshSnapshot&) = delete;
+        MeshSnapshot& operator=(const MeshSnapshot&) = delete;
+
+        /// @brief Unmaps the file
+        ~MeshSnapshot();
+
+        /// @brief Gets the projection of the mesh
+        [[nodiscard]] Projection GetProjection() const;
+
+        /// @brief The x-coordinates of the mesh nodes
+        [[nodiscard]] ArrayView<double> NodesX() const;
+
+        /// @brief The y-coordinates of the mesh nodes
+        [[nodiscard]] ArrayView<double> NodesY() const;
+
+        /// @brief For each node, the offset of its edges in NodesEdges (number of nodes + 1 entries)
+        [[nodiscard]] ArrayView<std::uint64_t> NodesEdgesOffsets() const;
+
+        /// @brief The edges connected to the nodes, in counterclockwise order
+        [[nodiscard]] ArrayView<std::uint64_t> NodesEdges() const;
+
+        /// @brief The node types, as computed by Mesh2D::ClassifyNodes
+        [[nodiscard]] ArrayView<std::int32_t> NodesTypes() const;
+
+        /// @brief The mesh edges
+        [[nodiscard]] ArrayView<Edge> Edges() const;
+
+        /// @brief For each edge, the number of faces sharing it
+        [[nodiscard]] ArrayView<std::uint64_t> EdgesNumFaces() const;
+
+        /// @brief For each edge, the two faces sharing it (missing faces are sizetMissingValue)
+        [[nodiscard]] ArrayView<std::uint64_t> EdgesFaces() const;
+
+        /// @brief For each face, the offset of its nodes and edges in FacesNodes and FacesEdges (number of faces + 1 entries)
+        [[nodiscard]] ArrayView<std::uint64_t> FacesOffsets() const;
+
+        /// @brief The face nodes, in counterclockwise order
+        [[nodiscard]] ArrayView<std::uint64_t> FacesNodes() const;
+
+        /// @brief The face edges
+        [[nodiscard]] ArrayView<std::uint64_t> FacesEdges() const;
+
+        /// @brief The face circumcenters
+        [[nodiscard]] ArrayView<Point> FacesCircumcenters() const;
+
+        /// @brief The face mass centers
+        [[nodiscard]] ArrayView<Point> FacesMassCenters() const;
+
+        /// @brief The face areas
+        [[nodiscard]] ArrayView<double> FacesAreas() const;
+
+        /// @brief Creates an administered mesh from the snapshot, without recomputing the administration
+        ///
+        /// All sections are copied into the vectors of the mesh, the mesh does not reference the mapping.
+        /// The cost is linear in the snapshot size, the views avoid it when a Mesh2D is not needed
+        /// @returns The mesh
+        [[nodiscard]] std::shared_ptr<Mesh2D> ToMesh2D() const;
+
+    private:
+        /// @brief Gets a view of a section of the mapped file
+        template <typename T>
+        [[nodiscard]] ArrayView<T> GetSection(size_t section) const;
+
+        /// @brief Validates the header, the bounds and sizes of all sections and the indices they hold
+        void Validate() const;
+
+        /// @brief Releases the mapping
+        void Unmap();
+
+        const char* m_data = nullptr; ///< The start of the mapped file
+        size_t m_size = 0;            ///< The size of the mapped file
+        void* m_fileHandle = nullptr; ///< The file handle (Windows only)
+        void* m_mapHandle = nullptr;  ///< The file mapping handle (Windows only)
+    };
+} // namespace meshkernel
@@ -0,0 +1,306 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <MeshKernel/Entities.hpp>
+
+namespace meshkernel
+{
+    /// @brief The node coordinates of a mesh, stored as a structure of arrays
+    ///
+    /// The x and y coordinates are kept in two contiguous arrays, so the kernels looping over the nodes
+    /// (edge lengths, edge centers, orthogonality) stream them and the API exposes them without copying.
+    /// Existing code accesses the nodes as points: a node of a constant instance is returned as a Point,
+    /// a node of a modifiable instance as a NodeCoordinates::Reference, a Point view assigning through to the arrays.
+    /// A Reference refers to the node, store it in a Point to keep the coordinates of a node about to be modified.
+    class NodeCoordinates
+    {
+    public:
+        /// @brief A modifiable view of the coordinates of a node, converts to a Point
+        class Reference
+        {
+        public:
+            /// @brief Constructor
+            /// @param[in] x The x-coordinate of the node
+            /// @param[in] y The y-coordinate of the node
+            Reference(double& x, double& y) : x(x), y(y) {}
+
+            /// @brief Copy constructor, the copy refers to the same node
+            Reference(const Reference&) = default;
+
+            /// @brief Assigns the coordinates of a point to the node
+            Reference& operator=(const Point& point)
+            {
+                x = point.x;
+                y = point.y;
+                return *this;
+            }
+
+            /// @brief Assigns the coordinates of another node to the node
+            Reference& operator=(const Reference& other)
+            {
+                return *this = static_cast<Point>(other);
+            }
+
+            /// @brief Converts to a point holding the coordinates of the node
+            operator Point() const { return {x, y}; }
+
+            /// @brief Overloads addition with a Point
+            Point operator+(const Point& rhs) const { return static_cast<Point>(*this) + rhs; }
+
+            /// @brief Overloads addition with a double
+            Point operator+(double rhs) const { return static_cast<Point>(*this) + rhs; }
+
+            /// @brief Overloads subtraction with a Point
+            Point operator-(const Point& rhs) const { return static_cast<Point>(*this) - rhs; }
+
+            /// @brief Overloads subtraction with a double
+            Point operator-(double rhs) const { return static_cast<Point>(*this) - rhs; }
+
+            /// @brief Overloads multiplication with a Point
+            Point operator*(const Point& rhs) const { return static_cast<Point>(*this) * rhs; }
+
+            /// @brief Overloads multiplication with a double
+            Point operator*(double rhs) const { return static_cast<Point>(*this) * rhs; }
+
+            /// @brief Overloads division with a Point
+            Point operator/(const Point& rhs) const { return static_cast<Point>(*this) / rhs; }
+
+            /// @brief Overloads division with a double
+            Point operator/(double rhs) const { return static_cast<Point>(*this) / rhs; }
+
+            /// @brief Overloads equality with a Point
+            bool operator==(const Point& rhs) const { return static_cast<Point>(*this) == rhs; }
+
+            /// @brief Overloads inequality with a Point
+            bool operator!=(const Point& rhs) const { return static_cast<Point>(*this) != rhs; }
+
+            /// @brief Determines if the node has valid coordinates
+            [[nodiscard]] bool IsValid(const double missingValue = doubleMissingValue) const
+            {
+                return static_cast<Point>(*this).IsValid(missingValue);
+            }
+
+            double& x; ///< X-coordinate of the node
+            double& y; ///< Y-coordinate of the node
+        };
+
+        /// @brief Iterates over the nodes of a constant instance, as points
+        class ConstIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag; ///< The iterator category
+            using value_type = Point;                            ///< The type of the iterated values
+            using difference_type = std::ptrdiff_t;              ///< The type of the distance between iterators
+            using pointer = const Point*;                        ///< The pointer type
+            using reference = Point;                             ///< The type returned by dereferencing
+
+            /// @brief Default constructor
+            ConstIterator() = default;
+
+            /// @brief Constructor
+            /// @param[in] nodes The node coordinates
+            /// @param[in] index The index of the node
+            ConstIterator(const NodeCoordinates& nodes, size_t index) : m_nodes(&nodes), m_index(index) {}
+
+            /// @brief Gets the coordinates of the node
+            Point operator*() const { return (*m_nodes)[m_index]; }
+
+            /// @brief Moves to the next node
+            ConstIterator& operator++()
+            {
+                ++m_index;
+                return *this;
+            }
+
+            /// @brief Moves to the next node, returns the iterator before moving
+            ConstIterator operator++(int)
+            {
+                auto previous = *this;
+                ++m_index;
+                return previous;
+            }
+
+            /// @brief Compares the positions of two iterators
+            bool operator==(const ConstIterator& other) const { return m_index == other.m_index; }
+
+            /// @brief Compares the positions of two iterators
+            bool operator!=(const ConstIterator& other) const { return m_index != other.m_index; }
+
+        private:
+            const NodeCoordinates* m_nodes = nullptr; ///< The node coordinates
+            size_t m_index = 0;                       ///< The index of the node
+        };
+
+        /// @brief Default constructor, without nodes
+        NodeCoordinates() = default;
+
+        /// @brief Constructs the coordinates of nodes given as points
+        /// @param[in] points The nodes
+        explicit NodeCoordinates(const std::vector<Point>& points) { *this = points; }
+
+        /// @brief Replaces the coordinates by the coordinates of nodes given as points
+        /// @param[in] points The nodes
+        NodeCoordinates& operator=(const std::vector<Point>& points)
+        {
+            m_x.resize(points.size());
+            m_y.resize(points.size());
+            for (size_t n = 0; n < points.size(); ++n)
+            {
+                m_x[n] = points[n].x;
+                m_y[n] = points[n].y;
+            }
+            return *this;
+        }
+
+        /// @brief Replaces the coordinates by the coordinates given as two arrays
+        /// @param[in] numNodes The number of nodes
+        /// @param[in] x The x-coordinates
+        /// @param[in] y The y-coordinates
+        void Assign(size_t numNodes, const double* x, const double* y)
+        {
+            m_x.assign(x, x + numNodes);
+            m_y.assign(y, y + numNodes);
+        }
+
+        /// @brief Appends the nodes of another instance
+        /// @param[in] other The node coordinates to append
+        void Append(const NodeCoordinates& other)
+        {
+            m_x.insert(m_x.end(), other.m_x.begin(), other.m_x.end());
+            m_y.insert(m_y.end(), other.m_y.begin(), other.m_y.end());
+        }
+
+        /// @brief Gets the nodes as points
+        /// @returns The points
+        [[nodiscard]] std::vector<Point> ToPoints() const
+        {
+            std::vector<Point> points;
+            points.reserve(size());
+            for (size_t n = 0; n < size(); ++n)
+            {
+                points.emplace_back(m_x[n], m_y[n]);
+            }
+            return points;
+        }
+
+        /// @brief Gets a modifiable view of a node
+        Reference operator[](size_t index) { return {m_x[index], m_y[index]}; }
+
+        /// @brief Gets the coordinates of a node
+        Point operator[](size_t index) const { return {m_x[index], m_y[index]}; }
+
+        /// @brief Gets the first node, for iterating over the nodes as points
+        [[nodiscard]] ConstIterator begin() const { return {*this, 0}; }
+
+        /// @brief Gets the end of the nodes, for iterating over the nodes as points
+        [[nodiscard]] ConstIterator end() const { return {*this, size()}; }
+
+        /// @brief Gets the number of nodes
+        [[nodiscard]] size_t size() const { return m_x.size(); }
+
+        /// @brief Inquires if there are no nodes
+        [[nodiscard]] bool empty() const { return m_x.empty(); }
+
+        /// @brief Changes the number of nodes, the added nodes have invalid coordinates
+        /// @param[in] numNodes The number of nodes
+        /// @param[in] point The coordinates of the added nodes
+        void resize(size_t numNodes, const Point& point = {doubleMissingValue, doubleMissingValue})
+        {
+            m_x.resize(numNodes, point.x);
+            m_y.resize(numNodes, point.y);
+        }
+
+        /// @brief Reserves the capacity of the coordinate arrays
+        /// @param[in] numNodes The number of nodes
+        void reserve(size_t numNodes)
+        {
+            m_x.reserve(numNodes);
+            m_y.reserve(numNodes);
+        }
+
+        /// @brief Removes all nodes
+        void clear()
+        {
+            m_x.clear();
+            m_y.clear();
+        }
+
+        /// @brief Removes the nodes with invalid coordinates, keeping the order of the others and the capacity
+        void RemoveInvalid()
+        {
+            size_t numValidNodes = 0;
+            for (size_t n = 0; n < size(); ++n)
+            {
+                if ((*this)[n].IsValid())
+                {
+                    m_x[numValidNodes] = m_x[n];
+                    m_y[numValidNodes] = m_y[n];
+                    numValidNodes++;
+                }
+            }
+            resize(numValidNodes);
+        }
+
+        /// @brief Appends a node
+        /// @param[in] point The coordinates of the node
+        void push_back(const Point& point)
+        {
+            m_x.push_back(point.x);
+            m_y.push_back(point.y);
+        }
+
+        /// @brief Gets the x-coordinates of the nodes
+        [[nodiscard]] const std::vector<double>& GetX() const { return m_x; }
+
+        /// @brief Gets the y-coordinates of the nodes
+        [[nodiscard]] const std::vector<double>& GetY() const { return m_y; }
+
+        /// @brief Gets the x-coordinates of the nodes, for exposing them to the API
+        [[nodiscard]] double* GetXData() { return m_x.data(); }
+
+        /// @brief Gets the y-coordinates of the nodes, for exposing them to the API
+        [[nodiscard]] double* GetYData() { return m_y.data(); }
+
+    private:
+        std::vector<double> m_x; ///< The x-coordinates of the nodes (xk)
+        std::vector<double> m_y; ///< The y-coordinates of the nodes (yk)
+    };
+
+    /// @brief Converts arrays of node coordinates to node coordinates, copying each array once
+    inline NodeCoordinates ConvertToNodeCoordinates(int numNodes, const double* nodex, const double* nodey)
+    {
+        NodeCoordinates nodes;
+        nodes.Assign(numNodes, nodex, nodey);
+        return nodes;
+    }
+} // namespace meshkernel
@@ -32,6 +32,7 @@
 #include <numeric>
 
 #include <MeshKernel/Constants.hpp>
+#include <MeshKernel/CurvilinearGrid.hpp>
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/RTree.hpp>
 
@@ -477,14 +478,14 @@ namespace meshkernel
     /// @param[in] projection The projection to use.
     /// @param[in] numM The number of columns to generate (horizontal direction).
     /// @param[in] numN  The number of rows to generate (vertical direction).
-    /// @return The resulting dicretization (expressed as number of points).
-    [[nodiscard]] std::vector<std::vector<Point>> DiscretizeTransfinite(const std::vector<Point>& sideOne,
-                                                                        const std::vector<Point>& sideTwo,
-                                                                        const std::vector<Point>& sideThree,
-                                                                        const std::vector<Point>& sideFour,
-                                                                        const Projection& projection,
-                                                                        size_t numM,
-                                                                        size_t numN);
+    /// @return The resulting dicretization, as a curvilinear grid of (numM + 1) x (numN + 1) points.
+    [[nodiscard]] CurvilinearGrid DiscretizeTransfinite(const std::vector<Point>& sideOne,
+                                                        const std::vector<Point>& sideTwo,
+                                                        const std::vector<Point>& sideThree,
+                                                        const std::vector<Point>& sideFour,
+                                                        const Projection& projection,
+                                                        size_t numM,
+                                                        size_t numN);
 
     /// @brief Computes the edge centers
     /// @param[in] nodes The vector of edge nodes.
@@ -521,11 +522,11 @@ namespace meshkernel
     [[nodiscard]] Point ComputeAverageCoordinate(const std::vector<Point>& points, const Projection& projection);
 
     /// @brief Given a vector of coordinates, get the lowest upper and right points
-    /// @tparam T Requires IsCoordinate<T>
+    /// @tparam Points A std::vector<T> with T requiring IsCoordinate<T>, or NodeCoordinates
     /// @param[in] points The point values
     /// @returns A tuple with bottom left and upper right corners of the bounding box
-    template <typename T>
-    [[nodiscard]] std::tuple<Point, Point> GetBoundingBox(const std::vector<T>& points)
+    template <typename Points>
+    [[nodiscard]] std::tuple<Point, Point> GetBoundingBox(const Points& points)
     {
         double minx = std::numeric_limits<double>::max();
         double maxx = std::numeric_limits<double>::lowest();
@@ -545,4 +546,93 @@ namespace meshkernel
         return {{minx, miny}, {maxx, maxy}};
     }
 
+    /// @brief Computes the planar convex hull of a series of points (monotone chain)
+    /// @tparam T Requires IsCoordinate<T>
+    /// @param[in] points The point values
+    /// @returns The hull as a closed polygon in counterclockwise order, empty if all points are collinear
+    template <typename T>
+    [[nodiscard]] std::vector<Point> ConvexHull(const std::vector<T>& points)
+    {
+        // the extreme points span a quadrilateral, the points strictly inside it are not on the hull
+        const auto [lowerLeft, upperRight] = GetBoundingBox(points);
+        Point quadrilateral[4] = {lowerLeft, lowerLeft, upperRight, upperRight};
+        for (const auto& point : points)
+        {
+            if (!point.IsValid())
+            {
+                continue;
+            }
+            if (point.y == lowerLeft.y)
+            {
+                quadrilateral[0] = {point.x, point.y};
+            }
+            if (point.x == upperRight.x)
+            {
+                quadrilateral[1] = {point.x, point.y};
+            }
+            if (point.y == upperRight.y)
+            {
+                quadrilateral[2] = {point.x, point.y};
+            }
+            if (point.x == lowerLeft.x)
+            {
+                quadrilateral[3] = {point.x, point.y};
+            }
+        }
+
+        std::vector<Point> candidates;
+        for (const auto& point : points)
+        {
+            if (!point.IsValid())
+            {
+                continue;
+            }
+            const Point candidate{point.x, point.y};
+            bool isInside = true;
+            for (auto i = 0; i < 4 && isInside; ++i)
+            {
+                isInside = IsLeft(quadrilateral[i], quadrilateral[(i + 1) % 4], candidate) > 0.0;
+            }
+            if (!isInside)
+            {
+                candidates.emplace_back(candidate);
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end(), [](const Point& first, const Point& second) { return first.x < second.x || (first.x == second.x && first.y < second.y); });
+        candidates.erase(std::unique(candidates.begin(), candidates.end(), [](const Point& first, const Point& second) { return first.x == second.x && first.y == second.y; }), candidates.end());
+        if (candidates.size() < 3)
+        {
+            return {};
+        }
+
+        // lower hull, then upper hull
+        std::vector<Point> hull(2 * candidates.size());
+        size_t numHullPoints = 0;
+        for (const auto& candidate : candidates)
+        {
+            while (numHullPoints >= 2 && IsLeft(hull[numHullPoints - 2], hull[numHullPoints - 1], candidate) <= 0.0)
+            {
+                numHullPoints--;
+            }
+            hull[numHullPoints++] = candidate;
+        }
+        const auto lowerHullSize = numHullPoints + 1;
+        for (auto i = candidates.size() - 1; i > 0; --i)
+        {
+            while (numHullPoints >= lowerHullSize && IsLeft(hull[numHullPoints - 2], hull[numHullPoints - 1], candidates[i - 1]) <= 0.0)
+            {
+                numHullPoints--;
+            }
+            hull[numHullPoints++] = candidates[i - 1];
+        }
+        hull.resize(numHullPoints);
+
+        if (hull.size() < 4)
+        {
+            return {};
+        }
+        return hull;
+    }
+
 } // namespace meshkernel
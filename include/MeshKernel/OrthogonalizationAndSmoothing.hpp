@@ -31,6 +31,7 @@
 #include <vector>
 
 #include <MeshKernel/LandBoundaries.hpp>
+#include <MeshKernel/MemoryUsage.hpp>
 #include <MeshKernelApi/OrthogonalizationParameters.hpp>
 
 namespace meshkernel
@@ -115,6 +116,10 @@ namespace meshkernel
         /// @brief Finalize the outer iteration, computes new mu and face areas, masscenters, circumcenters
         void FinalizeOuterIteration();
 
+        /// @brief Adds the allocations of the linear system, the smoother and the orthogonalizer
+        /// @param[in,out] memoryUsage The memory usage to add to
+        void AccumulateMemoryUsage(MemoryUsage& memoryUsage) const;
+
     private:
         /// @brief Project mesh nodes back to the original mesh boundary (orthonet_project_on_boundary)
         void SnapMeshToOriginalMeshBoundary();
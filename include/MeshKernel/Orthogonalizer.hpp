@@ -28,6 +28,8 @@
 #pragma once
 #include <vector>
 
+#include <MeshKernel/MemoryUsage.hpp>
+
 namespace meshkernel
 {
     class Mesh2D;
@@ -46,6 +48,10 @@ namespace meshkernel
         /// @brief Computes the smoother weights and the right hans side
         void Compute();
 
+        /// @brief Adds the allocations of the orthogonalizer weights
+        /// @param[in,out] memoryUsage The memory usage to add to
+        void AccumulateMemoryUsage(MemoryUsage& memoryUsage) const;
+
         /// @brief Gets the weight for a certain node and connected node
         /// @brief node
         /// @brief connectedNode
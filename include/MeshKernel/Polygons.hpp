@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 #include <MeshKernel/Entities.hpp>
@@ -47,7 +48,9 @@ namespace meshkernel
                  Projection projection);
 
         /// @brief Creates points inside the polygon using triangulation (the edges size determines how many points will be generated)
-        /// @returns The generated points
+        ///
+        /// The polygons are triangulated in parallel. Polygons that are not closed are skipped.
+        /// @returns The generated points, for each closed polygon
         std::vector<std::vector<Point>> ComputePointsInPolygons() const;
 
         /// @brief Refines the polygon edges with additional nodes, from the start to the end index (refinepolygonpart)
@@ -75,6 +78,8 @@ namespace meshkernel
         size_t PolygonIndex(Point point) const;
 
         /// @brief For each point, compute the index of the polygon including it
+        ///
+        /// The polygon bounding boxes are computed once and the points are evaluated in parallel.
         /// @param[in] point The vector of points
         /// @return The index of the polygon including it
         std::vector<size_t> PolygonIndices(const std::vector<Point>& point) const;
@@ -96,6 +101,16 @@ namespace meshkernel
         std::vector<std::vector<size_t>> m_indices; ///< Start-end indices of each polygon in m_nodes
 
     private:
+        /// @brief Computes the bounding box of each polygon
+        /// @return The lower left and upper right corners of each polygon
+        [[nodiscard]] std::vector<std::pair<Point, Point>> ComputeBoundingBoxes() const;
+
+        /// @brief Checks if a point is included in any of the polygons, using precomputed bounding boxes
+        /// @param[in] point The point to check
+        /// @param[in] boundingBoxes The bounding boxes of the polygons, see \ref ComputeBoundingBoxes
+        /// @return The index of a polygon where the point is included or if none has been found, sizetMissingValue
+        [[nodiscard]] size_t PolygonIndex(Point point, const std::vector<std::pair<Point, Point>>& boundingBoxes) const;
+
         /// @brief Computes the perimeter of a closed polygon
         /// @param[in] polygonNodes The polygon nodes to use in the computation
         /// @return perimeter The computed polygon perimeter
@@ -0,0 +1,140 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include <MeshKernel/MemoryUsage.hpp>
+
+namespace meshkernel
+{
+    /// @brief Reports the progress of a long running operation and lets another thread cancel it
+    ///
+    /// A monitor is attached to the thread running the operation with a ProgressMonitorScope.
+    /// The algorithms report their progress at iteration granularity with ProgressMonitor::Report,
+    /// which throws an OperationCancelledError once cancellation has been requested.
+    /// Without a monitor attached to the thread, reporting does nothing.
+    /// A monitor attached while another one is attached is nested in it: cancelling the outer monitor
+    /// cancels the nested one, and the progress reported to the nested monitor is reported to the outer one.
+    /// Once per outer iteration, the algorithms can let the monitor sample their memory usage,
+    /// so that the allocations released before the operation ends are accounted in the largest usage.
+    class ProgressMonitor
+    {
+    public:
+        /// @brief The function called with the progress, a fraction between 0 and 1
+        using Callback = std::function<void(double)>;
+
+        /// @brief The function adding the allocations of the running operation to a memory usage
+        using MemoryUsageAccumulator = std::function<void(MemoryUsage&)>;
+
+        /// @brief Default constructor, without callback
+        ProgressMonitor() = default;
+
+        /// @brief Constructor
+        /// @param[in] callback The function called on each progress report, on the thread running the operation
+        explicit ProgressMonitor(Callback callback);
+
+        ProgressMonitor(const ProgressMonitor&) = delete;
+        ProgressMonitor& operator=(const ProgressMonitor&) = delete;
+
+        /// @brief Requests the monitored operation to stop at its next progress report
+        void RequestCancellation();
+
+        /// @brief Checks if cancellation has been requested, on this monitor or on the monitor it is nested in
+        /// @returns True if cancellation has been requested
+        [[nodiscard]] bool IsCancellationRequested() const;
+
+        /// @brief Gets the last reported progress
+        /// @returns The progress, a fraction between 0 and 1
+        [[nodiscard]] double GetProgress() const;
+
+        /// @brief Enables the sampling of the memory usage of the monitored operation
+        void EnableMemoryUsageSampling();
+
+        /// @brief Gets the largest total memory usage sampled since the sampling was enabled
+        /// @returns The largest total in bytes
+        [[nodiscard]] size_t GetLargestMemoryUsage() const;
+
+        /// @brief Reports the progress of the operation running on this thread
+        ///
+        /// Throws an OperationCancelledError if cancellation has been requested
+        /// @param[in] progress The progress, a fraction between 0 and 1
+        static void Report(double progress);
+
+        /// @brief Reports the progress of the operation running on this thread, without throwing
+        ///
+        /// Used by the algorithms that complete their post-processing before stopping
+        /// @param[in] progress The progress, a fraction between 0 and 1
+        /// @returns False if cancellation has been requested, the progress is then not reported
+        [[nodiscard]] static bool TryReport(double progress);
+
+        /// @brief Stops the operation running on this thread if cancellation has been requested, without reporting progress
+        ///
+        /// Used by nested operations, whose progress is part of the progress of the calling operation
+        static void CheckCancellation();
+
+        /// @brief Samples the memory usage of the operation running on this thread, keeping the largest total
+        ///
+        /// Does nothing unless the attached monitor has memory usage sampling enabled
+        /// @param[in] accumulate The function adding the allocations of the operation, including the mesh it modifies
+        static void SampleMemoryUsage(const MemoryUsageAccumulator& accumulate);
+
+    private:
+        friend class ProgressMonitorScope;
+
+        static thread_local ProgressMonitor* m_current; ///< The monitor attached to the thread
+
+        ProgressMonitor* m_outer = nullptr;                 ///< The monitor this monitor is nested in, while attached
+        std::atomic<bool> m_isCancellationRequested{false}; ///< If cancellation has been requested
+        std::atomic<double> m_progress{0.0};                ///< The last reported progress
+        Callback m_callback;                                ///< The function called on each progress report
+        bool m_isMemoryUsageSampled = false;                ///< If the memory usage is sampled
+        size_t m_largestMemoryUsage = 0;                    ///< The largest sampled total memory usage
+    };
+
+    /// @brief Attaches a progress monitor to the current thread for the lifetime of the scope
+    class ProgressMonitorScope
+    {
+    public:
+        /// @brief Constructor, attaches the monitor, nested in the monitor attached before
+        /// @param[in] progressMonitor The monitor to attach
+        explicit ProgressMonitorScope(ProgressMonitor& progressMonitor);
+
+        /// @brief Destructor, restores the monitor attached before
+        ~ProgressMonitorScope();
+
+        ProgressMonitorScope(const ProgressMonitorScope&) = delete;
+        ProgressMonitorScope& operator=(const ProgressMonitorScope&) = delete;
+
+    private:
+        ProgressMonitor& m_progressMonitor; ///< The attached monitor
+        ProgressMonitor* m_previous;        ///< The monitor attached before
+    };
+
+} // namespace meshkernel
@@ -29,6 +29,7 @@
 
 #include <MeshKernel/Constants.hpp>
 #include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 
 // include boost
 #define BOOST_ALLOW_DEPRECATED_HEADERS
@@ -58,6 +59,8 @@ namespace meshkernel
     /// or a vector of the nearest neighbors (`meshkernel::RTree::NearestNeighbors`).
     /// RTee has a `m_queryCache`, a vector used for collecting all query results
     /// and avoid frequent re-allocations when the number of results changes.
+    /// Because the results are stored in the instance, a tree must not be queried
+    /// concurrently: parallel loops use their own trees.
     class RTree
     {
 
@@ -72,10 +75,12 @@ namespace meshkernel
 
     public:
         /// @brief Builds the tree
-        /// @tparam T Requires IsCoordinate<T>
-        template <typename T>
-        void BuildTree(std::vector<T>& nodes)
+        /// @tparam Nodes A std::vector<T> with T requiring IsCoordinate<T>, or NodeCoordinates
+        template <typename Nodes>
+        void BuildTree(const Nodes& nodes)
         {
+            MESHKERNEL_TIME_SCOPE("RTree::BuildTree");
+
             m_points.reserve(m_points.size());
             m_points.clear();
             m_rtree2D.clear();
@@ -88,6 +93,7 @@ namespace meshkernel
                 }
             }
             m_rtree2D = RTree2D(m_points.begin(), m_points.end());
+            MESHKERNEL_COUNT("RTree::BuildTree points", m_points.size());
         }
 
         /// @brief Determines the nearest neighbors on squared distance
@@ -107,6 +113,15 @@ namespace meshkernel
         /// @param[in] node Node to insert in m_points
         void InsertNode(const Point& node);
 
+        /// @brief Releases the tree, the points and the query caches
+        void Clear();
+
+        /// @brief Gets the bytes allocated by the tree
+        ///
+        /// The tree nodes are accounted by the values they store, their internal overhead is not included
+        /// @returns The allocated bytes
+        [[nodiscard]] size_t GetMemoryUsage() const;
+
         /// @brief Determines size of the RTree
         [[nodiscard]] size_t Size() const { return m_rtree2D.size(); };
 
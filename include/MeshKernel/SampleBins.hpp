@@ -0,0 +1,115 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/MemoryUsage.hpp>
+
+namespace meshkernel
+{
+    /// @brief The aggregated values of the samples inside a bin
+    struct SampleBin
+    {
+        double x = 0.0;      ///< X-coordinate of the samples centroid
+        double y = 0.0;      ///< Y-coordinate of the samples centroid
+        double min = 0.0;    ///< Minimum sample value
+        double max = 0.0;    ///< Maximum sample value
+        double sum = 0.0;    ///< Sum of the sample values
+        double minAbs = 0.0; ///< Minimum absolute sample value
+        size_t count = 0;    ///< Number of samples
+        size_t first = 0;    ///< Position of the first sample in \ref SampleBins::GetSampleIndices
+    };
+
+    /// @brief Aggregates samples on a multi-resolution grid of square bins
+    ///
+    /// The finest level bins the samples on a regular grid, the bins of each next level
+    /// merge 2x2 bins of the previous level. Only non-empty bins are stored, located at the
+    /// centroid of their samples. Samples with missing values are not aggregated.
+    /// The bins are ordered along a Z-order curve, so that the samples of any bin on any level
+    /// are contiguous in the sample indices and can be evaluated individually.
+    /// Queries on a search area use the coarsest level that still has several bins
+    /// across the area, so that the number of candidates does not depend on the sample density.
+    class SampleBins
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] samples The samples to aggregate
+        /// @param[in] finestBinSize The bin size of the finest level (0 to use the average sample spacing)
+        explicit SampleBins(const std::vector<Sample>& samples, double finestBinSize = 0.0);
+
+        /// @brief Gets the number of levels
+        [[nodiscard]] size_t GetNumLevels() const { return m_levels.size(); }
+
+        /// @brief Gets the bin size of a level
+        /// @param[in] level The level
+        /// @returns The bin size
+        [[nodiscard]] double GetBinSize(size_t level) const;
+
+        /// @brief Gets the bins of a level
+        /// @param[in] level The level
+        /// @returns The non-empty bins
+        [[nodiscard]] std::vector<SampleBin>& GetBins(size_t level) { return m_levels[level]; }
+
+        /// @brief Gets the cell of a bin
+        /// @param[in] level The level
+        /// @param[in] bin The bin index on the level
+        /// @returns The lower left and upper right corners of the bin cell
+        [[nodiscard]] std::tuple<Point, Point> GetBinCell(size_t level, size_t bin) const;
+
+        /// @brief Gets the indices of the aggregated samples, sorted by bin
+        /// @returns The sample indices. The samples of a bin start at \ref SampleBin::first
+        [[nodiscard]] const std::vector<size_t>& GetSampleIndices() const { return m_sampleIndices; }
+
+        /// @brief Selects the coarsest level with enough bins across a search area
+        /// @param[in] searchSize The size of the search area
+        /// @returns The level
+        [[nodiscard]] size_t SelectLevel(double searchSize) const;
+
+        /// @brief Adds the allocations of the bins, the bin keys and the sorted sample indices
+        /// @param[in,out] memoryUsage The memory usage to add to
+        void AccumulateMemoryUsage(MemoryUsage& memoryUsage) const;
+
+    private:
+        /// @brief Merges the bins of the last level 2x2 into a new level
+        void AddCoarserLevel();
+
+        static constexpr size_t m_maximumNumberOfLevels = 24;                 ///< Maximum number of levels
+        static constexpr double m_minimumBinsAcrossSearch = 8.0;              ///< Minimum number of bins across a search area
+        static constexpr double m_maximumNumberOfCellsPerAxis = 4294967295.0; ///< Maximum number of finest grid cells per axis (2^32 - 1)
+
+        Point m_origin;                                    ///< The lower left corner of the bin grid
+        double m_finestBinSize = 0.0;                      ///< The bin size of the finest level
+        std::vector<std::vector<SampleBin>> m_levels;      ///< For each level, the non-empty bins
+        std::vector<std::vector<std::uint64_t>> m_binKeys; ///< For each level, the grid cell key of each bin
+        std::vector<size_t> m_sampleIndices;               ///< The indices of the valid samples, sorted by bin
+    };
+} // namespace meshkernel
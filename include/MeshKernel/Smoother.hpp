@@ -30,6 +30,8 @@
 #include <memory>
 #include <vector>
 
+#include <MeshKernel/MemoryUsage.hpp>
+
 namespace meshkernel
 {
     class Mesh2D;
@@ -49,6 +51,10 @@ namespace meshkernel
         /// @brief Computes the smoother weights
         void Compute();
 
+        /// @brief Adds the allocations of the smoother operators and weights
+        /// @param[in,out] memoryUsage The memory usage to add to
+        void AccumulateMemoryUsage(MemoryUsage& memoryUsage) const;
+
         /// @brief Gets the weight for a certain node and connected node
         /// @brief node
         /// @brief connectedNode
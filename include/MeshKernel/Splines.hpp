@@ -91,6 +91,13 @@ namespace meshkernel
                                     double& firstSplineRatio,
                                     double& secondSplineRatio);
 
+        /// @brief Finds the splines that may cross each other, with a single sweep over the bounding boxes of all spline segments
+        ///
+        /// Two splines are reported when the bounding boxes of any of their segments overlap, a necessary condition for
+        /// GetSplinesIntersection to find a crossing. For projections other than cartesian all the splines are reported.
+        /// @returns For each spline, the sorted indices of the other splines it may cross
+        [[nodiscard]] std::vector<std::vector<size_t>> FindCrossingCandidates() const;
+
         /// @brief Computes the spline length in s coordinates (GETDIS)
         /// @brief index The spline index
         /// @brief startIndex Adimensional start spline
@@ -108,6 +115,20 @@ namespace meshkernel
                                              double height = 1.0,
                                              double assignedDelta = -1.0);
 
+        /// @brief Computes the spline length from the start of the spline, sampling at fixed intervals of 0.1
+        ///
+        /// Gives the same result as GetSplineLength with an assigned delta of 0.1, but uses a cached table of the
+        /// cumulative lengths, so only the last partial interval is integrated on each call
+        /// @param[in] index The spline index
+        /// @param[in] endIndex Adimensional end of the spline
+        /// @param[in] accountForCurvature Accounting for curvature
+        /// @param[in] height When accounting for curvature, the height to use
+        /// @returns The computed length
+        [[nodiscard]] double GetSplineLengthFromStart(size_t index,
+                                                      double endIndex,
+                                                      bool accountForCurvature,
+                                                      double height);
+
         /// @brief Compute the points on a spline lying at certain distance
         /// @param[in] index The spline index
         /// @param[in] maximumGridHeight Maximum grid height
@@ -122,6 +143,13 @@ namespace meshkernel
                                        std::vector<Point>& points,
                                        std::vector<double>& adimensionalDistances);
 
+        /// @brief Invalidates the cached arc length table of a spline
+        ///
+        /// Called by the member functions modifying the spline nodes. Must be called after modifying
+        /// m_splineNodes or m_splineDerivatives of a spline directly.
+        /// @param[in] splineIndex The spline index
+        void InvalidateArcLengthTable(size_t splineIndex);
+
         /// @brief Get the number of splines
         /// @return the number of splines
         auto GetNumSplines() const { return m_splineNodes.size(); }
@@ -132,6 +160,45 @@ namespace meshkernel
         Projection m_projection = Projection::cartesian;     ///< The map projection
 
     private:
+        static constexpr double arcLengthTableDelta = 0.1; ///< The adimensional interval between the samples of the arc length tables
+
+        /// @brief The cumulative length of a spline at fixed adimensional intervals
+        struct ArcLengthTable
+        {
+            Projection projection = Projection::cartesian; ///< The projection used for computing the table
+            bool accountForCurvature = false;              ///< If the lengths account for curvature
+            double height = 0.0;                           ///< The height used when accounting for curvature
+            std::vector<double> coordinates;               ///< The adimensional coordinates of the samples
+            std::vector<Point> points;                     ///< The spline points at the samples
+            std::vector<double> lengths;                   ///< The spline length from the start at the samples
+        };
+
+        /// @brief Gets the arc length table of a spline, computing it if not available or computed with other parameters
+        /// @param[in] index The spline index
+        /// @param[in] accountForCurvature Accounting for curvature
+        /// @param[in] height When accounting for curvature, the height to use
+        /// @returns The arc length table
+        const ArcLengthTable& GetArcLengthTable(size_t index, bool accountForCurvature, double height);
+
+        /// @brief Computes the length of a spline segment, accounting for the curvature at its midpoint if requested
+        /// @param[in] index The spline index
+        /// @param[in] leftCoordinate The adimensional coordinate of the left point
+        /// @param[in] rightCoordinate The adimensional coordinate of the right point
+        /// @param[in] leftPoint The left point
+        /// @param[in] rightPoint The right point
+        /// @param[in] accountForCurvature Accounting for curvature
+        /// @param[in] height When accounting for curvature, the height to use
+        /// @returns The segment length
+        double ComputeSegmentLength(size_t index,
+                                    double leftCoordinate,
+                                    double rightCoordinate,
+                                    const Point& leftPoint,
+                                    const Point& rightPoint,
+                                    bool accountForCurvature,
+                                    double height);
+
+        std::vector<ArcLengthTable> m_arcLengthTables; ///< The cached arc length tables, one for each spline
+
         /// @brief Adds a new corner point in an existing spline
         /// @param[in] splineIndex The spline index
         /// @param[in] point The point to add
@@ -182,7 +249,7 @@ namespace meshkernel
         /// @brief This is the function we want to find the root of
         double operator()(double adimensionalDistanceReferencePoint)
         {
-            double distanceFromReferencePoint = m_spline->GetSplineLength(m_splineIndex, 0.0, adimensionalDistanceReferencePoint, m_numSamples, m_isSpacingCurvatureAdapted, m_h, 0.1);
+            double distanceFromReferencePoint = m_spline->GetSplineLengthFromStart(m_splineIndex, adimensionalDistanceReferencePoint, m_isSpacingCurvatureAdapted, m_h);
             distanceFromReferencePoint = std::abs(distanceFromReferencePoint - m_DimensionalDistance);
             return distanceFromReferencePoint;
         }
@@ -191,7 +258,6 @@ namespace meshkernel
         size_t m_splineIndex;               ///< Spline index
         bool m_isSpacingCurvatureAdapted;   ///< Is spacing curvature adapted
         double m_h;                         ///< When accounting for curvature, the height to use
-        size_t m_numSamples = 10;           ///< Number of samples
         double m_DimensionalDistance = 0.0; ///< Dimensional distance
     };
 
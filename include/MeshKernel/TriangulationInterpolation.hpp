@@ -27,8 +27,10 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 
+#include <MeshKernel/Constants.hpp>
 #include <MeshKernel/Entities.hpp>
 
 namespace meshkernel
@@ -71,6 +73,16 @@ namespace meshkernel
     /// (\ref IsPointInPolygonNodes, \ref AreSegmentsCrossing). Therefore, the algorithm is
     /// independent of the implementation details that occur at the level of the
     /// geometrical functions.
+    ///
+    /// Sample sets larger than the maximum number of samples per tile are
+    /// partitioned in overlapping \ref TriangulationTiles, which are
+    /// triangulated and interpolated in parallel. Each location is
+    /// interpolated in the single tile whose core contains it, if the triangle
+    /// containing it is also a triangle of the triangulation of all samples
+    /// (\ref TriangulationTiles::IsTriangleInTile). The locations inside the
+    /// convex hull of the samples that are not interpolated, in sparse areas or
+    /// along the hull, are interpolated again with a larger tile overlap, until
+    /// the tiles hold all samples. This reproduces the single triangulation.
     class TriangulationInterpolation
     {
 
@@ -79,9 +91,11 @@ namespace meshkernel
         /// @param[in] locations interpolation points (where the values should be computed)
         /// @param[in] samples  Values to use for the interpolation
         /// @param[in] projection Projection to use (\ref Projection)
+        /// @param[in] maximumSamplesPerTile Larger sample sets are triangulated in tiles (0 to always use a single triangulation)
         TriangulationInterpolation(const std::vector<Point>& locations,
                                    const std::vector<Sample>& samples,
-                                   Projection projection);
+                                   Projection projection,
+                                   size_t maximumSamplesPerTile = maximumNumberOfPointsPerTriangulationTile);
 
         /// @brief Compute results on the interpolation points
         void Compute();
@@ -94,9 +108,22 @@ namespace meshkernel
         }
 
     private:
+        /// @brief Partitions the samples in tiles and interpolates each tile in parallel
+        void ComputeInTiles();
+
+        /// @brief Triangulates samples and interpolates the selected locations
+        /// @param[in] samples The samples to triangulate
+        /// @param[in] locationIndices The indices of the locations to interpolate
+        /// @param[in] isTriangleAccepted Checks if a triangle can be used to interpolate, from its closed polygon
+        /// @returns The number of triangles
+        size_t Interpolate(const std::vector<Sample>& samples,
+                           const std::vector<size_t>& locationIndices,
+                           const std::function<bool(const std::vector<Point>&)>& isTriangleAccepted);
+
         const std::vector<Point>& m_locations; ///< Locations
         const std::vector<Sample>& m_samples;  ///< Samples
         Projection m_projection;               ///< Projection
+        size_t m_maximumSamplesPerTile;        ///< Larger sample sets are triangulated in tiles
         std::vector<double> m_results;         ///< Results
     };
 
@@ -0,0 +1,128 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include <MeshKernel/Constants.hpp>
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Operations.hpp>
+
+namespace meshkernel
+{
+    /// @brief Partitions a large point set in rectangular tiles, so it can be triangulated tile by tile
+    ///
+    /// The bounding box of the points is divided in a regular grid of tiles, each holding about
+    /// the requested maximum number of points. A tile core is the grid cell, each location belongs
+    /// to exactly one core. The points of a tile are those inside its core enlarged by an overlap
+    /// margin on all sides.
+    ///
+    /// A triangle of the Delaunay triangulation of the tile points is also a triangle of the
+    /// Delaunay triangulation of all points when its circumcircle, clipped to the bounding box of
+    /// all points, lies inside the enlarged tile: no point outside the tile can then be inside the
+    /// circumcircle (\ref IsTriangleInTile). Other triangles, for example in sparse areas or along the
+    /// convex hull, can differ from the triangulation of all points and must be computed otherwise,
+    /// for example with a larger overlap. For points in general position, with no four points on a
+    /// circle, the Delaunay triangulation is unique.
+    class TriangulationTiles
+    {
+    public:
+        /// @brief Constructor
+        /// @tparam T A type that contains x and y fields
+        /// @param[in] points The points to partition
+        /// @param[in] maximumPointsPerTile The target number of points in each tile core
+        /// @param[in] overlap The overlap margin as a fraction of the tile size
+        /// @param[in] isTileSelected For each tile, if its points are collected (all tiles if empty)
+        template <typename T>
+        TriangulationTiles(const std::vector<T>& points,
+                           size_t maximumPointsPerTile,
+                           double overlap = triangulationTileOverlap,
+                           const std::vector<bool>& isTileSelected = {})
+        {
+            const auto [lowerLeft, upperRight] = GetBoundingBox(points);
+            SetTiles(lowerLeft, upperRight, points.size(), maximumPointsPerTile, overlap, isTileSelected);
+            for (size_t i = 0; i < points.size(); ++i)
+            {
+                if (points[i].IsValid())
+                {
+                    AssignPoint(i, points[i].x, points[i].y);
+                }
+            }
+        }
+
+        /// @brief Gets the number of tiles
+        /// @returns The number of tiles
+        [[nodiscard]] size_t GetNumTiles() const { return m_tilePoints.size(); }
+
+        /// @brief Gets the indices of the points in a tile, including its overlap margin
+        /// @param[in] tile The tile index
+        /// @returns The point indices, in ascending order
+        [[nodiscard]] const std::vector<size_t>& GetTilePoints(size_t tile) const { return m_tilePoints[tile]; }
+
+        /// @brief Gets the tile whose core contains a location
+        /// @param[in] location The location
+        /// @returns The tile index, locations outside the bounding box are assigned to the closest tile
+        [[nodiscard]] size_t GetTile(const Point& location) const;
+
+        /// @brief Checks if a triangle of the tile triangulation is a triangle of the triangulation of all points
+        /// @param[in] tile The tile index
+        /// @param[in] firstNode The first triangle node
+        /// @param[in] secondNode The second triangle node
+        /// @param[in] thirdNode The third triangle node
+        /// @returns True if the triangle circumcircle, clipped to the bounding box of all points, lies inside the enlarged tile
+        [[nodiscard]] bool IsTriangleInTile(size_t tile, const Point& firstNode, const Point& secondNode, const Point& thirdNode) const;
+
+        /// @brief Checks if the overlap margin is so large that each tile holds all points
+        /// @returns True if the tile triangulations are the triangulation of all points
+        [[nodiscard]] bool IsOverlapCoveringAllPoints() const;
+
+    private:
+        /// @brief Sets up the tile grid over the bounding box of the points
+        void SetTiles(const Point& lowerLeft,
+                      const Point& upperRight,
+                      size_t numPoints,
+                      size_t maximumPointsPerTile,
+                      double overlap,
+                      const std::vector<bool>& isTileSelected);
+
+        /// @brief Adds a point to all selected tiles whose enlarged core contains it
+        void AssignPoint(size_t index, double x, double y);
+
+        Point m_lowerLeft;                             ///< The lower left corner of the tile grid
+        Point m_upperRight;                            ///< The upper right corner of the tile grid
+        size_t m_numTilesX = 1;                        ///< The number of tiles in x direction
+        size_t m_numTilesY = 1;                        ///< The number of tiles in y direction
+        double m_tileWidth = 0.0;                      ///< The width of a tile core
+        double m_tileHeight = 0.0;                     ///< The height of a tile core
+        double m_marginX = 0.0;                        ///< The overlap margin in x direction
+        double m_marginY = 0.0;                        ///< The overlap margin in y direction
+        std::vector<std::vector<size_t>> m_tilePoints; ///< For each tile, the indices of its points
+        std::vector<bool> m_isTileSelected;            ///< For each tile, if its points are collected
+        std::vector<size_t> m_selectedTiles;           ///< The indices of the selected tiles
+    };
+} // namespace meshkernel
@@ -33,10 +33,13 @@ namespace meshkernel
 {
     extern "C"
     {
-        /// @brief Function of the Triangle library
+        /// @brief Function of the Triangle library, triangulates once and hands over the output buffers
         ///
         /// \see https://www.cs.cmu.edu/~quake/triangle.html
-        void Triangulation(int* jatri, double* xs, double* ys, int* ns, int* indx, int* numtri, int* edgeidx, int* numedge, int* triedge, double* xs3, double* ys3, int* ns3, double* trisize);
+        void TriangulateOnce(int jatri, double* xy, int ns, double trisize, int* numtri, int** trianglelist, int* numedge, int** edgelist, int** neighborlist, int* numpoints, double** pointlist);
+
+        /// @brief Releases the buffers returned by TriangulateOnce
+        void FreeTriangulation(int* trianglelist, int* edgelist, int* neighborlist, double* pointlist);
     }
 
     struct Point;
@@ -54,149 +57,73 @@ namespace meshkernel
             TriangulatePointsAndGenerateFaces = 3 ///< generate Delaunay triangulation from input nodes with m_faceEdges and m_edgeNodes
         };
 
-        std::vector<Point> m_nodes;                    ///< Nodes
-        std::vector<std::vector<size_t>> m_faceNodes;  ///< Face nodes
-        std::vector<std::vector<size_t>> m_faceEdges;  ///< Face edges
-        std::vector<std::vector<size_t>> m_edgeNodes;  ///< Edge nodes
-        std::vector<std::vector<size_t>> m_edgesFaces; ///< Edge faces
+        std::vector<Point> m_nodes;       ///< Nodes
+        std::vector<size_t> m_faceNodes;  ///< Face nodes, three per face
+        std::vector<size_t> m_faceEdges;  ///< Face edges, three per face in ascending order
+        std::vector<size_t> m_edgeNodes;  ///< Edge nodes, two per edge
+        std::vector<size_t> m_edgesFaces; ///< Edge faces, two per edge (the second is sizetMissingValue on the boundary)
 
-        size_t m_numEdges; ///< Number of edges
-        size_t m_numNodes; ///< Number of nodes
-        size_t m_numFaces; ///< Number of faces
+        size_t m_numEdges = 0; ///< Number of edges
+        size_t m_numNodes = 0; ///< Number of nodes
+        size_t m_numFaces = 0; ///< Number of faces
 
-        /// @brief
+        /// @brief Computes the triangulation in a single pass, sizing all outputs from the Triangle results
         /// @tparam T A type that contains x and y fields
         /// @param inputNodes The number of input points
         /// @param triangulationOption Triangulation option, see \ref TriangulationOptions
         /// @param averageTriangleArea An estimation of the average area of triangles (required for option 2)
-        /// @param estimatedNumberOfTriangles An estimation of the average number of triangles (required for option 2)
         template <typename T>
         void Compute(const std::vector<T>& inputNodes,
                      TriangulationOptions triangulationOption,
-                     double averageTriangleArea,
-                     size_t estimatedNumberOfTriangles)
+                     double averageTriangleArea)
         {
-            // TODO: move implementation to source files as soon as we can use modules (c++20)
-
-            std::vector<double> xLocalPolygon(inputNodes.size());
-            std::vector<double> yLocalPolygon(inputNodes.size());
-            for (auto i = 0; i < inputNodes.size(); ++i)
-            {
-                xLocalPolygon[i] = inputNodes[i].x;
-                yLocalPolygon[i] = inputNodes[i].y;
-            }
-
-            int numFaces = -1;
-            int numEdges = 0;
-            int numNodes = 0;
-
-            int numInputNodes = triangulationOption == TriangulationOptions::TriangulatePointsAndGenerateFaces ? static_cast<int>(inputNodes.size()) : static_cast<int>(inputNodes.size() - 1);
-            auto intTriangulationOption = static_cast<int>(triangulationOption);
-
-            std::vector<int> faceNodesFlat;
-            std::vector<int> edgeNodesFlat;
-            std::vector<int> faceEdgesFlat;
-            std::vector<double> xNodesFlat;
-            std::vector<double> yNodesFlat;
-
-            if (estimatedNumberOfTriangles == 0)
-            {
-                estimatedNumberOfTriangles = inputNodes.size() * 6 + 10;
-            }
-
-            // If the number of estimated triangles is not sufficient, triangulation must be repeated
-            while (numFaces < 0)
-            {
-                numFaces = estimatedNumberOfTriangles;
-                faceNodesFlat.resize(numFaces * 3);
-                edgeNodesFlat.resize(numFaces * 2);
-                faceEdgesFlat.resize(numFaces * 3);
-                xNodesFlat.resize(numFaces * 3, doubleMissingValue);
-                yNodesFlat.resize(numFaces * 3, doubleMissingValue);
-                Triangulation(&intTriangulationOption,
-                              &xLocalPolygon[0],
-                              &yLocalPolygon[0],
-                              &numInputNodes,
-                              &faceNodesFlat[0], // INDX
-                              &numFaces,
-                              &edgeNodesFlat[0], // EDGEINDX
-                              &numEdges,
-                              &faceEdgesFlat[0], // TRIEDGE
-                              &xNodesFlat[0],
-                              &yNodesFlat[0],
-                              &numNodes,
-                              &averageTriangleArea);
-                if (estimatedNumberOfTriangles > 0)
-                {
-                    estimatedNumberOfTriangles = -numFaces;
-                }
-            }
-
-            m_numFaces = numFaces <= 0 ? static_cast<size_t>(0) : static_cast<size_t>(numFaces);
-            m_numEdges = static_cast<size_t>(numEdges);
-            m_numNodes = static_cast<size_t>(numNodes);
+            // for options 1 and 2 the last node closes the polygon and is not passed to Triangle
+            const auto numInputNodes = triangulationOption == TriangulationOptions::TriangulatePointsAndGenerateFaces || inputNodes.empty() ? inputNodes.size() : inputNodes.size() - 1;
 
-            // Create nodes
-            m_nodes.resize(m_numNodes);
-            for (auto i = 0; i < m_numNodes; ++i)
+            std::vector<double> coordinates(2 * numInputNodes);
+            for (size_t i = 0; i < numInputNodes; ++i)
             {
-                m_nodes[i] = {xNodesFlat[i], yNodesFlat[i]};
+                coordinates[2 * i] = inputNodes[i].x;
+                coordinates[2 * i + 1] = inputNodes[i].y;
             }
 
-            // Create m_faceNodes
-            m_faceNodes.resize(m_numFaces, std::vector<size_t>(3, sizetMissingValue));
-            m_faceEdges.resize(m_numFaces, std::vector<size_t>(3, sizetMissingValue));
-            size_t faceCounter = 0;
-            for (auto f = 0; f < m_numFaces; ++f)
-            {
-                m_faceNodes[f][0] = static_cast<size_t>(faceNodesFlat[faceCounter] - 1);
-                m_faceEdges[f][0] = static_cast<size_t>(faceEdgesFlat[faceCounter] - 1);
-                faceCounter++;
-                m_faceNodes[f][1] = static_cast<size_t>(faceNodesFlat[faceCounter] - 1);
-                m_faceEdges[f][1] = static_cast<size_t>(faceEdgesFlat[faceCounter] - 1);
-                faceCounter++;
-                m_faceNodes[f][2] = static_cast<size_t>(faceNodesFlat[faceCounter] - 1);
-                m_faceEdges[f][2] = static_cast<size_t>(faceEdgesFlat[faceCounter] - 1);
-                faceCounter++;
-            }
-
-            // Create edges
-            if (m_numEdges == 0)
-            {
-                return;
-            }
-
-            m_edgeNodes.resize(m_numEdges, std::vector<size_t>(2, sizetMissingValue));
-            size_t edgeCounter = 0;
-            for (auto e = 0; e < m_numEdges; ++e)
-            {
-                m_edgeNodes[e][0] = static_cast<size_t>(edgeNodesFlat[edgeCounter] - 1);
-                edgeCounter++;
-                m_edgeNodes[e][1] = static_cast<size_t>(edgeNodesFlat[edgeCounter] - 1);
-                edgeCounter++;
-            }
-
-            m_edgesFaces.resize(m_numEdges, std::vector<size_t>(2, sizetMissingValue));
-            edgeCounter = 0;
-            for (auto f = 0; f < m_numFaces; ++f)
-            {
-
-                for (auto n = 0; n < numNodesInTriangle; ++n)
-                {
-                    auto const edge = static_cast<size_t>(faceEdgesFlat[edgeCounter] - 1);
-                    edgeCounter++;
-                    // For each edge, the shared face index
-                    if (m_edgesFaces[edge][0] == sizetMissingValue)
-                    {
-                        m_edgesFaces[edge][0] = f;
-                    }
-                    else
-                    {
-                        m_edgesFaces[edge][1] = f;
-                    }
-                }
-            }
+            ComputeFromCoordinates(coordinates, numInputNodes, triangulationOption, averageTriangleArea);
         }
+
+        /// @brief Gets the n-th node of a face
+        /// @param[in] face The face index
+        /// @param[in] n The local node index (0, 1 or 2)
+        /// @returns The node index
+        [[nodiscard]] size_t GetFaceNode(size_t face, size_t n) const { return m_faceNodes[3 * face + n]; }
+
+        /// @brief Gets the n-th edge of a face
+        /// @param[in] face The face index
+        /// @param[in] n The local edge index (0, 1 or 2)
+        /// @returns The edge index
+        [[nodiscard]] size_t GetFaceEdge(size_t face, size_t n) const { return m_faceEdges[3 * face + n]; }
+
+        /// @brief Gets the n-th node of an edge
+        /// @param[in] edge The edge index
+        /// @param[in] n The local node index (0 or 1)
+        /// @returns The node index
+        [[nodiscard]] size_t GetEdgeNode(size_t edge, size_t n) const { return m_edgeNodes[2 * edge + n]; }
+
+        /// @brief Gets the n-th face sharing an edge
+        /// @param[in] edge The edge index
+        /// @param[in] n The local face index (0 or 1)
+        /// @returns The face index, sizetMissingValue if the edge has no such face
+        [[nodiscard]] size_t GetEdgeFace(size_t edge, size_t n) const { return m_edgesFaces[2 * edge + n]; }
+
+    private:
+        /// @brief Triangulates the interleaved coordinates and converts the Triangle output
+        /// @param[in] coordinates The interleaved x and y coordinates
+        /// @param[in] numInputNodes The number of input nodes
+        /// @param[in] triangulationOption Triangulation option, see \ref TriangulationOptions
+        /// @param[in] averageTriangleArea An estimation of the average area of triangles (required for option 2)
+        void ComputeFromCoordinates(std::vector<double>& coordinates,
+                                    size_t numInputNodes,
+                                    TriangulationOptions triangulationOption,
+                                    double averageTriangleArea);
     };
 
 } // namespace meshkernel
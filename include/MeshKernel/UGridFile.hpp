@@ -0,0 +1,135 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/NodeCoordinates.hpp>
+
+namespace meshkernel
+{
+    // Forward declarations
+    class Mesh1D;
+    class Mesh2D;
+
+    /// @brief A class for reading and writing meshes from and to UGRID-conformant NetCDF files.
+    ///
+    /// The NetCDF C library is loaded at run time (netcdf.dll on Windows, libnetcdf.so elsewhere),
+    /// so no NetCDF development files are required to build the library.
+    ///
+    /// Reading follows the UGRID conventions: the topology variable is located by its
+    /// cf_role = "mesh_topology" and topology_dimension attributes, and the node coordinates
+    /// and edge connectivity are found from the attributes of the topology variable.
+    /// Files in the legacy format (nNetNode, nNetLink, NetNode_x, NetNode_y and NetLink) are also supported.
+    ///
+    /// Node coordinates are read and written in chunks of hyperslabs straight from and to the
+    /// coordinate arrays of the mesh. Edge and face connectivities are converted through buffers
+    /// of at most one chunk, so no additional copy of the whole mesh is allocated.
+    class UGridFile
+    {
+    public:
+        /// @brief The file access mode
+        enum class AccessMode
+        {
+            Read,
+            Write
+        };
+
+        /// @brief Opens an existing file for reading or creates a new file for writing
+        /// @param[in] filePath The path of the file
+        /// @param[in] accessMode Whether to read from the file or to (over)write it
+        UGridFile(const std::string& filePath, AccessMode accessMode);
+
+        UGridFile(const UGridFile&) = delete;
+        UGridFile& operator=(const UGridFile&) = delete;
+
+        /// @brief Closes the file
+        ~UGridFile();
+
+        /// @brief Reads the nodes and edges of the 1d or 2d mesh topology, with 0-based edge indices
+        /// @param[in] topologyDimension 1 for a mesh1d, 2 for a mesh2d
+        /// @param[out] nodes The mesh nodes
+        /// @param[out] edges The mesh edges
+        void ReadNodesAndEdges(int topologyDimension, NodeCoordinates& nodes, std::vector<Edge>& edges) const;
+
+        /// @brief Reads the mesh2d topology and administrates it
+        /// @param[in] projection The projection of the mesh
+        /// @returns The mesh2d
+        [[nodiscard]] std::shared_ptr<Mesh2D> ReadMesh2D(Projection projection) const;
+
+        /// @brief Reads the mesh1d topology
+        /// @param[in] projection The projection of the mesh
+        /// @returns The mesh1d
+        [[nodiscard]] std::shared_ptr<Mesh1D> ReadMesh1D(Projection projection) const;
+
+        /// @brief Writes a mesh2d topology, including the face node connectivity
+        /// @param[in] mesh The mesh to write
+        void WriteMesh2D(const Mesh2D& mesh);
+
+        /// @brief Writes a mesh1d topology
+        /// @param[in] mesh The mesh to write
+        void WriteMesh1D(const Mesh1D& mesh);
+
+    private:
+        /// @brief Finds the variable describing the mesh topology with the given dimension
+        /// @param[in] topologyDimension The topology dimension (1 or 2)
+        /// @returns The variable id, or -1 if the file does not contain such a topology
+        [[nodiscard]] int FindTopologyVariable(int topologyDimension) const;
+
+        /// @brief Gets the length of the first dimension of a variable
+        [[nodiscard]] size_t GetFirstDimensionLength(int varId) const;
+
+        /// @brief Reads a text attribute
+        [[nodiscard]] std::string GetTextAttribute(int varId, const std::string& attributeName) const;
+
+        /// @brief Reads the node coordinates into the coordinate arrays of the nodes
+        void ReadNodes(int xVarId, int yVarId, NodeCoordinates& nodes) const;
+
+        /// @brief Reads the edge nodes into the edges vector and converts them to 0-based indexing
+        ///
+        /// Node indices equal to the _FillValue of the variable or below the start index become missing nodes.
+        void ReadEdges(int varId, size_t startIndex, std::vector<Edge>& edges) const;
+
+        /// @brief Defines the topology variable, the node coordinates and the edge connectivity and writes them
+        /// @param[in] meshName The name of the topology variable (mesh1d or mesh2d)
+        /// @param[in] topologyDimension The topology dimension (1 or 2)
+        /// @param[in] nodes The mesh nodes
+        /// @param[in] edges The mesh edges
+        /// @param[in] faceNodes The face nodes, only written for a topology of dimension 2
+        void WriteTopology(const std::string& meshName,
+                           int topologyDimension,
+                           const NodeCoordinates& nodes,
+                           const std::vector<Edge>& edges,
+                           const std::vector<std::vector<size_t>>& faceNodes);
+
+        int m_ncId = -1;           ///< The NetCDF file id
+        bool m_isWritable = false; ///< Whether the file has been opened for writing
+    };
+} // namespace meshkernel
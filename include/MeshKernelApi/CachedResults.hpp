@@ -0,0 +1,137 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Instrumentation.hpp>
+#include <MeshKernel/Polygons.hpp>
+
+namespace meshkernelapi
+{
+    /// @brief Compares the coordinates of two polygons exactly
+    /// @param[in] first The first polygon
+    /// @param[in] second The second polygon
+    /// @returns True if the polygons have the same nodes
+    inline bool IsSamePolygon(const std::vector<meshkernel::Point>& first, const std::vector<meshkernel::Point>& second)
+    {
+        const auto isSamePoint = [](const meshkernel::Point& firstPoint, const meshkernel::Point& secondPoint) { return firstPoint.x == secondPoint.x && firstPoint.y == secondPoint.y; };
+        return std::equal(first.begin(), first.end(), second.begin(), second.end(), isSamePoint);
+    }
+
+    /// @brief The nodes selected by the last node-in-polygons query, shared by the count and the get calls
+    struct NodeSelection
+    {
+        /// @brief Selects the nodes in a polygon, reusing the last selection if neither the polygon nor the mesh changed
+        /// @tparam Select A callable computing the selected node indices from the polygon and the side
+        /// @param[in] polygon The selection polygon
+        /// @param[in] inside Whether the nodes inside or outside the polygon are selected
+        /// @param[in] meshVersion The current version of the mesh
+        /// @param[in] select The selection, called only if the last one cannot be reused
+        /// @returns The indices of the selected nodes
+        template <typename Select>
+        const std::vector<int>& Compute(std::vector<meshkernel::Point> polygon, bool inside, size_t meshVersion, Select select)
+        {
+            if (m_meshVersion == meshVersion && m_inside == inside && IsSamePolygon(m_polygon, polygon))
+            {
+                MESHKERNEL_COUNT("Node selection reuses", 1);
+                return m_selectedNodes;
+            }
+
+            m_selectedNodes = select(polygon, inside);
+            m_polygon = std::move(polygon);
+            m_inside = inside;
+            m_meshVersion = meshVersion;
+            return m_selectedNodes;
+        }
+
+        std::vector<meshkernel::Point> m_polygon;                  ///< The selection polygon
+        bool m_inside = true;                                      ///< Whether the nodes inside or outside the polygon are selected
+        size_t m_meshVersion = std::numeric_limits<size_t>::max(); ///< The mesh version at the time of the selection
+        std::vector<int> m_selectedNodes;                          ///< The indices of the selected nodes
+    };
+
+    /// @brief The parameters identifying a polygon offset or refinement
+    struct PolygonOperationParameters
+    {
+        /// @brief The polygon operations
+        enum class Type
+        {
+            None,
+            Refinement,
+            Offset
+        };
+
+        Type m_type = Type::None;                                                ///< The operation
+        meshkernel::Projection m_projection = meshkernel::Projection::cartesian; ///< The projection of the polygon
+        int m_firstIndex = 0;                                                    ///< The first refined node index
+        int m_secondIndex = 0;                                                   ///< The last refined node index
+        bool m_innerPolygon = false;                                             ///< Whether the offset is inwards
+        double m_distance = 0.0;                                                 ///< The refinement or offset distance
+
+        /// @brief Compares the parameters of two operations
+        bool operator==(const PolygonOperationParameters& other) const
+        {
+            return m_type == other.m_type && m_projection == other.m_projection && m_firstIndex == other.m_firstIndex &&
+                   m_secondIndex == other.m_secondIndex && m_innerPolygon == other.m_innerPolygon && m_distance == other.m_distance;
+        }
+    };
+
+    /// @brief The result of the last polygon offset or refinement, shared by the count and the get calls
+    struct PolygonOperation
+    {
+        /// @brief Computes a polygon operation, reusing the last result if neither the polygon nor the parameters changed
+        /// @tparam Operation A callable computing the resulting polygon from a meshkernel::Polygons
+        /// @param[in] polygon The input polygon
+        /// @param[in] parameters The operation and its parameters
+        /// @param[in] operation The operation, called only if the last result cannot be reused
+        /// @returns The resulting polygon
+        template <typename Operation>
+        const std::vector<meshkernel::Point>& Compute(std::vector<meshkernel::Point> polygon, const PolygonOperationParameters& parameters, Operation operation)
+        {
+            if (m_parameters == parameters && IsSamePolygon(m_polygon, polygon))
+            {
+                MESHKERNEL_COUNT("Polygon operation reuses", 1);
+                return m_result;
+            }
+
+            m_result = operation(meshkernel::Polygons(polygon, parameters.m_projection));
+            m_polygon = std::move(polygon);
+            m_parameters = parameters;
+            return m_result;
+        }
+
+        std::vector<meshkernel::Point> m_polygon; ///< The input polygon
+        PolygonOperationParameters m_parameters;  ///< The operation and its parameters
+        std::vector<meshkernel::Point> m_result;  ///< The resulting polygon
+    };
+} // namespace meshkernelapi
@@ -0,0 +1,149 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
+
+namespace meshkernelapi
+{
+    /// @brief The outcome of an asynchronous job
+    struct JobResult
+    {
+        int m_exitCode = 0;                                                             ///< The exit code of the operation
+        std::string m_errorMessage;                                                     ///< The error message, if the operation failed
+        meshkernel::MeshGeometryError m_geometryError = meshkernel::MeshGeometryError(); ///< The geometry error, if the geometry was invalid
+    };
+
+    /// @brief A pool of worker threads running the asynchronous jobs of the API
+    ///
+    /// Jobs are identified by an id. A job is queued, then running, and either completed or cancelled.
+    /// Each job runs with its own progress monitor attached, running jobs are cancelled through it.
+    /// Waiting for a job releases it, its id becomes invalid.
+    /// Each job belongs to a strand: the jobs of a strand run one at a time, in the order they were submitted,
+    /// while the jobs of different strands run concurrently.
+    class JobPool
+    {
+    public:
+        /// @brief The status of a job
+        enum class Status
+        {
+            Queued = 0,
+            Running = 1,
+            Completed = 2,
+            Cancelled = 3
+        };
+
+        /// @brief The operation executed by a job
+        using Operation = std::function<JobResult()>;
+
+        /// @brief Constructor, starts the workers
+        /// @param[in] numWorkers The number of worker threads
+        explicit JobPool(size_t numWorkers);
+
+        /// @brief Destructor, lets the workers finish the queued jobs and stops them
+        ~JobPool();
+
+        JobPool(const JobPool&) = delete;
+        JobPool& operator=(const JobPool&) = delete;
+
+        /// @brief Queues an operation
+        /// @param[in] strand The strand of the job, for example the id of the state the operation modifies
+        /// @param[in] operation The operation to execute
+        /// @returns The job id
+        [[nodiscard]] int Submit(int strand, Operation operation);
+
+        /// @brief Gets the status of a job
+        /// @param[in] jobId The job id
+        /// @returns The job status
+        [[nodiscard]] Status GetStatus(int jobId) const;
+
+        /// @brief Gets the progress of a job
+        /// @param[in] jobId The job id
+        /// @returns The last progress reported by the operation, a fraction between 0 and 1
+        [[nodiscard]] double GetProgress(int jobId) const;
+
+        /// @brief Cancels a job
+        ///
+        /// A queued job is cancelled immediately, a running job stops at the next progress report of its operation
+        /// @param[in] jobId The job id
+        /// @returns True if the cancellation was requested, false if the job was already finished
+        bool Cancel(int jobId);
+
+        /// @brief Waits until a job is completed or cancelled and releases it
+        /// @param[in] jobId The job id
+        /// @param[out] status The final status of the job
+        /// @returns The outcome of the job
+        [[nodiscard]] JobResult Wait(int jobId, Status& status);
+
+    private:
+        /// @brief A queued, running or finished job
+        struct Job
+        {
+            Operation m_operation;                         ///< The operation to execute
+            int m_strand = 0;                              ///< The strand of the job
+            Status m_status = Status::Queued;              ///< The job status
+            JobResult m_result;                            ///< The outcome, once completed
+            meshkernel::ProgressMonitor m_progressMonitor; ///< The monitor attached while the operation runs
+        };
+
+        /// @brief The loop executed by each worker
+        void Work();
+
+        /// @brief Finds the first queued job whose strand is not running, drops the cancelled jobs on the way
+        /// @returns The position of the job in the queue, the end of the queue if no job can start
+        [[nodiscard]] std::deque<int>::iterator FindNextJob();
+
+        /// @brief Finds a job, throws if it does not exist
+        /// @param[in] jobId The job id
+        /// @returns The job
+        [[nodiscard]] std::shared_ptr<Job> FindJob(int jobId) const;
+
+        mutable std::mutex m_mutex;                 ///< Guards the jobs and the queue
+        std::condition_variable m_queueChanged;     ///< Signals new jobs and the pool stopping
+        std::condition_variable m_jobFinished;      ///< Signals a job completed or cancelled
+        std::map<int, std::shared_ptr<Job>> m_jobs; ///< The jobs not released yet, by id
+        std::deque<int> m_queue;                    ///< The ids of the queued jobs, in submission order
+        std::set<int> m_runningStrands;             ///< The strands with a running job
+        int m_nextJobId = 0;                        ///< The id of the next job
+        bool m_isStopping = false;                  ///< If the workers should stop
+        std::vector<std::thread> m_workers;         ///< The worker threads
+    };
+
+} // namespace meshkernelapi
@@ -62,7 +62,9 @@ namespace meshkernelapi
     {
 #endif
         /// @brief Creates a new mesh state and returns the generated \p meshKernelId
-
+        ///
+        /// The lowest free id is used, the ids of existing states never change. Calls on different states can run concurrently,
+        /// calls on the same state are serialized
         /// @param[out] meshKernelId Identifier for the created grid state
         /// @returns Error code
         MKERNEL_API int mkernel_new_mesh(int& meshKernelId);
@@ -81,6 +83,10 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_delete_mesh(int meshKernelId, const GeometryList& disposableGeometryList, int deletionOption, bool invertDeletion);
 
         /// @brief Sets the grid state
+        ///
+        /// The node coordinate arrays are copied once, straight into the coordinate arrays of the mesh, and the edge nodes
+        /// are converted once to index pairs. The client buffers are not adopted: the mesh kernel grows and compacts
+        /// its arrays when the mesh is modified, which memory allocated and freed by the client does not allow.
         /// @param[in] meshKernelId Id of the grid state
         /// @param[in] meshGeometryDimensions Mesh2D dimensions
         /// @param[in] meshGeometry Mesh2D data
@@ -89,6 +95,16 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_set_state(int meshKernelId, const MeshGeometryDimensions& meshGeometryDimensions, const MeshGeometry& meshGeometry, bool isGeographic);
 
         /// @brief Gets the mesh state as a <see cref="MeshGeometry"/> structure
+        ///
+        /// The node coordinates address the coordinate arrays of the mesh itself, the other pointers address flat copies
+        /// owned by the mesh kernel. The first call after a modification administrates the mesh and refreshes the copies;
+        /// further calls return the same buffers without copying, until the mesh is modified again.
+        ///
+        /// The buffers are owned by the mesh kernel and are read-only. They stay valid until the next call that modifies the mesh
+        /// of this instance (inserting, deleting, moving or merging nodes and edges, refining, administrating or compacting the mesh,
+        /// \ref mkernel_set_state), \ref mkernel_shrink_mesh or \ref mkernel_deallocate_state: these calls can reallocate or release the arrays.
+        /// Writing through the pointers modifies the mesh without incrementing its version, so the results cached for the unmodified
+        /// mesh (flat copies, node selections) become stale. Modify the mesh through \ref mkernel_set_state or the editing calls instead.
         /// @param[in] meshKernelId Id of the grid state
         /// @param[out] meshGeometryDimensions Mesh2D dimensions
         /// @param[out] meshGeometry Grid data
@@ -96,6 +112,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_get_mesh(int meshKernelId, MeshGeometryDimensions& meshGeometryDimensions, MeshGeometry& meshGeometry);
 
         /// @brief Gets the mesh faces
+        ///
+        /// The flat copies are reused, and have the same lifetime and read-only contract, as for \ref mkernel_get_mesh.
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[out] meshGeometryDimensions Grid dimensions
         /// @param[out] meshGeometry Mesh2D data (including face information)
@@ -120,6 +138,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_delete_hanging_edges(int meshKernelId);
 
         /// @brief Orthogonalization
+        ///
+        /// The call runs to completion and cannot be cancelled, mkernel_orthogonalize_async is the cancellable equivalent
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[in] projectToLandBoundaryOption The option to determine how to snap to land boundaries
         /// @param[in] orthogonalizationParameters The structure containing the orthogonalization parameters
@@ -231,9 +251,9 @@ namespace meshkernelapi
         /// @returns Error code
         MKERNEL_API int mkernel_make_mesh(int meshKernelId, const MakeMeshParameters& makeGridParameters, const GeometryList& geometryList);
 
-        /// @brief Makes a triangular grid in a polygon
+        /// @brief Makes a triangular grid in each polygon, the polygons are triangulated in parallel
         /// @param[in] meshKernelId Id of the mesh state
-        /// @param[in] geometryList The polygon where to triangulate
+        /// @param[in] geometryList The polygons where to triangulate
         /// @returns Error code
         MKERNEL_API int mkernel_make_mesh_from_polygon(int meshKernelId, const GeometryList& geometryList);
 
@@ -266,6 +286,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_refine_polygon(int meshKernelId, const GeometryList& geometryListIn, int firstIndex, int secondIndex, double distance, GeometryList& geometryListOut);
 
         /// @brief Counts the number of nodes after polygon refinement
+        ///
+        /// The refined polygon is kept for the following \ref mkernel_refine_polygon call with the same arguments.
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[in] geometryListIn The input polygon
         /// @param[in] firstIndex The index of the first node
@@ -289,6 +311,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_merge_two_nodes(int meshKernelId, int startNode, int endNode);
 
         /// @brief Gets the selected mesh node indices
+        ///
+        /// Reuses the selection of a preceding \ref mkernel_count_nodes_in_polygons call with the same polygon, if the mesh nodes did not change.
         ///        \see how to pass arrays in https://www.mono-project.com/docs/advanced/pinvoke/#memory-management
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[in] geometryListIn The input polygons
@@ -298,6 +322,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_nodes_in_polygons(int meshKernelId, const GeometryList& geometryListIn, int inside, int** selectedNodes);
 
         /// @brief Counts the number of selected mesh node indices
+        ///
+        /// The nodes are evaluated in parallel. The selection is kept for the following \ref mkernel_nodes_in_polygons call.
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[in] geometryListIn The input polygons
         /// @param[in] inside Count nodes inside (1) or outside (0) the polygon
@@ -357,6 +383,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_offsetted_polygon(int meshKernelId, const GeometryList& geometryListIn, bool innerPolygon, double distance, GeometryList& geometryListOut);
 
         /// @brief Gets the number of nodes of the offsetted polygon  Count the number of nodes after polygon refinement
+        ///
+        /// The offsetted polygon is kept for the following \ref mkernel_offsetted_polygon call with the same arguments.
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[in] geometryListIn The polygon to be offsetted
         /// @param[in] innerPolygon Compute inner (true) or outer (false) polygon
@@ -366,6 +394,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_offsetted_polygon_count(int meshKernelId, const GeometryList& geometryListIn, bool innerPolygon, double distance, int& numberOfPolygonNodes);
 
         /// @brief Refines a grid based on the samples contained in the geometry list
+        ///
+        /// The call runs to completion and cannot be cancelled, mkernel_refine_mesh_based_on_samples_async is the cancellable equivalent
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[in] geometryList The sample set
         /// @param[in] interpolationParameters The interpolation parameters
@@ -400,6 +430,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_points_in_polygon(int meshKernelId, const GeometryList& inputPolygon, const GeometryList& inputPoints, GeometryList& selectedPoints);
 
         /// @brief Flips the edges
+        ///
+        /// The call runs to completion and cannot be cancelled, mkernel_flip_edges_async is the cancellable equivalent
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[in] isTriangulationRequired The option to triangulate also non triangular cells (if activated squares becomes triangles)
         /// @param[in] projectToLandBoundaryOption The option to determine how to snap to land boundaries
@@ -407,6 +439,8 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_flip_edges(int meshKernelId, int isTriangulationRequired, int projectToLandBoundaryOption);
 
         /// @brief Generates curvilinear grid from splines with transfinite interpolation
+        ///
+        /// The call runs to completion and cannot be cancelled, mkernel_curvilinear_mesh_from_splines_async is the cancellable equivalent
         /// @param[in] meshKernelId Id of the mesh state
         /// @param[in] geometryListIn
         /// @param[in] curvilinearParameters
@@ -542,17 +576,150 @@ namespace meshkernelapi
                                   const int& spherical,
                                   const int& sphericalAccurate);
 
+        /// @brief Computes all quality metrics of the mesh in a single pass and reports their statistics
+        ///
+        /// Each line holds a metric name (Orthogonality, Smoothness, AspectRatio, FlowEdgeLengthRatio), the number of
+        /// edges where it is defined, its minimum, maximum and mean, followed by the counts of a histogram with
+        /// numHistogramBins equally wide bins between the minimum and the maximum, separated by tabs.
+        /// The last line holds ObtuseTriangles and the number of obtuse triangles.
+        /// If a modification left the faces out of date (e.g. \ref mkernel_insert_edge), the mesh is administrated first.
+        /// The pointer stays valid until the next call on the calling thread.
+        /// @param[in] meshKernelId The id of the mesh state
+        /// @param[in] numHistogramBins The number of histogram bins
+        /// @param[out] qualityReport The report
+        /// @returns Error code
+        MKERNEL_API int mkernel_get_quality_report(int meshKernelId, int numHistogramBins, const char*& qualityReport);
+
+        /// @brief Gets the bytes allocated by a mesh kernel instance, by subsystem
+        ///
+        /// Each line holds a subsystem name and its allocated bytes, separated by a tab. The last two lines hold the total
+        /// and the largest sampled total. It is not a true peak: the total is only sampled at the end of the operations creating or modifying the mesh and,
+        /// for the mesh refinements and the orthogonalization, once the algorithm has allocated its buffers (after the
+        /// last refinement level, at each outer orthogonalization iteration), including the buffers it releases before returning. Allocations living only between two samples are not seen.
+        /// The pointer stays valid until the next call on the calling thread.
+        /// @param[in] meshKernelId The id of the mesh state
+        /// @param[out] memoryUsage The report
+        /// @returns Error code
+        MKERNEL_API int mkernel_get_memory_usage(int meshKernelId, const char*& memoryUsage);
+
+        /// @brief Releases the caches, the R-trees and the flat copies of a mesh, they are rebuilt on demand
+        ///
+        /// The mesh geometry previously returned by mkernel_get_mesh or mkernel_find_faces becomes invalid
+        /// @param[in] meshKernelId The id of the mesh state
+        /// @returns Error code
+        MKERNEL_API int mkernel_shrink_mesh(int meshKernelId);
+
         /// @brief Gets pointer to error message.
+        ///
+        /// The message is the last error of the calling thread
         /// @param[out] error_message
         /// @returns Error code
         MKERNEL_API int mkernel_get_error(const char*& error_message);
 
+        /// @brief Gets the timings of the operations and the counters of the hot paths, accumulated over all threads since the last reset
+        ///
+        /// Each line holds the name, the number of executions (or the counter value), the total and the maximum time in seconds,
+        /// separated by tabs, sorted by decreasing total time. The report is empty if the library was built without instrumentation.
+        /// The pointer stays valid until the next call on the calling thread.
+        /// @param[out] timings The report
+        /// @returns Error code
+        MKERNEL_API int mkernel_get_timings(const char*& timings);
+
+        /// @brief Resets the timings and counters of the hot paths
+        /// @returns Error code
+        MKERNEL_API int mkernel_reset_timings();
+
         /// @brief Gets the index of the erroneous entity.
+        ///
+        /// The entity is the one of the last geometry error of the calling thread
         /// @param[out] invalidIndex The index of the erroneous entity
         /// @param[out] type The entity type (node, edge or face, see MeshLocations)
         /// @returns Error code
         MKERNEL_API int mkernel_get_geometry_error(int& invalidIndex, int& type);
 
+        /// @brief Submits an orthogonalization as an asynchronous job, see mkernel_orthogonalize
+        ///
+        /// The inputs are copied, they can be released when the call returns
+        /// @param[in] meshKernelId Id of the mesh state
+        /// @param[in] projectToLandBoundaryOption The option to determine how to snap to land boundaries
+        /// @param[in] orthogonalizationParameters The structure containing the orthogonalization parameters
+        /// @param[in] geometryListPolygon The polygon where to perform the orthogonalization
+        /// @param[in] geometryListLandBoundaries The land boundaries to account for in the orthogonalization process
+        /// @param[out] jobId The id of the submitted job
+        /// @returns Error code
+        MKERNEL_API int mkernel_orthogonalize_async(int meshKernelId,
+                                                    int projectToLandBoundaryOption,
+                                                    const OrthogonalizationParameters& orthogonalizationParameters,
+                                                    const GeometryList& geometryListPolygon,
+                                                    const GeometryList& geometryListLandBoundaries,
+                                                    int& jobId);
+
+        /// @brief Submits a refinement based on samples as an asynchronous job, see mkernel_refine_mesh_based_on_samples
+        ///
+        /// The inputs are copied, they can be released when the call returns
+        /// @param[in] meshKernelId Id of the mesh state
+        /// @param[in] geometryList The sample set
+        /// @param[in] interpolationParameters The interpolation parameters
+        /// @param[in] sampleRefineParameters The interpolation settings related to the samples
+        /// @param[out] jobId The id of the submitted job
+        /// @returns Error code
+        MKERNEL_API int mkernel_refine_mesh_based_on_samples_async(int meshKernelId,
+                                                                   const GeometryList& geometryList,
+                                                                   const InterpolationParameters& interpolationParameters,
+                                                                   const SampleRefineParameters& sampleRefineParameters,
+                                                                   int& jobId);
+
+        /// @brief Submits an edge flipping as an asynchronous job, see mkernel_flip_edges
+        /// @param[in] meshKernelId Id of the mesh state
+        /// @param[in] isTriangulationRequired The option to triangulate also non triangular cells (if activated squares becomes triangles)
+        /// @param[in] projectToLandBoundaryOption The option to determine how to snap to land boundaries
+        /// @param[out] jobId The id of the submitted job
+        /// @returns Error code
+        MKERNEL_API int mkernel_flip_edges_async(int meshKernelId, int isTriangulationRequired, int projectToLandBoundaryOption, int& jobId);
+
+        /// @brief Submits the generation of a curvilinear grid from splines as an asynchronous job, see mkernel_curvilinear_mesh_from_splines
+        ///
+        /// The inputs are copied, they can be released when the call returns
+        /// @param[in] meshKernelId Id of the mesh state
+        /// @param[in] geometryListIn The splines
+        /// @param[in] curvilinearParameters The curvilinear parameters
+        /// @param[out] jobId The id of the submitted job
+        /// @returns Error code
+        MKERNEL_API int mkernel_curvilinear_mesh_from_splines_async(int meshKernelId,
+                                                                    const GeometryList& geometryListIn,
+                                                                    const CurvilinearParameters& curvilinearParameters,
+                                                                    int& jobId);
+
+        /// @brief Gets the status of an asynchronous job
+        /// @param[in] jobId The id of the job
+        /// @param[out] status The job status (0 queued, 1 running, 2 completed, 3 cancelled)
+        /// @returns Error code
+        MKERNEL_API int mkernel_get_job_status(int jobId, int& status);
+
+        /// @brief Gets the progress of an asynchronous job
+        /// @param[in] jobId The id of the job
+        /// @param[out] progress The progress of the job, a fraction between 0 and 1
+        /// @returns Error code
+        MKERNEL_API int mkernel_get_job_progress(int jobId, double& progress);
+
+        /// @brief Cancels an asynchronous job
+        ///
+        /// A queued job does not start. A running job stops at the end of its current iteration,
+        /// the mesh is left as it was after the last completed iteration.
+        /// Only the jobs submitted with the *_async functions can be cancelled, the synchronous calls have no cancel handle
+        /// and always run to completion. To cancel an operation started from a single thread, submit it as a job and wait for it.
+        /// @param[in] jobId The id of the job
+        /// @returns Error code, an exception if the job has already finished
+        MKERNEL_API int mkernel_cancel_job(int jobId);
+
+        /// @brief Waits for an asynchronous job to finish and releases it
+        ///
+        /// When the job failed or was cancelled, its error is available through mkernel_get_error and mkernel_get_geometry_error
+        /// @param[in] jobId The id of the job
+        /// @param[out] jobExitCode The error code of the operation executed by the job
+        /// @returns Error code
+        MKERNEL_API int mkernel_wait_job(int jobId, int& jobExitCode);
+
 #ifdef __cplusplus
     }
 #endif
@@ -49,6 +49,7 @@
 #include <MeshKernelApi/SampleRefineParameters.hpp>
 #include <MeshKernelApi/SplinesToCurvilinearParameters.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
@@ -111,6 +112,36 @@ namespace meshkernelapi
         }
     }
 
+    /// @brief An owning copy of a geometry list, for operations running after the caller released its arrays
+    struct GeometryListBuffer
+    {
+        /// @brief Constructor, copies the coordinates
+        /// @param[in] geometryListIn The geometry list to copy
+        explicit GeometryListBuffer(const GeometryList& geometryListIn) : m_geometryList(geometryListIn)
+        {
+            const auto numCoordinates = static_cast<size_t>(std::max(geometryListIn.numberOfCoordinates, 0));
+            const auto copyCoordinates = [numCoordinates](const double* coordinates, std::vector<double>& buffer) {
+                if (coordinates == nullptr)
+                {
+                    return static_cast<double*>(nullptr);
+                }
+                buffer.assign(coordinates, coordinates + numCoordinates);
+                return buffer.data();
+            };
+            m_geometryList.xCoordinates = copyCoordinates(geometryListIn.xCoordinates, m_xCoordinates);
+            m_geometryList.yCoordinates = copyCoordinates(geometryListIn.yCoordinates, m_yCoordinates);
+            m_geometryList.zCoordinates = copyCoordinates(geometryListIn.zCoordinates, m_zCoordinates);
+        }
+
+        GeometryListBuffer(const GeometryListBuffer&) = delete;
+        GeometryListBuffer& operator=(const GeometryListBuffer&) = delete;
+
+        std::vector<double> m_xCoordinates; ///< The copied x coordinates
+        std::vector<double> m_yCoordinates; ///< The copied y coordinates
+        std::vector<double> m_zCoordinates; ///< The copied z coordinates
+        GeometryList m_geometryList;        ///< The geometry list pointing to the copied coordinates
+    };
+
     /// @brief Sets splines from a geometry list
     /// @param[in]  geometryListIn The input geometry list
     /// @param[out] spline         The spline which will be set
@@ -136,40 +167,37 @@ namespace meshkernelapi
     }
 
     /// @brief Sets meshgeometry for a certain mesh
-    /// @param[in]  meshInstances          The mesh instances
-    /// @param[in]  meshKernelId           The id to the mesh which should be set
+    /// @param[in]  mesh                   The mesh whose node coordinates and flat copies are exposed, without copying them
     /// @param[out] meshGeometryDimensions The dimensions of the mesh geometry
     /// @param[out] meshGeometry           The mesh geometry
-    static void SetMeshGeometry(std::vector<std::shared_ptr<meshkernel::Mesh2D>> meshInstances,
-                                int meshKernelId,
+    static void SetMeshGeometry(meshkernel::Mesh2D& mesh,
                                 MeshGeometryDimensions& meshGeometryDimensions,
                                 MeshGeometry& meshGeometry)
     {
-
-        meshGeometry.nodex = &(meshInstances[meshKernelId]->m_nodex[0]);
-        meshGeometry.nodey = &(meshInstances[meshKernelId]->m_nodey[0]);
-        meshGeometry.nodez = &(meshInstances[meshKernelId]->m_nodez[0]);
-        meshGeometry.edge_nodes = &(meshInstances[meshKernelId]->m_edgeNodes[0]);
+        meshGeometry.nodex = mesh.m_nodes.GetXData();
+        meshGeometry.nodey = mesh.m_nodes.GetYData();
+        meshGeometry.nodez = mesh.m_nodez.data();
+        meshGeometry.edge_nodes = mesh.m_edgeNodes.data();
 
         meshGeometryDimensions.maxnumfacenodes = meshkernel::maximumNumberOfNodesPerFace;
-        meshGeometryDimensions.numface = static_cast<int>(meshInstances[meshKernelId]->GetNumFaces());
+        meshGeometryDimensions.numface = static_cast<int>(mesh.GetNumFaces());
         if (meshGeometryDimensions.numface > 0)
         {
-            meshGeometry.face_nodes = &(meshInstances[meshKernelId]->m_faceNodes[0]);
-            meshGeometry.facex = &(meshInstances[meshKernelId]->m_facesCircumcentersx[0]);
-            meshGeometry.facey = &(meshInstances[meshKernelId]->m_facesCircumcentersy[0]);
-            meshGeometry.facez = &(meshInstances[meshKernelId]->m_facesCircumcentersz[0]);
+            meshGeometry.face_nodes = mesh.m_faceNodes.data();
+            meshGeometry.facex = mesh.m_facesCircumcentersx.data();
+            meshGeometry.facey = mesh.m_facesCircumcentersy.data();
+            meshGeometry.facez = mesh.m_facesCircumcentersz.data();
         }
 
-        if (meshInstances[meshKernelId]->GetNumNodes() == 1)
+        if (mesh.GetNumNodes() == 1)
         {
             meshGeometryDimensions.numnode = 0;
             meshGeometryDimensions.numedge = 0;
         }
         else
         {
-            meshGeometryDimensions.numnode = static_cast<int>(meshInstances[meshKernelId]->GetNumNodes());
-            meshGeometryDimensions.numedge = static_cast<int>(meshInstances[meshKernelId]->GetNumEdges());
+            meshGeometryDimensions.numnode = static_cast<int>(mesh.GetNumNodes());
+            meshGeometryDimensions.numedge = static_cast<int>(mesh.GetNumEdges());
         }
     }
 
@@ -25,14 +25,82 @@
 //
 //------------------------------------------------------------------------------
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
 #include <stdexcept>
 #include <tuple>
 
 #include <MeshKernel/AveragingInterpolation.hpp>
 #include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/RTree.hpp>
+#include <MeshKernel/SampleBins.hpp>
+
+namespace
+{
+    /// @brief Checks if a segment intersects an axis aligned box (Liang-Barsky clipping)
+    bool IsSegmentIntersectingBox(const meshkernel::Point& firstNode,
+                                  const meshkernel::Point& secondNode,
+                                  const meshkernel::Point& lowerLeft,
+                                  const meshkernel::Point& upperRight)
+    {
+        const double dx = secondNode.x - firstNode.x;
+        const double dy = secondNode.y - firstNode.y;
+        const std::array<double, 4> directions{-dx, dx, -dy, dy};
+        const std::array<double, 4> distances{firstNode.x - lowerLeft.x, upperRight.x - firstNode.x, firstNode.y - lowerLeft.y, upperRight.y - firstNode.y};
+
+        double entering = 0.0;
+        double leaving = 1.0;
+        for (size_t i = 0; i < directions.size(); ++i)
+        {
+            if (directions[i] == 0.0)
+            {
+                if (distances[i] < 0.0)
+                {
+                    return false;
+                }
+                continue;
+            }
+            const double ratio = distances[i] / directions[i];
+            if (directions[i] < 0.0)
+            {
+                entering = std::max(entering, ratio);
+            }
+            else
+            {
+                leaving = std::min(leaving, ratio);
+            }
+        }
+        return entering <= leaving;
+    }
+
+    /// @brief Checks if an axis aligned box is entirely inside a closed polygon
+    bool IsBoxInPolygon(const meshkernel::Point& lowerLeft,
+                        const meshkernel::Point& upperRight,
+                        const std::vector<meshkernel::Point>& polygon,
+                        const meshkernel::Projection& projection)
+    {
+        for (const auto& corner : {lowerLeft, meshkernel::Point{upperRight.x, lowerLeft.y}, upperRight, meshkernel::Point{lowerLeft.x, upperRight.y}})
+        {
+            if (!meshkernel::IsPointInPolygonNodes(corner, polygon, projection))
+            {
+                return false;
+            }
+        }
+        for (size_t n = 0; n + 1 < polygon.size(); ++n)
+        {
+            if (IsSegmentIntersectingBox(polygon[n], polygon[n + 1], lowerLeft, upperRight))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
 
 meshkernel::AveragingInterpolation::AveragingInterpolation(std::shared_ptr<Mesh2D> mesh,
                                                            std::vector<Sample>& samples,
@@ -52,14 +120,26 @@ meshkernel::AveragingInterpolation::AveragingInterpolation(std::shared_ptr<Mesh2
 
 void meshkernel::AveragingInterpolation::Compute()
 {
+    MESHKERNEL_TIME_SCOPE("AveragingInterpolation::Compute");
+
     if (m_samples.empty())
     {
         throw AlgorithmError("TriangulationInterpolation::Compute: No samples available.");
     }
 
-    m_visitedSamples.resize(m_samples.size());
-    // build sample rtree for searches
-    m_samplesRtree.BuildTree(m_samples);
+    m_sampleBins.reset();
+    m_binsRTrees.clear();
+    if (IsSampleBinningEffective())
+    {
+        m_sampleBins = std::make_unique<SampleBins>(m_samples);
+        m_binsRTrees.resize(m_sampleBins->GetNumLevels());
+    }
+    else
+    {
+        m_visitedSamples.resize(m_samples.size());
+        // build sample rtree for searches
+        m_samplesRtree.BuildTree(m_samples);
+    }
 
     auto interpolatedResults = ComputeOnLocations();
 
@@ -94,6 +174,15 @@ void meshkernel::AveragingInterpolation::Compute()
     //for the other cases, the interpolated values are already at the correct location
     m_results = std::move(interpolatedResults);
 }
+void meshkernel::AveragingInterpolation::AccumulateMemoryUsage(MemoryUsage& memoryUsage) const
+{
+    memoryUsage.AddVectors("Averaging interpolation", m_results, m_visitedSamples);
+    if (m_sampleBins != nullptr)
+    {
+        m_sampleBins->AccumulateMemoryUsage(memoryUsage);
+    }
+}
+
 std::vector<double> meshkernel::AveragingInterpolation::ComputeOnFaces()
 {
     std::vector<double> interpolatedResults(m_mesh->GetNumFaces(), doubleMissingValue);
@@ -223,6 +312,12 @@ void meshkernel::AveragingInterpolation::ComputeOnPolygon(const std::vector<Poin
         throw std::invalid_argument("AveragingInterpolation::ComputeOnPolygon search radius <= 0");
     }
 
+    if (m_sampleBins != nullptr)
+    {
+        ComputeOnPolygonFromBins(searchPolygon, interpolationPoint, searchRadiusSquared, result);
+        return;
+    }
+
     // Get the closest sample
     m_samplesRtree.NearestNeighborsOnSquaredDistance(interpolationPoint, searchRadiusSquared);
     if (m_samplesRtree.GetQueryResultSize() == 0)
@@ -331,3 +426,164 @@ void meshkernel::AveragingInterpolation::ComputeOnPolygon(const std::vector<Poin
         result /= wall;
     }
 }
+
+bool meshkernel::AveragingInterpolation::IsSampleBinningEffective() const
+{
+    if (m_transformSamples ||
+        (m_method != Method::SimpleAveraging && m_method != Method::Max && m_method != Method::Min && m_method != Method::MinAbsValue))
+    {
+        return false;
+    }
+
+    const auto numLocations = m_interpolationLocation == MeshLocations::Faces ? m_mesh->GetNumFaces() : m_mesh->GetNumNodes();
+    return m_samples.size() > minimumSamplesPerLocationForBinning * numLocations;
+}
+
+void meshkernel::AveragingInterpolation::ComputeOnPolygonFromBins(const std::vector<Point>& searchPolygon,
+                                                                  Point interpolationPoint,
+                                                                  double searchRadiusSquared,
+                                                                  double& result)
+{
+    result = doubleMissingValue;
+    if (m_sampleBins->GetNumLevels() == 0)
+    {
+        return;
+    }
+
+    // select the bins resolution from the size of the search area
+    const auto [lowerLeft, upperRight] = GetBoundingBox(searchPolygon);
+    const auto level = m_sampleBins->SelectLevel(std::max(upperRight.x - lowerLeft.x, upperRight.y - lowerLeft.y));
+    auto& bins = m_sampleBins->GetBins(level);
+    auto& binsRTree = m_binsRTrees[level];
+    if (binsRTree.Empty())
+    {
+        binsRTree.BuildTree(bins);
+    }
+
+    // the bins with samples within the search radius have their centroid within a bin diagonal of it
+    const auto binDiagonal = std::sqrt(2.0) * m_sampleBins->GetBinSize(level);
+    const auto binsSearchRadius = std::sqrt(searchRadiusSquared) + binDiagonal;
+    binsRTree.NearestNeighborsOnSquaredDistance(interpolationPoint, binsSearchRadius * binsSearchRadius);
+
+    double sum = 0.0;
+    size_t count = 0;
+    bool firstValidBinFound = false;
+    const auto addBin = [&](const SampleBin& bin) {
+        if (m_method == Method::SimpleAveraging)
+        {
+            sum += bin.sum;
+            count += bin.count;
+        }
+        if (m_method == Method::Max)
+        {
+            result = firstValidBinFound ? std::max(result, bin.max) : bin.max;
+        }
+        if (m_method == Method::Min)
+        {
+            result = firstValidBinFound ? std::min(result, bin.min) : bin.min;
+        }
+        if (m_method == Method::MinAbsValue)
+        {
+            result = firstValidBinFound ? std::min(result, bin.minAbs) : bin.minAbs;
+        }
+        firstValidBinFound = true;
+    };
+
+    const auto& sampleIndices = m_sampleBins->GetSampleIndices();
+    for (auto i = 0; i < binsRTree.GetQueryResultSize(); i++)
+    {
+        const auto binIndex = binsRTree.GetQueryResult(i);
+        const auto& bin = bins[binIndex];
+
+        // the aggregated values are used only for the bins entirely inside the polygon
+        const auto [binLowerLeft, binUpperRight] = m_sampleBins->GetBinCell(level, binIndex);
+        if (binLowerLeft.x > upperRight.x || binUpperRight.x < lowerLeft.x || binLowerLeft.y > upperRight.y || binUpperRight.y < lowerLeft.y)
+        {
+            continue;
+        }
+        if (IsBoxInPolygon(binLowerLeft, binUpperRight, searchPolygon, m_mesh->m_projection))
+        {
+            addBin(bin);
+            continue;
+        }
+
+        // the bins straddling the polygon boundary are evaluated on their samples
+        for (auto s = bin.first; s < bin.first + bin.count; ++s)
+        {
+            const auto& sample = m_samples[sampleIndices[s]];
+            if (IsPointInPolygonNodes({sample.x, sample.y}, searchPolygon, m_mesh->m_projection))
+            {
+                addBin({sample.x, sample.y, sample.value, sample.value, sample.value, std::abs(sample.value), 1, s});
+            }
+        }
+    }
+
+    if (m_method == Method::SimpleAveraging && count > 0)
+    {
+        result = sum / static_cast<double>(count);
+    }
+
+    if (firstValidBinFound || !m_useClosestSampleIfNoneAvailable)
+    {
+        return;
+    }
+
+    // use the closest sample only if none is within the search radius
+    for (auto i = 0; i < binsRTree.GetQueryResultSize(); i++)
+    {
+        const auto& bin = bins[binsRTree.GetQueryResult(i)];
+        for (auto s = bin.first; s < bin.first + bin.count; ++s)
+        {
+            const auto& sample = m_samples[sampleIndices[s]];
+            if (ComputeSquaredDistance(interpolationPoint, {sample.x, sample.y}, m_mesh->m_projection) <= searchRadiusSquared)
+            {
+                return;
+            }
+        }
+    }
+    result = GetClosestSampleValueFromBins(interpolationPoint);
+}
+
+double meshkernel::AveragingInterpolation::GetClosestSampleValueFromBins(Point interpolationPoint)
+{
+    // the finest bins, for the fewest samples to evaluate
+    const auto& bins = m_sampleBins->GetBins(0);
+    auto& binsRTree = m_binsRTrees[0];
+    if (binsRTree.Empty())
+    {
+        binsRTree.BuildTree(bins);
+    }
+
+    const auto& sampleIndices = m_sampleBins->GetSampleIndices();
+    double closestSquaredDistance = std::numeric_limits<double>::max();
+    double result = doubleMissingValue;
+    const auto addClosestSample = [&](const SampleBin& bin) {
+        for (auto s = bin.first; s < bin.first + bin.count; ++s)
+        {
+            const auto& sample = m_samples[sampleIndices[s]];
+            if (const auto squaredDistance = ComputeSquaredDistance(interpolationPoint, {sample.x, sample.y}, m_mesh->m_projection);
+                squaredDistance < closestSquaredDistance)
+            {
+                closestSquaredDistance = squaredDistance;
+                result = sample.value;
+            }
+        }
+    };
+
+    // the samples of the closest bin bound the distance to the closest sample
+    binsRTree.NearestNeighbors(interpolationPoint);
+    if (binsRTree.GetQueryResultSize() == 0)
+    {
+        return result;
+    }
+    addClosestSample(bins[binsRTree.GetQueryResult(0)]);
+
+    // any closer sample is in a bin with the centroid within a bin diagonal of that distance
+    const auto binsSearchRadius = std::sqrt(closestSquaredDistance) + std::sqrt(2.0) * m_sampleBins->GetBinSize(0);
+    binsRTree.NearestNeighborsOnSquaredDistance(interpolationPoint, binsSearchRadius * binsSearchRadius);
+    for (auto i = 0; i < binsRTree.GetQueryResultSize(); i++)
+    {
+        addClosestSample(bins[binsRTree.GetQueryResult(i)]);
+    }
+    return result;
+}
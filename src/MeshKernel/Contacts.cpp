@@ -26,11 +26,11 @@ void meshkernel::Contacts::ComputeSingleConnections(const Polygons& polygons)
     m_mesh2d->Administrate(Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
     m_mesh1d->AdministrateNodesEdges();
 
-    const auto node1dFaceIndices = m_mesh2d->PointFaceIndices(m_mesh1d->m_nodes);
+    const auto node1dFaceIndices = m_mesh2d->PointFaceIndices(m_mesh1d->m_nodes.ToPoints());
     m_mesh1dIndices.reserve(m_mesh1d->m_nodes.size());
     m_mesh2dIndices.reserve(m_mesh1d->m_nodes.size());
 
-    const auto nodePolygonIndices = polygons.PolygonIndices(m_mesh1d->m_nodes);
+    const auto nodePolygonIndices = polygons.PolygonIndices(m_mesh1d->m_nodes.ToPoints());
 
     for (size_t n = 0; n < m_mesh1d->m_nodes.size(); ++n)
     {
@@ -158,7 +158,7 @@ void meshkernel::Contacts::ComputeMultipleConnections()
     m_mesh1d->AdministrateNodesEdges();
 
     // compute the indices of the faces including the 1d nodes
-    const auto node1dFaceIndices = m_mesh2d->PointFaceIndices(m_mesh1d->m_nodes);
+    const auto node1dFaceIndices = m_mesh2d->PointFaceIndices(m_mesh1d->m_nodes.ToPoints());
 
     // build mesh2d face circumcenters r-tree
     std::vector<bool> isFaceAlreadyConnected(m_mesh2d->GetNumFaces(), false);
@@ -272,7 +272,7 @@ void meshkernel::Contacts::ComputeConnectionsWithPolygons(const Polygons& polygo
 
         const auto close1DNodeIndex = m_mesh1d->FindNodeCloseToAPoint(faceMassCenter, m_oneDNodeMask);
 
-        const auto close1DNode = m_mesh1d->m_nodes[close1DNodeIndex];
+        const Point close1DNode = m_mesh1d->m_nodes[close1DNodeIndex];
         const auto squaredDistance = ComputeSquaredDistance(faceMassCenter, close1DNode, m_mesh2d->m_projection);
         // if it is the first found node of this polygon or
         // there is already a distance stored, but ours is smaller
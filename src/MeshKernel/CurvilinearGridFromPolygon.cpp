@@ -211,7 +211,7 @@ void meshkernel::CurvilinearGridFromPolygon::Compute(size_t firstNode,
     {
         for (auto j = 0; j < numNNodes; j++)
         {
-            curvilinearGrid.m_grid[i][j] = result[i][j];
+            curvilinearGrid.Node(i, j) = result.Node(i, j);
         }
     }
 }
@@ -392,34 +392,34 @@ void meshkernel::CurvilinearGridFromPolygon::Compute(size_t firstNode,
         // add to grid
         if (t == 0)
         {
-            for (auto i = 0; i < result.size(); ++i)
+            for (auto i = 0; i < result.GetNumMNodes(); ++i)
             {
-                for (auto j = 0; j < result[0].size(); ++j)
+                for (auto j = 0; j < result.GetNumNNodes(); ++j)
                 {
-                    curvilinearGrid.m_grid[i][j] = result[i][j];
+                    curvilinearGrid.Node(i, j) = result.Node(i, j);
                 }
             }
         }
         if (t == 1)
         {
-            for (auto i = 0; i < result.size(); ++i)
+            for (auto i = 0; i < result.GetNumMNodes(); ++i)
             {
-                for (auto j = 0; j < result[0].size(); ++j)
+                for (auto j = 0; j < result.GetNumNNodes(); ++j)
                 {
                     const auto iIndex = n1 + n3 - i;
                     const auto jIndex = n2 + n3 - j;
-                    curvilinearGrid.m_grid[iIndex][jIndex] = result[i][j];
+                    curvilinearGrid.Node(iIndex, jIndex) = result.Node(i, j);
                 }
             }
         }
         if (t == 2)
         {
-            for (auto i = 0; i < result[0].size(); ++i)
+            for (auto i = 0; i < result.GetNumNNodes(); ++i)
             {
-                for (auto j = 0; j < result.size(); ++j)
+                for (auto j = 0; j < result.GetNumMNodes(); ++j)
                 {
                     const auto jIndex = n2 + n3 - j;
-                    curvilinearGrid.m_grid[i][jIndex] = result[j][i];
+                    curvilinearGrid.Node(i, jIndex) = result.Node(j, i);
                 }
             }
         }
@@ -26,6 +26,7 @@
 //------------------------------------------------------------------------------
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <vector>
 
@@ -34,6 +35,7 @@
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Exceptions.hpp>
 #include <MeshKernel/Operations.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 #include <MeshKernel/Splines.hpp>
 #include <MeshKernelApi/CurvilinearParameters.hpp>
 #include <MeshKernelApi/SplinesToCurvilinearParameters.hpp>
@@ -115,6 +117,7 @@ void meshkernel::CurvilinearGridFromSplines::Compute(CurvilinearGrid& curvilinea
     // Grow grid, from the second layer
     for (auto layer = 1; layer <= m_curvilinearParameters.NRefinement; ++layer)
     {
+        ProgressMonitor::Report(static_cast<double>(layer - 1) / static_cast<double>(m_curvilinearParameters.NRefinement));
         Iterate(layer);
     }
 
@@ -372,6 +375,7 @@ void meshkernel::CurvilinearGridFromSplines::Initialize()
     const auto numGridLayers = m_curvilinearParameters.NRefinement + 1;
     // The layer by coordinate to grow
     m_gridPoints.resize(numGridLayers + 1, std::vector<Point>(m_numM + 1, {doubleMissingValue, doubleMissingValue}));
+    m_lastGrownLayer = sizetMissingValue;
     m_validFrontNodes.resize(m_numM, 1);
 
     // Copy the first n in m_gridPoints
@@ -586,57 +590,80 @@ void meshkernel::CurvilinearGridFromSplines::ComputeGridLayerAndSubLayer(size_t
     }
 }
 
+void meshkernel::CurvilinearGridFromSplines::ResetFrontWorkspaces()
+{
+    // the front can not be larger than the grid, the workspaces are allocated only once
+    const auto numGridPoints = m_gridPoints.size() * m_gridPoints[0].size();
+    if (m_frontGridPoints.size() != numGridPoints)
+    {
+        m_frontGridPointsIndices.assign(numGridPoints, {sizetMissingValue, sizetMissingValue});
+        m_frontGridPoints.assign(numGridPoints, {0.0, 0.0});
+        m_frontVelocities.assign(numGridPoints, {0.0, 0.0});
+        m_numFrontWorkspaceUsed = 0;
+        return;
+    }
+
+    // only the entries written while growing the previous layer need to be reset
+    std::fill(m_frontGridPointsIndices.begin(), m_frontGridPointsIndices.begin() + m_numFrontWorkspaceUsed, std::array<size_t, 2>{sizetMissingValue, sizetMissingValue});
+    std::fill(m_frontGridPoints.begin(), m_frontGridPoints.begin() + m_numFrontWorkspaceUsed, Point{0.0, 0.0});
+    std::fill(m_frontVelocities.begin(), m_frontVelocities.begin() + m_numFrontWorkspaceUsed, Point{0.0, 0.0});
+    m_numFrontWorkspaceUsed = 0;
+}
+
 void meshkernel::CurvilinearGridFromSplines::GrowLayer(size_t layerIndex)
 {
-    std::vector<Point> velocityVectorAtGridPoints(m_numM);
-    ComputeVelocitiesAtGridPoints(layerIndex - 1, velocityVectorAtGridPoints);
+    m_velocityVectorAtGridPoints.resize(m_numM);
+    ComputeVelocitiesAtGridPoints(layerIndex - 1, m_velocityVectorAtGridPoints);
 
-    std::vector<Point> activeLayerPoints(m_gridPoints[layerIndex - 1]);
-    for (auto m = 0; m < velocityVectorAtGridPoints.size(); ++m)
+    m_activeLayerPoints = m_gridPoints[layerIndex - 1];
+    for (auto m = 0; m < m_velocityVectorAtGridPoints.size(); ++m)
     {
-        if (!velocityVectorAtGridPoints[m].IsValid())
+        if (!m_velocityVectorAtGridPoints[m].IsValid())
         {
             m_gridPoints[layerIndex - 1][m] = {doubleMissingValue, doubleMissingValue};
-            activeLayerPoints[m] = {doubleMissingValue, doubleMissingValue};
+            m_activeLayerPoints[m] = {doubleMissingValue, doubleMissingValue};
         }
     }
 
-    const auto numGridPoints = m_gridPoints.size() * m_gridPoints[0].size();
-    std::vector<std::vector<size_t>> gridPointsIndices(numGridPoints, std::vector<size_t>(2, sizetMissingValue));
-    std::vector<Point> frontGridPoints(numGridPoints, {0.0, 0.0});
+    ResetFrontWorkspaces();
+    const auto numFrontWorkspace = m_frontGridPoints.size();
+
+    // growing a layer changes the layer below, so did growing the previous layer. Otherwise the whole front is searched
+    const auto isNextLayer = m_lastGrownLayer != sizetMissingValue && layerIndex == m_lastGrownLayer + 1;
+    const auto firstChangedLayer = isNextLayer && layerIndex >= 2 ? layerIndex - 2 : 0;
+    m_lastGrownLayer = layerIndex;
     size_t numFrontPoints;
-    FindFront(gridPointsIndices, frontGridPoints, numFrontPoints);
+    FindFront(firstChangedLayer, m_frontGridPointsIndices, m_frontGridPoints, numFrontPoints);
 
-    std::vector<Point> frontVelocities(numGridPoints, {0.0, 0.0});
     CopyVelocitiesToFront(layerIndex - 1,
-                          velocityVectorAtGridPoints,
+                          m_velocityVectorAtGridPoints,
                           numFrontPoints,
-                          gridPointsIndices,
-                          frontGridPoints,
-                          frontVelocities);
+                          m_frontGridPointsIndices,
+                          m_frontGridPoints,
+                          m_frontVelocities);
+    m_numFrontWorkspaceUsed = std::min(std::max(m_numFrontWorkspaceUsed, numFrontPoints + 1), numFrontWorkspace);
 
     double totalTimeStep = 0.0;
-    std::vector<Point> gridLine(m_gridPoints[layerIndex - 1]);
     double localTimeStep = 0.0;
     double otherTimeStep = std::numeric_limits<double>::max();
-    std::vector<size_t> newValidFrontNodes(numGridPoints);
+    m_newValidFrontNodes.assign(m_validFrontNodes.size(), 0);
 
     while (totalTimeStep < m_timeStep)
     {
         // Copy old front velocities
-        newValidFrontNodes = m_validFrontNodes;
+        m_newValidFrontNodes = m_validFrontNodes;
 
         for (auto i = 0; i < m_validFrontNodes.size(); ++i)
         {
             if (m_validFrontNodes[i] == sizetMissingValue)
             {
-                activeLayerPoints[i] = {doubleMissingValue, doubleMissingValue};
+                m_activeLayerPoints[i] = {doubleMissingValue, doubleMissingValue};
             }
         }
 
-        std::vector<double> maximumGridLayerGrowTime(newValidFrontNodes.size(), std::numeric_limits<double>::max());
-        ComputeMaximumGridLayerGrowTime(activeLayerPoints, velocityVectorAtGridPoints, maximumGridLayerGrowTime);
-        localTimeStep = std::min(m_timeStep - totalTimeStep, *std::min_element(maximumGridLayerGrowTime.begin(), maximumGridLayerGrowTime.end()));
+        m_maximumGridLayerGrowTime.assign(m_newValidFrontNodes.size(), std::numeric_limits<double>::max());
+        ComputeMaximumGridLayerGrowTime(m_activeLayerPoints, m_velocityVectorAtGridPoints, m_maximumGridLayerGrowTime);
+        localTimeStep = std::min(m_timeStep - totalTimeStep, *std::min_element(m_maximumGridLayerGrowTime.begin(), m_maximumGridLayerGrowTime.end()));
 
         if (m_splinesToCurvilinearParameters.CheckFrontCollisions)
         {
@@ -646,63 +673,64 @@ void meshkernel::CurvilinearGridFromSplines::GrowLayer(size_t layerIndex)
         localTimeStep = std::min(localTimeStep, otherTimeStep);
 
         // remove isolated points at the start end end of the masl
-        if (newValidFrontNodes[0] == 1 && newValidFrontNodes[1] == 0)
+        if (m_newValidFrontNodes[0] == 1 && m_newValidFrontNodes[1] == 0)
         {
-            newValidFrontNodes[0] = 0;
+            m_newValidFrontNodes[0] = 0;
         }
 
-        if (newValidFrontNodes[m_numM - 1] == 1 && newValidFrontNodes[m_numM - 2] == 0)
+        if (m_newValidFrontNodes[m_numM - 1] == 1 && m_newValidFrontNodes[m_numM - 2] == 0)
         {
-            newValidFrontNodes[m_numM - 1] = 0;
+            m_newValidFrontNodes[m_numM - 1] = 0;
         }
 
-        for (auto i = 0; i < newValidFrontNodes.size() - 2; ++i)
+        for (auto i = 0; i < m_newValidFrontNodes.size() - 2; ++i)
         {
-            if (newValidFrontNodes[i + 1] == 1 && newValidFrontNodes[i] == 0 && newValidFrontNodes[i + 2] == 0)
+            if (m_newValidFrontNodes[i + 1] == 1 && m_newValidFrontNodes[i] == 0 && m_newValidFrontNodes[i + 2] == 0)
             {
-                newValidFrontNodes[i + 1] = 0;
+                m_newValidFrontNodes[i + 1] = 0;
             }
         }
 
-        m_validFrontNodes = newValidFrontNodes;
+        m_validFrontNodes = m_newValidFrontNodes;
 
-        for (auto i = 0; i < velocityVectorAtGridPoints.size(); ++i)
+        for (auto i = 0; i < m_velocityVectorAtGridPoints.size(); ++i)
         {
-            if (m_validFrontNodes[i] == 1 && velocityVectorAtGridPoints[i].IsValid())
+            if (m_validFrontNodes[i] == 1 && m_velocityVectorAtGridPoints[i].IsValid())
             {
-                activeLayerPoints[i].x = activeLayerPoints[i].x + localTimeStep * velocityVectorAtGridPoints[i].x;
-                activeLayerPoints[i].y = activeLayerPoints[i].y + localTimeStep * velocityVectorAtGridPoints[i].y;
+                m_activeLayerPoints[i].x = m_activeLayerPoints[i].x + localTimeStep * m_velocityVectorAtGridPoints[i].x;
+                m_activeLayerPoints[i].y = m_activeLayerPoints[i].y + localTimeStep * m_velocityVectorAtGridPoints[i].y;
             }
             else
             {
-                activeLayerPoints[i].x = doubleMissingValue;
-                activeLayerPoints[i].y = doubleMissingValue;
+                m_activeLayerPoints[i].x = doubleMissingValue;
+                m_activeLayerPoints[i].y = doubleMissingValue;
             }
         }
 
         // update the grid points
-        m_gridPoints[layerIndex] = activeLayerPoints;
+        m_gridPoints[layerIndex] = m_activeLayerPoints;
 
         // update the time step
         totalTimeStep += localTimeStep;
 
         if (totalTimeStep < m_timeStep)
         {
-            ComputeVelocitiesAtGridPoints(layerIndex, velocityVectorAtGridPoints);
+            ComputeVelocitiesAtGridPoints(layerIndex, m_velocityVectorAtGridPoints);
 
             for (auto i = 0; i < m_numM; ++i)
             {
                 // Disable points that have no valid normal vector
                 // Remove stationary points
-                if (!frontVelocities[i].IsValid() || m_validFrontNodes[i] == 0)
+                if (!m_frontVelocities[i].IsValid() || m_validFrontNodes[i] == 0)
                 {
-                    activeLayerPoints[i] = {doubleMissingValue, doubleMissingValue};
+                    m_activeLayerPoints[i] = {doubleMissingValue, doubleMissingValue};
                 }
             }
 
-            FindFront(gridPointsIndices, frontGridPoints, numFrontPoints);
-            CopyVelocitiesToFront(layerIndex - 1, velocityVectorAtGridPoints, numFrontPoints,
-                                  gridPointsIndices, frontGridPoints, frontVelocities);
+            FindFront(firstChangedLayer, m_frontGridPointsIndices, m_frontGridPoints, numFrontPoints);
+            CopyVelocitiesToFront(layerIndex - 1, m_velocityVectorAtGridPoints, numFrontPoints,
+                                  m_frontGridPointsIndices, m_frontGridPoints, m_frontVelocities);
+            m_numFrontWorkspaceUsed = std::min(std::max(m_numFrontWorkspaceUsed, numFrontPoints + 1), numFrontWorkspace);
         }
     }
 
@@ -711,38 +739,38 @@ void meshkernel::CurvilinearGridFromSplines::GrowLayer(size_t layerIndex)
         for (auto i = 1; i < m_numM - 1; ++i)
         {
 
-            if (!activeLayerPoints[i].IsValid())
+            if (!m_activeLayerPoints[i].IsValid())
             {
                 continue;
             }
             const double cosphi = NormalizedInnerProductTwoSegments(m_gridPoints[layerIndex - 2][i],
                                                                     m_gridPoints[layerIndex - 1][i],
                                                                     m_gridPoints[layerIndex - 1][i],
-                                                                    activeLayerPoints[i],
+                                                                    m_activeLayerPoints[i],
                                                                     m_splines->m_projection);
             if (cosphi < -0.5)
             {
                 size_t currentLeftIndex;
                 size_t currentRightIndex;
-                GetNeighbours(frontGridPoints, i, currentLeftIndex, currentRightIndex);
+                GetNeighbours(m_frontGridPoints, i, currentLeftIndex, currentRightIndex);
                 for (auto j = currentLeftIndex + 1; j < currentRightIndex; ++j)
                 {
-                    newValidFrontNodes[j] = 0;
+                    m_newValidFrontNodes[j] = 0;
                     m_gridPoints[layerIndex - 1][j] = {doubleMissingValue, doubleMissingValue};
                 }
             }
         }
     }
 
-    m_validFrontNodes = newValidFrontNodes;
+    m_validFrontNodes = m_newValidFrontNodes;
 }
 
 void meshkernel::CurvilinearGridFromSplines::ComputeMaximumGridLayerGrowTime(const std::vector<Point>& coordinates,
                                                                              const std::vector<Point>& velocities,
-                                                                             std::vector<double>& maximumGridLayerGrowTime) const
+                                                                             std::vector<double>& maximumGridLayerGrowTime)
 {
-    std::vector<double> edgeWidth(coordinates.size() - 1);
-    std::vector<double> edgeIncrement(coordinates.size() - 1);
+    m_edgeWidth.assign(coordinates.size() - 1, 0.0);
+    m_edgeIncrement.assign(coordinates.size() - 1, 0.0);
     const double minEdgeWidth = 1e-8;
     const double dt = 1.0;
     for (auto i = 0; i < coordinates.size() - 1; ++i)
@@ -752,9 +780,9 @@ void meshkernel::CurvilinearGridFromSplines::ComputeMaximumGridLayerGrowTime(con
             continue;
         }
 
-        edgeWidth[i] = ComputeDistance(coordinates[i], coordinates[i + 1], m_splines->m_projection);
+        m_edgeWidth[i] = ComputeDistance(coordinates[i], coordinates[i + 1], m_splines->m_projection);
 
-        if (edgeWidth[i] < minEdgeWidth)
+        if (m_edgeWidth[i] < minEdgeWidth)
         {
             continue;
         }
@@ -762,15 +790,15 @@ void meshkernel::CurvilinearGridFromSplines::ComputeMaximumGridLayerGrowTime(con
         Point firstPointIncremented(coordinates[i] + velocities[i] * dt);
         Point secondPointIncremented(coordinates[i + 1] + velocities[i + 1] * dt);
 
-        edgeIncrement[i] = InnerProductTwoSegments(coordinates[i], coordinates[i + 1], firstPointIncremented, secondPointIncremented, m_splines->m_projection) / edgeWidth[i] - edgeWidth[i];
-        edgeIncrement[i] = edgeIncrement[i] / dt;
+        m_edgeIncrement[i] = InnerProductTwoSegments(coordinates[i], coordinates[i + 1], firstPointIncremented, secondPointIncremented, m_splines->m_projection) / m_edgeWidth[i] - m_edgeWidth[i];
+        m_edgeIncrement[i] = m_edgeIncrement[i] / dt;
     }
 
     for (auto i = 0; i < coordinates.size() - 1; ++i)
     {
-        if (edgeIncrement[i] < 0.0)
+        if (m_edgeIncrement[i] < 0.0)
         {
-            maximumGridLayerGrowTime[i] = -edgeWidth[i] / edgeIncrement[i];
+            maximumGridLayerGrowTime[i] = -m_edgeWidth[i] / m_edgeIncrement[i];
         }
     }
 }
@@ -778,7 +806,7 @@ void meshkernel::CurvilinearGridFromSplines::ComputeMaximumGridLayerGrowTime(con
 void meshkernel::CurvilinearGridFromSplines::CopyVelocitiesToFront(size_t layerIndex,
                                                                    const std::vector<Point>& previousVelocities,
                                                                    size_t& numFrontPoints,
-                                                                   std::vector<std::vector<size_t>>& gridPointsIndices,
+                                                                   std::vector<std::array<size_t, 2>>& gridPointsIndices,
                                                                    std::vector<Point>& frontGridPoints,
                                                                    std::vector<Point>& velocities)
 {
@@ -841,19 +869,33 @@ void meshkernel::CurvilinearGridFromSplines::CopyVelocitiesToFront(size_t layerI
     }
 }
 
-void meshkernel::CurvilinearGridFromSplines::FindFront(std::vector<std::vector<size_t>>& gridPointsIndices,
+void meshkernel::CurvilinearGridFromSplines::FindFront(size_t firstChangedLayer,
+                                                       std::vector<std::array<size_t, 2>>& gridPointsIndices,
                                                        std::vector<Point>& frontGridPoints,
                                                        size_t& numFrontPoints)
 {
+    const auto numColumns = m_gridPoints[0].size() - 2;
+    if (m_frontPosition.size() != numColumns)
+    {
+        m_frontPosition.assign(numColumns, static_cast<int>(m_gridPoints.size()));
+        firstChangedLayer = 0;
+    }
 
-    std::vector<int> frontPosition(m_gridPoints[0].size() - 2, static_cast<int>(m_gridPoints.size()));
-    for (auto m = 0; m < frontPosition.size(); ++m)
+    // the layers below the first changed layer are unchanged: a front position below it is still valid,
+    // otherwise the scan resumes at the first changed layer. The layers above the active one are not grown yet,
+    // so only a few layers are scanned in each column
+    for (auto m = 0; m < numColumns; ++m)
     {
-        for (auto n = 0; n < m_gridPoints.size(); ++n)
+        if (m_frontPosition[m] + 1 < static_cast<int>(firstChangedLayer))
+        {
+            continue;
+        }
+        m_frontPosition[m] = static_cast<int>(m_gridPoints.size());
+        for (auto n = firstChangedLayer; n < m_gridPoints.size(); ++n)
         {
             if (!m_gridPoints[n][m].IsValid() || !m_gridPoints[n][m + 1].IsValid())
             {
-                frontPosition[m] = n - 1;
+                m_frontPosition[m] = static_cast<int>(n) - 1;
                 break;
             }
         }
@@ -875,9 +917,9 @@ void meshkernel::CurvilinearGridFromSplines::FindFront(std::vector<std::vector<s
     }
     else
     {
-        previousFrontPosition = frontPosition[currentLeftIndex];
-        frontGridPoints[numFrontPoints] = m_gridPoints[0][frontPosition[0]];
-        gridPointsIndices[numFrontPoints][0] = frontPosition[0];
+        previousFrontPosition = m_frontPosition[currentLeftIndex];
+        frontGridPoints[numFrontPoints] = m_gridPoints[0][m_frontPosition[0]];
+        gridPointsIndices[numFrontPoints][0] = m_frontPosition[0];
         gridPointsIndices[numFrontPoints][1] = 0;
         numFrontPoints++;
     }
@@ -885,7 +927,7 @@ void meshkernel::CurvilinearGridFromSplines::FindFront(std::vector<std::vector<s
     for (auto m = 0; m < m_gridPoints[0].size() - 2; ++m)
     {
         GetNeighbours(m_gridPoints[0], m, currentLeftIndex, currentRightIndex);
-        const auto currentFrontPosition = frontPosition[m];
+        const auto currentFrontPosition = m_frontPosition[m];
         if (currentFrontPosition >= 0)
         {
             if (previousFrontPosition == -1)
@@ -1533,16 +1575,15 @@ void meshkernel::CurvilinearGridFromSplines::FindNearestCrossSplines(size_t s,
 
 /// get_crosssplines
 /// compute the intersection of two splines, one must have only two nodes
-void meshkernel::CurvilinearGridFromSplines::GetSplineIntersections(size_t index)
+void meshkernel::CurvilinearGridFromSplines::GetSplineIntersections(size_t index, const std::vector<size_t>& crossingCandidates)
 {
     m_numCrossingSplines[index] = 0;
-    const auto numSplines = m_splines->GetNumSplines();
     std::fill(m_crossingSplinesIndices[index].begin(), m_crossingSplinesIndices[index].end(), 0);
     std::fill(m_isLeftOriented[index].begin(), m_isLeftOriented[index].end(), true);
     std::fill(m_crossSplineCoordinates[index].begin(), m_crossSplineCoordinates[index].end(), std::numeric_limits<double>::max());
     std::fill(m_cosCrossingAngle[index].begin(), m_cosCrossingAngle[index].end(), doubleMissingValue);
 
-    for (auto s = 0; s < numSplines; ++s)
+    for (const auto s : crossingCandidates)
     {
         // a crossing is a spline with 2 nodes and another with more than 2 nodes
         const auto numSplineNodesS = m_splines->m_splineNodes[s].size();
@@ -1717,9 +1758,10 @@ void meshkernel::CurvilinearGridFromSplines::ComputeSplineProperties(const bool
 {
     AllocateSplinesProperties();
 
+    const auto crossingCandidates = m_splines->FindCrossingCandidates();
     for (size_t s = 0; s < m_splines->GetNumSplines(); ++s)
     {
-        GetSplineIntersections(s);
+        GetSplineIntersections(s, crossingCandidates[s]);
     }
     // select all non-cross splines only
     for (size_t s = 0; s < m_splines->GetNumSplines(); ++s)
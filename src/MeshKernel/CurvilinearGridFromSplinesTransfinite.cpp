@@ -33,6 +33,7 @@
 #include <MeshKernel/CurvilinearGridFromSplinesTransfinite.hpp>
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Operations.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 #include <MeshKernel/Splines.hpp>
 
 meshkernel::CurvilinearGridFromSplinesTransfinite::CurvilinearGridFromSplinesTransfinite(std::shared_ptr<Splines> splines,
@@ -92,6 +93,8 @@ void meshkernel::CurvilinearGridFromSplinesTransfinite::Compute(CurvilinearGrid&
     size_t numNSplines = 0;
     for (auto splineIndex = 0; splineIndex < numSplines; splineIndex++)
     {
+        ProgressMonitor::Report(static_cast<double>(splineIndex) / static_cast<double>(numSplines));
+
         size_t numIntersections = 0;
 
         for (const auto& value : m_splineIntersectionRatios[splineIndex])
@@ -155,82 +158,142 @@ void meshkernel::CurvilinearGridFromSplinesTransfinite::Compute(CurvilinearGrid&
         {
             if (splineIndex < m_numMSplines)
             {
-                curvilinearGrid.m_grid[i][position] = points[index];
+                curvilinearGrid.Node(i, position) = points[index];
             }
             else
             {
-                curvilinearGrid.m_grid[position][i] = points[index];
+                curvilinearGrid.Node(position, i) = points[index];
             }
             index++;
         }
     }
 
+    if (numMSplines < 2 || numNSplines < 2)
+    {
+        return;
+    }
+
+    const auto numMPatches = numMSplines - 1;
+    const auto numNPatches = numNSplines - 1;
+
+    // The patches are independent when their boundaries are fully discretized: each patch then
+    // only reads its valid boundary nodes and only writes its own interior nodes
+    if (ArePatchBoundariesValid(curvilinearGrid, numMPatches, numNPatches))
+    {
+        const auto numPatches = static_cast<int>(numMPatches * numNPatches);
+#pragma omp parallel for
+        for (auto patch = 0; patch < numPatches; patch++)
+        {
+            std::vector<Point> patchSideOne(numNPoints);
+            std::vector<Point> patchSideTwo(numNPoints);
+            std::vector<Point> patchSideThree(numMPoints);
+            std::vector<Point> patchSideFour(numMPoints);
+            FillPatch(patch / numNPatches, patch % numNPatches, patchSideOne, patchSideTwo, patchSideThree, patchSideFour, curvilinearGrid);
+        }
+        return;
+    }
+
+    // Otherwise the patches are filled in order, a patch can use the nodes interpolated by the previous ones
     sideOne.resize(numNPoints);
     sideTwo.resize(numNPoints);
     sideThree.resize(numMPoints);
     sideFour.resize(numMPoints);
-    for (auto i = 0; i < numMSplines - 1; i++)
+    for (auto i = 0; i < numMPatches; i++)
+    {
+        for (auto j = 0; j < numNPatches; j++)
+        {
+            FillPatch(i, j, sideOne, sideTwo, sideThree, sideFour, curvilinearGrid);
+        }
+    }
+}
+
+bool meshkernel::CurvilinearGridFromSplinesTransfinite::ArePatchBoundariesValid(const CurvilinearGrid& curvilinearGrid,
+                                                                                size_t numMPatches,
+                                                                                size_t numNPatches) const
+{
+    const auto lastM = numMPatches * m_numM;
+    const auto lastN = numNPatches * m_numN;
+    for (auto m = 0; m <= lastM; m++)
     {
-        for (auto j = 0; j < numNSplines - 1; j++)
+        for (auto n = 0; n <= lastN; n++)
         {
-            //Fill each block of the interpolation plane
-            for (auto k = 0; k < numMPoints; k++)
+            const auto isOnPatchBoundary = m % m_numM == 0 || n % m_numN == 0;
+            if (isOnPatchBoundary && !curvilinearGrid.Node(m, n).IsValid())
             {
-                for (auto l = 0; l < numNPoints; l++)
-                {
-                    const auto m = i * m_numM + k;
-                    const auto n = j * m_numN + l;
+                return false;
+            }
+        }
+    }
+    return true;
+}
 
-                    // We are at the boundary
-                    if (!curvilinearGrid.m_grid[m][n].IsValid())
-                    {
-                        continue;
-                    }
+void meshkernel::CurvilinearGridFromSplinesTransfinite::FillPatch(size_t mPatch,
+                                                                  size_t nPatch,
+                                                                  std::vector<Point>& sideOne,
+                                                                  std::vector<Point>& sideTwo,
+                                                                  std::vector<Point>& sideThree,
+                                                                  std::vector<Point>& sideFour,
+                                                                  CurvilinearGrid& curvilinearGrid) const
+{
+    const auto numMPoints = m_numM + 1;
+    const auto numNPoints = m_numN + 1;
 
-                    if (k == 0)
-                    {
-                        sideOne[l] = curvilinearGrid.m_grid[m][n];
-                    }
-                    if (k == m_numM)
-                    {
-                        sideTwo[l] = curvilinearGrid.m_grid[m][n];
-                    }
-                    if (l == 0)
-                    {
-                        sideThree[k] = curvilinearGrid.m_grid[m][n];
-                    }
-                    if (l == m_numN)
-                    {
-                        sideFour[k] = curvilinearGrid.m_grid[m][n];
-                    }
-                }
+    //Fill each block of the interpolation plane
+    for (auto k = 0; k < numMPoints; k++)
+    {
+        for (auto l = 0; l < numNPoints; l++)
+        {
+            const auto m = mPatch * m_numM + k;
+            const auto n = nPatch * m_numN + l;
+
+            // We are at the boundary
+            if (!curvilinearGrid.Node(m, n).IsValid())
+            {
+                continue;
             }
 
-            // call transfinite interpolation
-            const auto interpolationResult = DiscretizeTransfinite(sideOne,
-                                                                   sideTwo,
-                                                                   sideThree,
-                                                                   sideFour,
-                                                                   m_splines->m_projection,
-                                                                   m_numM,
-                                                                   m_numN);
-
-            // assign the points
-            for (auto k = 0; k < numMPoints; k++)
+            if (k == 0)
             {
-                for (auto l = 0; l < numNPoints; l++)
-                {
-                    const auto m = i * m_numM + k;
-                    const auto n = j * m_numN + l;
+                sideOne[l] = curvilinearGrid.Node(m, n);
+            }
+            if (k == m_numM)
+            {
+                sideTwo[l] = curvilinearGrid.Node(m, n);
+            }
+            if (l == 0)
+            {
+                sideThree[k] = curvilinearGrid.Node(m, n);
+            }
+            if (l == m_numN)
+            {
+                sideFour[k] = curvilinearGrid.Node(m, n);
+            }
+        }
+    }
 
-                    if (curvilinearGrid.m_grid[m][n].IsValid())
-                    {
-                        continue;
-                    }
+    // call transfinite interpolation
+    const auto interpolationResult = DiscretizeTransfinite(sideOne,
+                                                           sideTwo,
+                                                           sideThree,
+                                                           sideFour,
+                                                           m_splines->m_projection,
+                                                           m_numM,
+                                                           m_numN);
+
+    // assign the points
+    for (auto k = 0; k < numMPoints; k++)
+    {
+        for (auto l = 0; l < numNPoints; l++)
+        {
+            const auto m = mPatch * m_numM + k;
+            const auto n = nPatch * m_numN + l;
 
-                    curvilinearGrid.m_grid[m][n] = interpolationResult[k][l];
-                }
+            if (curvilinearGrid.Node(m, n).IsValid())
+            {
+                continue;
             }
+
+            curvilinearGrid.Node(m, n) = interpolationResult.Node(k, l);
         }
     }
 }
@@ -327,10 +390,17 @@ void meshkernel::CurvilinearGridFromSplinesTransfinite::ComputeIntersections()
     m_splineIntersectionRatios.resize(numSplines);
     std::fill(m_splineIntersectionRatios.begin(), m_splineIntersectionRatios.end(), std::vector<double>(numSplines, 0.0));
 
+    // Reversing the splines below does not change which splines may cross
+    const auto crossingCandidates = m_splines->FindCrossingCandidates();
     for (auto i = 0; i < numSplines; i++)
     {
-        for (auto j = i + 1; j < numSplines; j++)
+        for (const auto j : crossingCandidates[i])
         {
+            if (j <= i)
+            {
+                continue;
+            }
+
             double crossProductIntersection;
             Point intersectionPoint;
             double firstSplineRatio;
@@ -358,6 +428,7 @@ void meshkernel::CurvilinearGridFromSplinesTransfinite::ComputeIntersections()
                     {
                         // switch j
                         SwapVectorElements(m_splines->m_splineNodes[j]);
+                        m_splines->InvalidateArcLengthTable(j);
                         secondSplineRatio = static_cast<double>(numNodesJSpline) - 1.0 - secondSplineRatio;
                     }
                 }
@@ -368,6 +439,7 @@ void meshkernel::CurvilinearGridFromSplinesTransfinite::ComputeIntersections()
                     {
                         // switch i
                         SwapVectorElements(m_splines->m_splineNodes[i]);
+                        m_splines->InvalidateArcLengthTable(i);
                         firstSplineRatio = static_cast<double>(numNodesISpline) - 1.0 - firstSplineRatio;
                     }
                 }
@@ -548,6 +620,8 @@ bool meshkernel::CurvilinearGridFromSplinesTransfinite::OrderSplines(size_t star
                 }
                 //they must be swapped
                 SwapRows(m_splines->m_splineNodes, j, k);
+                m_splines->InvalidateArcLengthTable(j);
+                m_splines->InvalidateArcLengthTable(k);
                 SwapRows(m_splineIntersectionRatios, j, k);
                 SwapColumns(m_splineIntersectionRatios, j, k);
 
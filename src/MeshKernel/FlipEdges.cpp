@@ -33,6 +33,7 @@
 #include <MeshKernel/LandBoundaries.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/Operations.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 
 meshkernel::FlipEdges::FlipEdges(std::shared_ptr<Mesh2D> mesh,
                                  std::shared_ptr<LandBoundaries> landBoundary,
@@ -63,12 +64,20 @@ void meshkernel::FlipEdges::Compute() const
     const auto numEdges = m_mesh->GetNumEdges();
     size_t numFlippedEdges = sizetMissingValue;
 
+    bool isCancelled = false;
     for (auto iter = 0; iter < MaxIter; iter++)
     {
         if (numFlippedEdges == 0)
         {
             break;
         }
+
+        // a cancelled flipping stops between two sweeps, the mesh is still administrated below
+        isCancelled = !ProgressMonitor::TryReport(static_cast<double>(iter) / static_cast<double>(MaxIter));
+        if (isCancelled)
+        {
+            break;
+        }
         numFlippedEdges = 0;
 
         for (auto e = 0; e < numEdges; e++)
@@ -129,6 +138,7 @@ void meshkernel::FlipEdges::Compute() const
             // Flip the edges
             m_mesh->m_edges[e].first = nodeLeft;
             m_mesh->m_edges[e].second = nodeRight;
+            m_mesh->m_boundaryLoopsRequireUpdate = true;
             numFlippedEdges++;
 
             // Find the other edges
@@ -234,13 +244,18 @@ void meshkernel::FlipEdges::Compute() const
         }
     }
 
-    if (numFlippedEdges != 0)
+    if (numFlippedEdges != 0 && !isCancelled)
     {
         throw AlgorithmError("FlipEdges::Compute: Could not complete, there are still edges left to be flipped.");
     }
 
     // Perform mesh administration
     m_mesh->Administrate(Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+
+    if (isCancelled)
+    {
+        throw OperationCancelledError("FlipEdges::Compute: The operation has been cancelled.");
+    }
 }
 
 void meshkernel::FlipEdges::DeleteEdgeFromNode(size_t edge, size_t firstNode) const
@@ -0,0 +1,156 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <MeshKernel/Instrumentation.hpp>
+
+namespace
+{
+    /// @brief The measurements of one thread, by name
+    struct ThreadEntries
+    {
+        std::mutex m_mutex;                                                             ///< Guards the entries while reporting
+        std::map<std::string, meshkernel::InstrumentationEntry, std::less<>> m_entries; ///< The entries
+    };
+
+    /// @brief The measurements of all threads
+    struct Registry
+    {
+        std::mutex m_mutex;                                    ///< Guards the threads
+        std::vector<std::shared_ptr<ThreadEntries>> m_threads; ///< The entries of each thread, kept after the thread ends
+    };
+
+    /// @brief Gets the measurements of all threads
+    /// @returns The registry
+    Registry& GetRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    /// @brief Gets the measurements of the calling thread, registered on first use
+    /// @returns The thread entries
+    ThreadEntries& GetThreadEntries()
+    {
+        thread_local const auto threadEntries = [] {
+            auto entries = std::make_shared<ThreadEntries>();
+            auto& registry = GetRegistry();
+            const std::scoped_lock lock(registry.m_mutex);
+            registry.m_threads.emplace_back(entries);
+            return entries;
+        }();
+        return *threadEntries;
+    }
+
+    /// @brief Finds an entry of a thread, adds it if it does not exist
+    /// @param[in] threadEntries The thread entries
+    /// @param[in] name The entry name
+    /// @returns The entry
+    meshkernel::InstrumentationEntry& FindOrAddEntry(ThreadEntries& threadEntries, std::string_view name)
+    {
+        auto entry = threadEntries.m_entries.find(name);
+        if (entry == threadEntries.m_entries.end())
+        {
+            meshkernel::InstrumentationEntry newEntry;
+            newEntry.m_name = name;
+            entry = threadEntries.m_entries.emplace(newEntry.m_name, newEntry).first;
+        }
+        return entry->second;
+    }
+} // namespace
+
+void meshkernel::Instrumentation::Record(std::string_view name, double seconds)
+{
+    auto& threadEntries = GetThreadEntries();
+    const std::scoped_lock lock(threadEntries.m_mutex);
+
+    auto& entry = FindOrAddEntry(threadEntries, name);
+    entry.m_count++;
+    entry.m_totalSeconds += seconds;
+    entry.m_maxSeconds = std::max(entry.m_maxSeconds, seconds);
+}
+
+void meshkernel::Instrumentation::Count(std::string_view name, size_t increment)
+{
+    auto& threadEntries = GetThreadEntries();
+    const std::scoped_lock lock(threadEntries.m_mutex);
+
+    FindOrAddEntry(threadEntries, name).m_count += increment;
+}
+
+std::vector<meshkernel::InstrumentationEntry> meshkernel::Instrumentation::GetReport()
+{
+    std::map<std::string, InstrumentationEntry> mergedEntries;
+    {
+        auto& registry = GetRegistry();
+        const std::scoped_lock registryLock(registry.m_mutex);
+        for (const auto& threadEntries : registry.m_threads)
+        {
+            const std::scoped_lock threadLock(threadEntries->m_mutex);
+            for (const auto& [name, entry] : threadEntries->m_entries)
+            {
+                auto& mergedEntry = mergedEntries[name];
+                mergedEntry.m_name = name;
+                mergedEntry.m_count += entry.m_count;
+                mergedEntry.m_totalSeconds += entry.m_totalSeconds;
+                mergedEntry.m_maxSeconds = std::max(mergedEntry.m_maxSeconds, entry.m_maxSeconds);
+            }
+        }
+    }
+
+    std::vector<InstrumentationEntry> report;
+    report.reserve(mergedEntries.size());
+    for (auto& [name, entry] : mergedEntries)
+    {
+        report.emplace_back(std::move(entry));
+    }
+    std::stable_sort(report.begin(), report.end(), [](const auto& first, const auto& second) { return first.m_totalSeconds > second.m_totalSeconds; });
+    return report;
+}
+
+void meshkernel::Instrumentation::Reset()
+{
+    auto& registry = GetRegistry();
+    const std::scoped_lock registryLock(registry.m_mutex);
+
+    // the entries only referenced by the registry belong to threads that have ended
+    registry.m_threads.erase(std::remove_if(registry.m_threads.begin(),
+                                            registry.m_threads.end(),
+                                            [](const auto& threadEntries) { return threadEntries.use_count() == 1; }),
+                             registry.m_threads.end());
+
+    for (const auto& threadEntries : registry.m_threads)
+    {
+        const std::scoped_lock threadLock(threadEntries->m_mutex);
+        threadEntries->m_entries.clear();
+    }
+}
@@ -36,6 +36,7 @@
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/Polygons.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 
 namespace meshkernel
 {
@@ -174,6 +175,8 @@ namespace meshkernel
         // Loop over the segments of the land boundary and assign each node to the land boundary segment index
         for (auto landBoundarySegment = 0; landBoundarySegment < m_validLandBoundaries.size(); landBoundarySegment++)
         {
+            ProgressMonitor::CheckCancellation();
+
             size_t numPaths = 0;
             size_t numRejectedPaths = 0;
             MakePath(landBoundarySegment, numPaths, numRejectedPaths);
@@ -728,8 +731,8 @@ namespace meshkernel
             return landBoundaryNode;
         }
 
-        const auto firstMeshNode = m_mesh->m_nodes[m_mesh->m_edges[edge].first];
-        const auto secondMeshNode = m_mesh->m_nodes[m_mesh->m_edges[edge].second];
+        const Point firstMeshNode = m_mesh->m_nodes[m_mesh->m_edges[edge].first];
+        const Point secondMeshNode = m_mesh->m_nodes[m_mesh->m_edges[edge].second];
 
         const double meshEdgeLength = ComputeDistance(firstMeshNode, secondMeshNode, m_mesh->m_projection);
         const double distanceFactor = m_findOnlyOuterMeshBoundary ? m_closeToLandBoundaryFactor : m_closeWholeMeshFactor;
@@ -938,7 +941,7 @@ namespace meshkernel
                     continue;
                 }
 
-                const auto neighbouringNode = m_mesh->m_nodes[neighbouringNodeIndex];
+                const Point neighbouringNode = m_mesh->m_nodes[neighbouringNodeIndex];
 
                 const auto [neighbouringNodeDistance,
                             neighbouringNodeOnLandBoundary,
@@ -29,15 +29,17 @@
 #include "MeshKernel/Mesh.hpp"
 
 #include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 #include <MeshKernel/Operations.hpp>
 
 #include <MeshKernel/Entities.hpp>
+#include <cmath>
 #include <stdexcept>
 #include <vector>
 
-meshkernel::Mesh::Mesh(const std::vector<Edge>& edges,
-                       const std::vector<Point>& nodes,
-                       Projection projection) : m_nodes(nodes), m_edges(edges), m_projection(projection){};
+meshkernel::Mesh::Mesh(std::vector<Edge> edges,
+                       NodeCoordinates nodes,
+                       Projection projection) : m_nodes(std::move(nodes)), m_edges(std::move(edges)), m_projection(projection){};
 
 void meshkernel::Mesh::NodeAdministration()
 {
@@ -166,9 +168,11 @@ void meshkernel::Mesh::DeleteInvalidNodesAndEdges()
         secondNode = sizetMissingValue;
     }
 
+    // The nodes and the edges are renumbered
+    m_boundaryLoopsRequireUpdate = true;
+
     // Remove invalid nodes, without reducing capacity
-    const auto endNodeVector = std::remove_if(m_nodes.begin(), m_nodes.end(), [](const Point& n) { return !n.IsValid(); });
-    m_nodes.erase(endNodeVector, m_nodes.end());
+    m_nodes.RemoveInvalid();
     m_numNodes = m_nodes.size();
 
     // Remove invalid edges, without reducing capacity
@@ -256,6 +260,8 @@ void meshkernel::Mesh::MergeTwoNodes(size_t firstNodeIndex, size_t secondNodeInd
 
     m_nodesRTreeRequiresUpdate = true;
     m_edgesRTreeRequiresUpdate = true;
+    m_boundaryLoopsRequireUpdate = true;
+    m_facesRequireUpdate = true;
 }
 
 size_t meshkernel::Mesh::ConnectNodes(size_t startNode, size_t endNode)
@@ -274,6 +280,8 @@ size_t meshkernel::Mesh::ConnectNodes(size_t startNode, size_t endNode)
     m_numEdges++;
 
     m_edgesRTreeRequiresUpdate = true;
+    m_boundaryLoopsRequireUpdate = true;
+    m_facesRequireUpdate = true;
 
     return newEdgeIndex;
 }
@@ -295,6 +303,7 @@ size_t meshkernel::Mesh::InsertNode(const Point& newPoint)
     m_nodesNumEdges[newNodeIndex] = 0;
 
     m_nodesRTreeRequiresUpdate = true;
+    m_facesRequireUpdate = true;
 
     return newNodeIndex;
 }
@@ -328,23 +337,61 @@ void meshkernel::Mesh::DeleteEdge(size_t edge)
     m_edges[edge].second = sizetMissingValue;
 
     m_edgesRTreeRequiresUpdate = true;
+    m_boundaryLoopsRequireUpdate = true;
+    m_facesRequireUpdate = true;
 }
 
 void meshkernel::Mesh::ComputeEdgesLengths()
 {
     auto const numEdges = GetNumEdges();
     m_edgeLengths.resize(numEdges, doubleMissingValue);
+
+    if (m_projection != Projection::cartesian)
+    {
+        for (auto e = 0; e < numEdges; e++)
+        {
+            auto const first = m_edges[e].first;
+            auto const second = m_edges[e].second;
+            m_edgeLengths[e] = ComputeDistance(m_nodes[first], m_nodes[second], m_projection);
+        }
+        return;
+    }
+
+    // cartesian: no projection dispatch per edge, only the coordinate arrays are streamed
+    const auto* const nodex = m_nodes.GetX().data();
+    const auto* const nodey = m_nodes.GetY().data();
     for (auto e = 0; e < numEdges; e++)
     {
         auto const first = m_edges[e].first;
         auto const second = m_edges[e].second;
-        m_edgeLengths[e] = ComputeDistance(m_nodes[first], m_nodes[second], m_projection);
+        if (IsEqual(nodex[first], doubleMissingValue) || IsEqual(nodey[first], doubleMissingValue) ||
+            IsEqual(nodex[second], doubleMissingValue) || IsEqual(nodey[second], doubleMissingValue))
+        {
+            m_edgeLengths[e] = 0.0;
+            continue;
+        }
+        const auto dx = nodex[second] - nodex[first];
+        const auto dy = nodey[second] - nodey[first];
+        m_edgeLengths[e] = std::sqrt(dx * dx + dy * dy);
     }
 }
 
 void meshkernel::Mesh::ComputeEdgesCenters()
 {
-    m_edgesCenters = ComputeEdgeCenters(m_nodes, m_edges);
+    const auto* const nodex = m_nodes.GetX().data();
+    const auto* const nodey = m_nodes.GetY().data();
+
+    m_edgesCenters.clear();
+    m_edgesCenters.reserve(m_edges.size());
+    for (const auto& edge : m_edges)
+    {
+        if (edge.first == sizetMissingValue || edge.second == sizetMissingValue)
+        {
+            continue;
+        }
+        m_edgesCenters.emplace_back((nodex[edge.first] + nodex[edge.second]) * 0.5,
+                                    (nodey[edge.first] + nodey[edge.second]) * 0.5);
+    }
 }
 
 size_t meshkernel::Mesh::FindCommonNode(size_t firstEdgeIndex, size_t secondEdgeIndex) const
@@ -598,6 +645,23 @@ void meshkernel::Mesh::BuildTree(MeshLocations meshLocation)
     }
 }
 
+void meshkernel::Mesh::AccumulateMemoryUsage(MemoryUsage& memoryUsage) const
+{
+    memoryUsage.AddVectors("Mesh nodes", m_nodes.GetX(), m_nodes.GetY(), m_nodesEdges, m_nodesNumEdges, m_nodeMask, m_nodesNodes, m_nodesTypes);
+    memoryUsage.AddVectors("Mesh edges", m_edges, m_edgesFaces, m_edgesNumFaces, m_edgeLengths, m_edgeMask, m_edgesCenters);
+    memoryUsage.AddVectors("Mesh faces", m_facesNodes, m_numFacesNodes, m_facesEdges, m_facesCircumcenters, m_facesMassCenters, m_faceArea);
+    memoryUsage.Add("Mesh R-trees", m_nodesRTree.GetMemoryUsage() + m_edgesRTree.GetMemoryUsage() + m_facesRTree.GetMemoryUsage());
+}
+
+void meshkernel::Mesh::ReleaseCaches()
+{
+    m_nodesRTree.Clear();
+    m_edgesRTree.Clear();
+    m_facesRTree.Clear();
+    m_nodesRTreeRequiresUpdate = true;
+    m_edgesRTreeRequiresUpdate = true;
+}
+
 void meshkernel::Mesh::SearchNearestNeighbors(Point point, MeshLocations meshLocation)
 {
     BuildTree(meshLocation);
@@ -678,20 +742,12 @@ size_t meshkernel::Mesh::GetNearestNeighborIndex(size_t index, MeshLocations mes
 
 void meshkernel::Mesh::AdministrateNodesEdges()
 {
-    DeleteInvalidNodesAndEdges();
+    MESHKERNEL_TIME_SCOPE("Mesh::AdministrateNodesEdges");
 
-    if (m_nodesRTreeRequiresUpdate && !m_nodesRTree.Empty())
-    {
-        m_nodesRTree.BuildTree(m_nodes);
-        m_nodesRTreeRequiresUpdate = false;
-    }
+    m_facesRequireUpdate = true;
+    DeleteInvalidNodesAndEdges();
 
-    if (m_edgesRTreeRequiresUpdate && !m_edgesRTree.Empty())
-    {
-        ComputeEdgesCenters();
-        m_edgesRTree.BuildTree(m_edgesCenters);
-        m_edgesRTreeRequiresUpdate = false;
-    }
+    UpdateRTrees();
 
     // return if there are no nodes or no edges
     if (m_numNodes == 0 || m_numEdges == 0)
@@ -713,6 +769,22 @@ void meshkernel::Mesh::AdministrateNodesEdges()
     }
 }
 
+void meshkernel::Mesh::UpdateRTrees()
+{
+    if (m_nodesRTreeRequiresUpdate && !m_nodesRTree.Empty())
+    {
+        m_nodesRTree.BuildTree(m_nodes);
+        m_nodesRTreeRequiresUpdate = false;
+    }
+
+    if (m_edgesRTreeRequiresUpdate && !m_edgesRTree.Empty())
+    {
+        ComputeEdgesCenters();
+        m_edgesRTree.BuildTree(m_edgesCenters);
+        m_edgesRTreeRequiresUpdate = false;
+    }
+}
+
 double meshkernel::Mesh::ComputeMaxLengthSurroundingEdges(size_t node)
 {
 
@@ -31,6 +31,10 @@
 #include <MeshKernel/Entities.hpp>
 #include <vector>
 
-meshkernel::Mesh1D::Mesh1D(const std::vector<Edge>& edges,
+meshkernel::Mesh1D::Mesh1D(std::vector<Edge> edges,
                            const std::vector<Point>& nodes,
-                           Projection projection) : Mesh(edges, nodes, projection){};
\ No newline at end of file
+                           Projection projection) : Mesh(std::move(edges), NodeCoordinates(nodes), projection){};
+
+meshkernel::Mesh1D::Mesh1D(std::vector<Edge> edges,
+                           NodeCoordinates nodes,
+                           Projection projection) : Mesh(std::move(edges), std::move(nodes), projection){};
\ No newline at end of file
@@ -31,22 +31,32 @@
 #include <initializer_list>
 #include <numeric>
 #include <stdexcept>
+#include <tuple>
 #include <vector>
 
 #include <MeshKernel/Constants.hpp>
 #include <MeshKernel/CurvilinearGrid.hpp>
 #include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/Polygons.hpp>
 #include <MeshKernel/RTree.hpp>
+#include <MeshKernel/TriangulationTiles.hpp>
 #include <MeshKernel/TriangulationWrapper.hpp>
 #include <MeshKernelApi/MakeMeshParameters.hpp>
 
-meshkernel::Mesh2D::Mesh2D(const std::vector<Edge>& edges,
+meshkernel::Mesh2D::Mesh2D(std::vector<Edge> edges,
                            const std::vector<Point>& nodes,
                            Projection projection,
-                           AdministrationOptions administration) : Mesh(edges, nodes, projection)
+                           AdministrationOptions administration) : Mesh2D(std::move(edges), NodeCoordinates(nodes), projection, administration)
+{
+}
+
+meshkernel::Mesh2D::Mesh2D(std::vector<Edge> edges,
+                           NodeCoordinates nodes,
+                           Projection projection,
+                           AdministrationOptions administration) : Mesh(std::move(edges), std::move(nodes), projection)
 {
 
     Administrate(administration);
@@ -58,6 +68,8 @@ meshkernel::Mesh2D::Mesh2D(const std::vector<Edge>& edges,
 
 void meshkernel::Mesh2D::Administrate(AdministrationOptions administrationOption)
 {
+    MESHKERNEL_TIME_SCOPE("Mesh2D::Administrate");
+
     AdministrateNodesEdges();
 
     if (administrationOption == AdministrationOptions::AdministrateMeshEdges)
@@ -94,96 +106,268 @@ void meshkernel::Mesh2D::Administrate(AdministrationOptions administrationOption
 
     // classify node types
     ClassifyNodes();
+
+    m_facesRequireUpdate = false;
 }
 
 meshkernel::Mesh2D::Mesh2D(const CurvilinearGrid& curvilinearGrid, Projection projection)
 {
-    if (curvilinearGrid.m_grid.empty())
+    if (curvilinearGrid.IsEmpty())
     {
         throw std::invalid_argument("Mesh2D::Mesh2D: The curvilinear grid is empty.");
     }
 
-    std::vector<Point> nodes(curvilinearGrid.m_grid.size() * curvilinearGrid.m_grid[0].size());
-    std::vector<Edge> edges(curvilinearGrid.m_grid.size() * (curvilinearGrid.m_grid[0].size() - 1) + (curvilinearGrid.m_grid.size() - 1) * curvilinearGrid.m_grid[0].size());
-    std::vector<std::vector<size_t>> indices(curvilinearGrid.m_grid.size(), std::vector<size_t>(curvilinearGrid.m_grid[0].size(), sizetMissingValue));
+    const auto numMNodes = curvilinearGrid.GetNumMNodes();
+    const auto numNNodes = curvilinearGrid.GetNumNNodes();
+    const auto isValid = [&curvilinearGrid](size_t m, size_t n) { return curvilinearGrid.Node(m, n).IsValid(); };
 
-    size_t ind = 0;
-    for (auto m = 0; m < curvilinearGrid.m_grid.size(); m++)
+    // Only the nodes connected to at least one valid neighbour are kept,
+    // so the node administration does not need to renumber them.
+    // The indices are assigned first, so nodes and edges are allocated with their exact size
+    size_t numNodes = 0;
+    std::vector<size_t> nodeIndices(numMNodes * numNNodes, sizetMissingValue);
+    for (auto m = 0; m < numMNodes; m++)
     {
-        for (auto n = 0; n < curvilinearGrid.m_grid[0].size(); n++)
+        for (auto n = 0; n < numNNodes; n++)
         {
-            if (curvilinearGrid.m_grid[m][n].IsValid())
+            if (!isValid(m, n))
             {
-                nodes[ind] = curvilinearGrid.m_grid[m][n];
-                indices[m][n] = ind;
-                ind++;
+                continue;
+            }
+
+            const auto isConnected = (m > 0 && isValid(m - 1, n)) ||
+                                     (m + 1 < numMNodes && isValid(m + 1, n)) ||
+                                     (n > 0 && isValid(m, n - 1)) ||
+                                     (n + 1 < numNNodes && isValid(m, n + 1));
+            if (isConnected)
+            {
+                nodeIndices[m * numNNodes + n] = numNodes;
+                numNodes++;
             }
         }
     }
-    nodes.resize(ind);
 
-    ind = 0;
-    for (auto m = 0; m < curvilinearGrid.m_grid.size() - 1; m++)
+    // The edges in m direction first, then the edges in n direction
+    size_t numEdges = 0;
+    std::vector<size_t> mEdgeIndices((numMNodes - 1) * numNNodes, sizetMissingValue);
+    for (auto m = 0; m + 1 < numMNodes; m++)
     {
-        for (auto n = 0; n < curvilinearGrid.m_grid[0].size(); n++)
+        for (auto n = 0; n < numNNodes; n++)
         {
-            if (indices[m][n] != sizetMissingValue && indices[m + 1][n] != sizetMissingValue)
+            if (nodeIndices[m * numNNodes + n] != sizetMissingValue && nodeIndices[(m + 1) * numNNodes + n] != sizetMissingValue)
             {
-                edges[ind].first = indices[m][n];
-                edges[ind].second = indices[m + 1][n];
-                ind++;
+                mEdgeIndices[m * numNNodes + n] = numEdges;
+                numEdges++;
             }
         }
     }
 
-    for (auto m = 0; m < curvilinearGrid.m_grid.size(); m++)
+    std::vector<size_t> nEdgeIndices(numMNodes * (numNNodes - 1), sizetMissingValue);
+    for (auto m = 0; m < numMNodes; m++)
     {
-        for (auto n = 0; n < curvilinearGrid.m_grid[0].size() - 1; n++)
+        for (auto n = 0; n + 1 < numNNodes; n++)
         {
-            if (indices[m][n] != sizetMissingValue && indices[m][n + 1] != sizetMissingValue)
+            if (nodeIndices[m * numNNodes + n] != sizetMissingValue && nodeIndices[m * numNNodes + n + 1] != sizetMissingValue)
             {
-                edges[ind].first = indices[m][n];
-                edges[ind].second = indices[m][n + 1];
-                ind++;
+                nEdgeIndices[m * (numNNodes - 1) + n] = numEdges;
+                numEdges++;
             }
         }
     }
-    edges.resize(ind);
 
-    m_nodesRTreeRequiresUpdate = true;
-    m_edgesRTreeRequiresUpdate = true;
+    // The topology is written in place, in the mesh members
+    m_nodes.resize(numNodes);
+    m_edges.resize(numEdges);
+    for (auto m = 0; m < numMNodes; m++)
+    {
+        for (auto n = 0; n < numNNodes; n++)
+        {
+            const auto node = nodeIndices[m * numNNodes + n];
+            if (node != sizetMissingValue)
+            {
+                m_nodes[node] = curvilinearGrid.Node(m, n);
+            }
+            if (m + 1 < numMNodes && mEdgeIndices[m * numNNodes + n] != sizetMissingValue)
+            {
+                m_edges[mEdgeIndices[m * numNNodes + n]] = {node, nodeIndices[(m + 1) * numNNodes + n]};
+            }
+            if (n + 1 < numNNodes && nEdgeIndices[m * (numNNodes - 1) + n] != sizetMissingValue)
+            {
+                m_edges[nEdgeIndices[m * (numNNodes - 1) + n]] = {node, nodeIndices[m * numNNodes + n + 1]};
+            }
+        }
+    }
+    m_projection = projection;
+
+    AdministrateNodesEdges();
+
+    // The faces are the grid cells, the recursive face search is only needed for folded grids
+    if (!AdministrateStructuredFaces(numMNodes, numNNodes, nodeIndices, mEdgeIndices, nEdgeIndices))
+    {
+        Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    }
+
+    //no polygon involved, so node mask is 1 everywhere
+    m_nodeMask.assign(m_nodes.size(), 1);
+}
+
+bool meshkernel::Mesh2D::AdministrateStructuredFaces(size_t numMNodes,
+                                                     size_t numNNodes,
+                                                     const std::vector<size_t>& nodeIndices,
+                                                     const std::vector<size_t>& mEdgeIndices,
+                                                     const std::vector<size_t>& nEdgeIndices)
+{
+    m_numFaces = 0;
+    m_edgesNumFaces.assign(m_edges.size(), 0);
+    m_edgesFaces.assign(m_edges.size(), std::vector<size_t>(2, sizetMissingValue));
+    m_facesNodes.clear();
+    m_facesEdges.clear();
+    m_faceArea.clear();
+    m_facesMassCenters.clear();
+    m_facesCircumcenters.clear();
+
+    if (m_numNodes == 0 || m_numEdges == 0 || numMNodes < 2 || numNNodes < 2)
+    {
+        m_numFacesNodes.clear();
+        return true;
+    }
+
+    const auto numCells = (numMNodes - 1) * (numNNodes - 1);
+    m_facesNodes.reserve(numCells);
+    m_facesEdges.reserve(numCells);
+    m_faceArea.reserve(numCells);
+    m_facesMassCenters.reserve(numCells);
+
+    std::vector<size_t> faceNodes(numNodesQuads);
+    std::vector<size_t> faceEdges(numNodesQuads);
+    bool isGridCounterClockWise = true;
+    for (auto m = 0; m + 1 < numMNodes; m++)
+    {
+        for (auto n = 0; n + 1 < numNNodes; n++)
+        {
+            // the cell nodes, each edge connects a node with the next one
+            faceNodes[0] = nodeIndices[m * numNNodes + n];
+            faceNodes[1] = nodeIndices[(m + 1) * numNNodes + n];
+            faceNodes[2] = nodeIndices[(m + 1) * numNNodes + n + 1];
+            faceNodes[3] = nodeIndices[m * numNNodes + n + 1];
+            if (std::any_of(faceNodes.begin(), faceNodes.end(), [](size_t node) { return node == sizetMissingValue; }))
+            {
+                continue;
+            }
+
+            faceEdges[0] = mEdgeIndices[m * numNNodes + n];
+            faceEdges[1] = nEdgeIndices[(m + 1) * (numNNodes - 1) + n];
+            faceEdges[2] = mEdgeIndices[m * numNNodes + n + 1];
+            faceEdges[3] = nEdgeIndices[m * (numNNodes - 1) + n];
+
+            m_polygonNodesCache.clear();
+            for (const auto& node : faceNodes)
+            {
+                m_polygonNodesCache.emplace_back(m_nodes[node]);
+            }
+            m_polygonNodesCache.emplace_back(m_polygonNodesCache.front());
+
+            double area;
+            Point centerOfMass;
+            bool isCounterClockWise;
+            FaceAreaAndCenterOfMass(m_polygonNodesCache, m_projection, area, centerOfMass, isCounterClockWise);
+
+            // degenerate cells are left to the face search
+            if (area <= minimumFaceArea)
+            {
+                return false;
+            }
+
+            // all cells must have the same orientation, otherwise the grid is folded
+            if (m_numFaces == 0)
+            {
+                isGridCounterClockWise = isCounterClockWise;
+            }
+            else if (isCounterClockWise != isGridCounterClockWise)
+            {
+                return false;
+            }
 
-    *this = Mesh2D(edges, nodes, projection, AdministrationOptions::AdministrateMeshEdges);
+            // faces are stored counterclockwise
+            if (!isCounterClockWise)
+            {
+                std::reverse(faceNodes.begin() + 1, faceNodes.end());
+                std::reverse(faceEdges.begin(), faceEdges.end());
+            }
+
+            for (const auto& edge : faceEdges)
+            {
+                m_edgesFaces[edge][m_edgesNumFaces[edge]] = m_numFaces;
+                m_edgesNumFaces[edge] += 1;
+            }
+            m_numFaces += 1;
+
+            m_facesNodes.emplace_back(faceNodes);
+            m_facesEdges.emplace_back(faceEdges);
+            m_faceArea.emplace_back(area);
+            m_facesMassCenters.emplace_back(centerOfMass);
+        }
+    }
+
+    m_numFacesNodes.assign(m_numFaces, numNodesQuads);
+
+    // find mesh circumcenters, the areas and mass centers are already computed from the cells
+    ComputeFaceCircumcentersMassCentersAndAreas(false);
+
+    // classify node types
+    ClassifyNodes();
+
+    m_facesRequireUpdate = false;
+
+    return true;
 }
 
-meshkernel::Mesh2D::Mesh2D(const std::vector<Point>& inputNodes, const Polygons& polygons, Projection projection)
+meshkernel::Mesh2D::Mesh2D(const std::vector<Point>& inputNodes, const Polygons& polygons, Projection projection, size_t maximumNodesPerTile)
 {
     m_projection = projection;
+
+    std::vector<Edge> edges;
+    if (maximumNodesPerTile > 0 && inputNodes.size() > maximumNodesPerTile)
+    {
+        edges = TriangulateNodesInTiles(inputNodes, polygons, maximumNodesPerTile);
+    }
+    else
+    {
+        edges = TriangulateNodes(inputNodes, polygons);
+    }
+
+    // The topology is set in place, no temporary mesh is administrated and assigned.
+    // The nodes are copied once into the coordinate arrays
+    m_nodes = inputNodes;
+    m_edges = std::move(edges);
+
+    Administrate(AdministrationOptions::AdministrateMeshEdges);
+
+    //no polygon involved, so node mask is 1 everywhere
+    m_nodeMask.assign(m_nodes.size(), 1);
+}
+
+std::vector<meshkernel::Edge> meshkernel::Mesh2D::TriangulateNodes(const std::vector<Point>& inputNodes, const Polygons& polygons) const
+{
     // compute triangulation
     TriangulationWrapper triangulationWrapper;
-    const auto numberOfTriangles = inputNodes.size() * 6 + 10;
     triangulationWrapper.Compute(inputNodes,
                                  TriangulationWrapper::TriangulationOptions::TriangulatePointsAndGenerateFaces,
-                                 0.0,
-                                 numberOfTriangles);
+                                 0.0);
 
     // For each triangle check
     // 1. Validity of its internal angles
     // 2. Is inside the polygon
     // If so we mark the edges and we add them m_edges
     std::vector<bool> edgeNodesFlag(triangulationWrapper.m_numEdges, false);
+    std::vector<size_t> faceNodes(numNodesInTriangle);
     for (auto i = 0; i < triangulationWrapper.m_numFaces; ++i)
     {
-        const auto goodTriangle = CheckTriangle(triangulationWrapper.m_faceNodes[i], inputNodes);
-
-        if (!goodTriangle)
+        for (auto j = 0; j < numNodesInTriangle; ++j)
         {
-            continue;
+            faceNodes[j] = triangulationWrapper.GetFaceNode(i, j);
         }
-        const Point approximateCenter = (inputNodes[triangulationWrapper.m_faceNodes[i][0]] + inputNodes[triangulationWrapper.m_faceNodes[i][1]] + inputNodes[triangulationWrapper.m_faceNodes[i][2]]) * oneThird;
-
-        const auto isTriangleInPolygon = polygons.IsPointInPolygon(approximateCenter, 0);
-        if (!isTriangleInPolygon)
+        if (!IsTriangleSelected(faceNodes, inputNodes, polygons))
         {
             continue;
         }
@@ -191,12 +375,11 @@ meshkernel::Mesh2D::Mesh2D(const std::vector<Point>& inputNodes, const Polygons&
         // mark all edges of this triangle as good ones
         for (auto j = 0; j < numNodesInTriangle; ++j)
         {
-            edgeNodesFlag[triangulationWrapper.m_faceEdges[i][j]] = true;
+            edgeNodesFlag[triangulationWrapper.GetFaceEdge(i, j)] = true;
         }
     }
 
-    // now add all points and all valid edges
-    m_nodes = inputNodes;
+    // now add all valid edges
     size_t validEdgesCount = 0;
     for (auto i = 0; i < triangulationWrapper.m_numEdges; ++i)
     {
@@ -212,15 +395,249 @@ meshkernel::Mesh2D::Mesh2D(const std::vector<Point>& inputNodes, const Polygons&
         if (!edgeNodesFlag[i])
             continue;
 
-        edges[validEdgesCount].first = triangulationWrapper.m_edgeNodes[i][0];
-        edges[validEdgesCount].second = triangulationWrapper.m_edgeNodes[i][1];
+        edges[validEdgesCount].first = triangulationWrapper.GetEdgeNode(i, 0);
+        edges[validEdgesCount].second = triangulationWrapper.GetEdgeNode(i, 1);
         validEdgesCount++;
     }
 
-    m_nodesRTreeRequiresUpdate = true;
-    m_edgesRTreeRequiresUpdate = true;
+    return edges;
+}
 
-    *this = Mesh2D(edges, inputNodes, projection, AdministrationOptions::AdministrateMeshEdges);
+std::vector<meshkernel::Edge> meshkernel::Mesh2D::TriangulateNodesInTiles(const std::vector<Point>& inputNodes,
+                                                                          const Polygons& polygons,
+                                                                          size_t maximumNodesPerTile) const
+{
+    const TriangulationTiles tiles(inputNodes, maximumNodesPerTile);
+
+    // each triangle of the triangulation of all nodes is kept by at most one tile, the one containing its circumcenter.
+    // Cocircular nodes, for example the corners of a regular grid cell, can be triangulated in several ways, their
+    // triangles share the circumcenter and are all kept by the same tile, so that the tiles never mix two of these ways
+    const auto numTiles = static_cast<int>(tiles.GetNumTiles());
+    std::vector<std::vector<std::array<size_t, 3>>> tilesTriangles(tiles.GetNumTiles());
+#pragma omp parallel for schedule(dynamic)
+    for (int t = 0; t < numTiles; ++t)
+    {
+        const auto& tilePoints = tiles.GetTilePoints(t);
+        if (tilePoints.size() < numNodesInTriangle)
+        {
+            continue;
+        }
+
+        std::vector<Point> tileNodes(tilePoints.size());
+        for (size_t i = 0; i < tilePoints.size(); ++i)
+        {
+            tileNodes[i] = inputNodes[tilePoints[i]];
+        }
+
+        TriangulationWrapper triangulationWrapper;
+        triangulationWrapper.Compute(tileNodes,
+                                     TriangulationWrapper::TriangulationOptions::TriangulatePointsAndGenerateFaces,
+                                     0.0);
+
+        auto& tileTriangles = tilesTriangles[t];
+        for (size_t f = 0; f < triangulationWrapper.m_numFaces; ++f)
+        {
+            const auto& firstNode = tileNodes[triangulationWrapper.GetFaceNode(f, 0)];
+            const auto& secondNode = tileNodes[triangulationWrapper.GetFaceNode(f, 1)];
+            const auto& thirdNode = tileNodes[triangulationWrapper.GetFaceNode(f, 2)];
+            if (!tiles.IsTriangleInTile(t, firstNode, secondNode, thirdNode) ||
+                tiles.GetTile(CircumcenterOfTriangle(firstNode, secondNode, thirdNode, Projection::cartesian)) != static_cast<size_t>(t))
+            {
+                continue;
+            }
+            tileTriangles.push_back({tilePoints[triangulationWrapper.GetFaceNode(f, 0)],
+                                     tilePoints[triangulationWrapper.GetFaceNode(f, 1)],
+                                     tilePoints[triangulationWrapper.GetFaceNode(f, 2)]});
+        }
+    }
+
+    size_t numTriangles = 0;
+    for (const auto& tileTriangles : tilesTriangles)
+    {
+        numTriangles += tileTriangles.size();
+    }
+    std::vector<std::array<size_t, 3>> triangles;
+    triangles.reserve(numTriangles);
+    for (auto& tileTriangles : tilesTriangles)
+    {
+        triangles.insert(triangles.end(), tileTriangles.begin(), tileTriangles.end());
+        tileTriangles = std::vector<std::array<size_t, 3>>();
+    }
+
+    // the triangles rejected by all tiles, in sparse areas and along the convex hull
+    const auto missingTriangles = FindMissingDelaunayTriangles(inputNodes, triangles);
+    triangles.insert(triangles.end(), missingTriangles.begin(), missingTriangles.end());
+
+    // edges shared by two triangles, or by a triangle found twice, are generated twice
+    std::vector<Edge> edges;
+    edges.reserve(numNodesInTriangle * triangles.size());
+    std::vector<size_t> faceNodes(numNodesInTriangle);
+    for (const auto& triangle : triangles)
+    {
+        std::copy(triangle.begin(), triangle.end(), faceNodes.begin());
+        if (!IsTriangleSelected(faceNodes, inputNodes, polygons))
+        {
+            continue;
+        }
+        for (auto j = 0; j < numNodesInTriangle; ++j)
+        {
+            const auto nextNode = triangle[NextCircularForwardIndex(j, numNodesInTriangle)];
+            edges.emplace_back(std::min(triangle[j], nextNode), std::max(triangle[j], nextNode));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    return edges;
+}
+
+std::vector<std::array<size_t, 3>> meshkernel::Mesh2D::FindMissingDelaunayTriangles(const std::vector<Point>& nodes,
+                                                                                    const std::vector<std::array<size_t, 3>>& triangles) const
+{
+    // a node is surrounded if all its edges are shared by two triangles
+    std::vector<Edge> trianglesEdges;
+    trianglesEdges.reserve(numNodesInTriangle * triangles.size());
+    for (const auto& triangle : triangles)
+    {
+        for (auto j = 0; j < numNodesInTriangle; ++j)
+        {
+            const auto nextNode = triangle[NextCircularForwardIndex(j, numNodesInTriangle)];
+            trianglesEdges.emplace_back(std::min(triangle[j], nextNode), std::max(triangle[j], nextNode));
+        }
+    }
+    std::sort(trianglesEdges.begin(), trianglesEdges.end());
+
+    std::vector<bool> isNodeSurrounded(nodes.size(), false);
+    for (const auto& [firstNode, secondNode] : trianglesEdges)
+    {
+        isNodeSurrounded[firstNode] = true;
+        isNodeSurrounded[secondNode] = true;
+    }
+    for (size_t e = 0; e < trianglesEdges.size();)
+    {
+        auto nextEdge = e + 1;
+        while (nextEdge < trianglesEdges.size() && trianglesEdges[nextEdge] == trianglesEdges[e])
+        {
+            nextEdge++;
+        }
+        if (nextEdge - e == 1)
+        {
+            isNodeSurrounded[trianglesEdges[e].first] = false;
+            isNodeSurrounded[trianglesEdges[e].second] = false;
+        }
+        e = nextEdge;
+    }
+
+    std::vector<size_t> borderNodesIndices;
+    std::vector<Point> borderNodes;
+    for (size_t n = 0; n < nodes.size(); ++n)
+    {
+        if (nodes[n].IsValid() && !isNodeSurrounded[n])
+        {
+            borderNodesIndices.emplace_back(n);
+            borderNodes.emplace_back(nodes[n]);
+        }
+    }
+    if (borderNodes.size() < numNodesInTriangle)
+    {
+        return {};
+    }
+
+    TriangulationWrapper triangulationWrapper;
+    triangulationWrapper.Compute(borderNodes,
+                                 TriangulationWrapper::TriangulationOptions::TriangulatePointsAndGenerateFaces,
+                                 0.0);
+
+    // the nodes of the triangle are on its circumcircle, any other node must be outside
+    const double relativeTolerance = 1e-9;
+    RTree nodesRTree;
+    nodesRTree.BuildTree(nodes);
+    std::vector<std::array<size_t, 3>> missingTriangles;
+    std::vector<size_t> circleNodes;
+    for (size_t f = 0; f < triangulationWrapper.m_numFaces; ++f)
+    {
+        const std::array<size_t, 3> triangle{borderNodesIndices[triangulationWrapper.GetFaceNode(f, 0)],
+                                             borderNodesIndices[triangulationWrapper.GetFaceNode(f, 1)],
+                                             borderNodesIndices[triangulationWrapper.GetFaceNode(f, 2)]};
+        const auto& firstNode = nodes[triangle[0]];
+        const auto center = CircumcenterOfTriangle(firstNode, nodes[triangle[1]], nodes[triangle[2]], Projection::cartesian);
+        const auto squaredRadius = (center.x - firstNode.x) * (center.x - firstNode.x) + (center.y - firstNode.y) * (center.y - firstNode.y);
+
+        nodesRTree.NearestNeighbors(center);
+        if (nodesRTree.GetQueryResultSize() > 0)
+        {
+            const auto& nearestNode = nodes[nodesRTree.GetQueryResult(0)];
+            const auto squaredDistance = (center.x - nearestNode.x) * (center.x - nearestNode.x) + (center.y - nearestNode.y) * (center.y - nearestNode.y);
+            if (squaredDistance < squaredRadius * (1.0 - relativeTolerance))
+            {
+                continue;
+            }
+        }
+
+        // other nodes on the circumcircle allow other triangles, the one of the partial triangulation must be kept
+        nodesRTree.NearestNeighborsOnSquaredDistance(center, squaredRadius * (1.0 + relativeTolerance));
+        circleNodes.clear();
+        for (size_t i = 0; i < nodesRTree.GetQueryResultSize(); ++i)
+        {
+            circleNodes.emplace_back(nodesRTree.GetQueryResult(i));
+        }
+        if (circleNodes.size() > numNodesInTriangle && IsTriangleCrossingEdges(nodes, triangle, circleNodes, trianglesEdges))
+        {
+            continue;
+        }
+
+        missingTriangles.push_back(triangle);
+    }
+
+    return missingTriangles;
+}
+
+bool meshkernel::Mesh2D::IsTriangleCrossingEdges(const std::vector<Point>& nodes,
+                                                 const std::array<size_t, 3>& triangle,
+                                                 const std::vector<size_t>& circleNodes,
+                                                 const std::vector<Edge>& sortedEdges) const
+{
+    // an edge of a Delaunay triangulation crossing the triangle connects two nodes on its circumcircle
+    Point intersection;
+    double crossProduct;
+    double firstRatio;
+    double secondRatio;
+    for (size_t i = 0; i < circleNodes.size(); ++i)
+    {
+        for (size_t j = i + 1; j < circleNodes.size(); ++j)
+        {
+            const Edge edge{std::min(circleNodes[i], circleNodes[j]), std::max(circleNodes[i], circleNodes[j])};
+            if (!std::binary_search(sortedEdges.begin(), sortedEdges.end(), edge))
+            {
+                continue;
+            }
+            for (auto n = 0; n < numNodesInTriangle; ++n)
+            {
+                const auto firstNode = triangle[n];
+                const auto secondNode = triangle[NextCircularForwardIndex(n, numNodesInTriangle)];
+                if (firstNode == edge.first || firstNode == edge.second || secondNode == edge.first || secondNode == edge.second)
+                {
+                    continue;
+                }
+                if (AreSegmentsCrossing(nodes[firstNode], nodes[secondNode], nodes[edge.first], nodes[edge.second], false, Projection::cartesian, intersection, crossProduct, firstRatio, secondRatio))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+bool meshkernel::Mesh2D::IsTriangleSelected(const std::vector<size_t>& faceNodes, const std::vector<Point>& nodes, const Polygons& polygons) const
+{
+    if (!CheckTriangle(faceNodes, nodes))
+    {
+        return false;
+    }
+
+    const Point approximateCenter = (nodes[faceNodes[0]] + nodes[faceNodes[1]] + nodes[faceNodes[2]]) * oneThird;
+    return polygons.IsPointInPolygon(approximateCenter, 0);
 }
 
 bool meshkernel::Mesh2D::CheckTriangle(const std::vector<size_t>& faceNodes, const std::vector<Point>& nodes) const
@@ -256,89 +673,84 @@ void meshkernel::Mesh2D::SetFlatCopies(AdministrationOptions administrationOptio
 {
     Administrate(administrationOption);
 
-    m_nodex.resize(GetNumNodes());
-    m_nodey.resize(GetNumNodes());
-    m_nodez.resize(GetNumNodes());
-    for (auto n = 0; n < GetNumNodes(); n++)
-    {
-        m_nodex[n] = m_nodes[n].x;
-        m_nodey[n] = m_nodes[n].y;
-        m_nodez[n] = 0.0;
-    }
+    // The node coordinates are exposed directly, only the other flat copies are filled.
+    // The flat copies keep their capacity between calls, so repeated exchanges do not reallocate.
+    // At least one element is always present, because we need to provide pointers to non empty memory.
+    // The z coordinates are always zero: resizing only initializes the newly added elements.
+    const auto numNodes = GetNumNodes();
+    m_nodes.reserve(1);
+    m_nodez.resize(std::max<size_t>(numNodes, 1), 0.0);
 
-    size_t edgeIndex = 0;
-    m_edgeNodes.resize(GetNumEdges() * 2);
-    for (auto e = 0; e < GetNumEdges(); e++)
+    const auto numEdges = GetNumEdges();
+    m_edgeNodes.resize(std::max<size_t>(numEdges * 2, 1));
+    for (auto e = 0; e < numEdges; e++)
     {
-        m_edgeNodes[edgeIndex] = static_cast<int>(m_edges[e].first);
-        edgeIndex++;
-        m_edgeNodes[edgeIndex] = static_cast<int>(m_edges[e].second);
-        edgeIndex++;
+        m_edgeNodes[2 * e] = static_cast<int>(m_edges[e].first);
+        m_edgeNodes[2 * e + 1] = static_cast<int>(m_edges[e].second);
     }
 
-    m_faceNodes.resize(GetNumFaces() * maximumNumberOfNodesPerFace, intMissingValue);
-    m_facesCircumcentersx.resize(GetNumFaces());
-    m_facesCircumcentersy.resize(GetNumFaces());
-    m_facesCircumcentersz.resize(GetNumFaces());
-    size_t faceIndex = 0;
-    for (auto f = 0; f < GetNumFaces(); f++)
+    const auto numFaces = GetNumFaces();
+    m_faceNodes.assign(std::max<size_t>(numFaces * maximumNumberOfNodesPerFace, 1), intMissingValue);
+    m_facesCircumcentersx.resize(std::max<size_t>(numFaces, 1));
+    m_facesCircumcentersy.resize(std::max<size_t>(numFaces, 1));
+    m_facesCircumcentersz.resize(std::max<size_t>(numFaces, 1), 0.0);
+    for (auto f = 0; f < numFaces; f++)
     {
-        for (auto n = 0; n < maximumNumberOfNodesPerFace; ++n)
+        const auto numFaceNodes = std::min(m_facesNodes[f].size(), maximumNumberOfNodesPerFace);
+        for (auto n = 0; n < numFaceNodes; ++n)
         {
-            if (n < m_facesNodes[f].size())
-            {
-                m_faceNodes[faceIndex] = static_cast<int>(m_facesNodes[f][n]);
-            }
-            faceIndex++;
+            m_faceNodes[f * maximumNumberOfNodesPerFace + n] = static_cast<int>(m_facesNodes[f][n]);
         }
         m_facesCircumcentersx[f] = m_facesCircumcenters[f].x;
         m_facesCircumcentersy[f] = m_facesCircumcenters[f].y;
-        m_facesCircumcentersz[f] = 0.0;
     }
+}
 
-    //we always need to provide pointers to not empty memory
-    if (m_nodex.empty())
-    {
-        m_nodex.resize(1);
-    }
-    if (m_nodey.empty())
-    {
-        m_nodey.resize(1);
-    }
-    if (m_nodez.empty())
-    {
-        m_nodez.resize(1);
-    }
-    if (m_edgeNodes.empty())
-    {
-        m_edgeNodes.resize(1);
-    }
-    if (m_faceNodes.empty())
-    {
-        m_faceNodes.resize(1, intMissingValue);
-    }
-    if (m_facesCircumcentersx.empty())
-    {
-        m_facesCircumcentersx.resize(1);
-    }
-    if (m_facesCircumcentersy.empty())
-    {
-        m_facesCircumcentersy.resize(1);
-    }
-    if (m_facesCircumcentersz.empty())
-    {
-        m_facesCircumcentersz.resize(1);
-    }
+meshkernel::MemoryUsage meshkernel::Mesh2D::GetMemoryUsage() const
+{
+    MemoryUsage memoryUsage;
+    AccumulateMemoryUsage(memoryUsage);
+    return memoryUsage;
+}
+
+void meshkernel::Mesh2D::AccumulateMemoryUsage(MemoryUsage& memoryUsage) const
+{
+    Mesh::AccumulateMemoryUsage(memoryUsage);
+    memoryUsage.AddVectors("Mesh flat copies", m_nodez, m_edgeNodes, m_faceNodes, m_facesCircumcentersx, m_facesCircumcentersy, m_facesCircumcentersz);
+    memoryUsage.AddVectors("Mesh caches", m_polygonNodesCache, m_boundaryLoops);
+}
+
+void meshkernel::Mesh2D::Shrink()
+{
+    ReleaseCaches();
+
+    m_nodez = std::vector<double>();
+    m_edgeNodes = std::vector<int>();
+    m_faceNodes = std::vector<int>();
+    m_facesCircumcentersx = std::vector<double>();
+    m_facesCircumcentersy = std::vector<double>();
+    m_facesCircumcentersz = std::vector<double>();
+    m_polygonNodesCache = std::vector<Point>();
+    m_boundaryLoops = std::vector<std::vector<size_t>>();
+    m_boundaryLoopsRequireUpdate = true;
 }
 
 void meshkernel::Mesh2D::DeleteDegeneratedTriangles()
 {
     Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
 
-    // assume the max amount of degenerated triangles is 10% of the actual faces
-    std::vector<size_t> degeneratedTriangles;
-    degeneratedTriangles.reserve(static_cast<size_t>(static_cast<double>(GetNumFaces()) * 0.1));
-    for (auto f = 0; f < GetNumFaces(); ++f)
+    CollapseDegeneratedTriangles(FindDegeneratedTriangles());
+
+    Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+}
+
+std::vector<size_t> meshkernel::Mesh2D::FindDegeneratedTriangles() const
+{
+    MESHKERNEL_TIME_SCOPE("Mesh2D::FindDegeneratedTriangles");
+
+    std::vector<char> isDegenerated(GetNumFaces(), false);
+#pragma omp parallel for
+    for (int f = 0; f < static_cast<int>(GetNumFaces()); ++f)
     {
         const auto numFaceNodes = m_numFacesNodes[f];
         if (numFaceNodes != numNodesInTriangle)
@@ -366,18 +778,31 @@ void meshkernel::Mesh2D::DeleteDegeneratedTriangles()
 
         const auto den = dy2 * dx3 - dy3 * dx2;
 
-        if (IsEqual(den, 0.0))
+        isDegenerated[f] = IsEqual(den, 0.0);
+    }
+
+    std::vector<size_t> degeneratedTriangles;
+    for (size_t f = 0; f < isDegenerated.size(); ++f)
+    {
+        if (isDegenerated[f])
         {
-            // Flag edges to remove
-            for (auto e = 0; e < numNodesInTriangle; ++e)
-            {
-                const auto edge = m_facesEdges[f][e];
-                m_edges[edge] = {sizetMissingValue, sizetMissingValue};
-            }
-            // save degenerated face index
             degeneratedTriangles.emplace_back(f);
         }
     }
+    return degeneratedTriangles;
+}
+
+void meshkernel::Mesh2D::CollapseDegeneratedTriangles(const std::vector<size_t>& degeneratedTriangles)
+{
+    // flag the edges to remove
+    for (auto const& face : degeneratedTriangles)
+    {
+        for (auto e = 0; e < numNodesInTriangle; ++e)
+        {
+            const auto edge = m_facesEdges[face][e];
+            m_edges[edge] = {sizetMissingValue, sizetMissingValue};
+        }
+    }
 
     // collapse secondNode and thirdNode into firstNode, change coordinate of the firstNode to triangle center of mass
     for (auto const& face : degeneratedTriangles)
@@ -390,8 +815,6 @@ void meshkernel::Mesh2D::DeleteDegeneratedTriangles()
         MergeTwoNodes(secondNode, firstNode);
         MergeTwoNodes(thirdNode, firstNode);
     }
-
-    Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
 }
 
 void meshkernel::Mesh2D::FindFacesRecursive(size_t startingNode,
@@ -527,6 +950,8 @@ void meshkernel::Mesh2D::FindFacesRecursive(size_t startingNode,
 
 void meshkernel::Mesh2D::FindFaces()
 {
+    MESHKERNEL_TIME_SCOPE("Mesh2D::FindFaces");
+
     for (auto numEdgesPerFace = 3; numEdgesPerFace <= maximumNumberOfEdgesPerFace; numEdgesPerFace++)
     {
         std::vector<size_t> edges(numEdgesPerFace);
@@ -558,6 +983,8 @@ void meshkernel::Mesh2D::FindFaces()
 
 void meshkernel::Mesh2D::ComputeFaceCircumcentersMassCentersAndAreas(bool computeMassCenters)
 {
+    MESHKERNEL_TIME_SCOPE("Mesh2D::ComputeFaceCircumcentersMassCentersAndAreas");
+
     m_facesCircumcenters.resize(GetNumFaces());
     m_faceArea.resize(GetNumFaces());
     m_facesMassCenters.resize(GetNumFaces());
@@ -775,9 +1202,9 @@ void meshkernel::Mesh2D::MakeMesh(const meshkernelapi::MakeMeshParameters& MakeM
                 double newPointYCoordinate = OriginYCoordinate + m * XGridBlockSize * sinAngle + n * YGridBlockSize * cosineAngle;
                 if (m_projection == Projection::spherical && n > 0)
                 {
-                    newPointYCoordinate = XGridBlockSize * cos(degrad_hp * CurvilinearGrid.m_grid[n - 1][m].y);
+                    newPointYCoordinate = XGridBlockSize * cos(degrad_hp * CurvilinearGrid.Node(n - 1, m).y);
                 }
-                CurvilinearGrid.m_grid[n][m] = {newPointXCoordinate, newPointYCoordinate};
+                CurvilinearGrid.Node(n, m) = {newPointXCoordinate, newPointYCoordinate};
             }
         }
 
@@ -791,7 +1218,7 @@ void meshkernel::Mesh2D::MakeMesh(const meshkernelapi::MakeMeshParameters& MakeM
             {
                 for (auto m = 0; m < numM; ++m)
                 {
-                    const bool isInPolygon = polygons.IsPointInPolygon(CurvilinearGrid.m_grid[n][m], 0);
+                    const bool isInPolygon = polygons.IsPointInPolygon(CurvilinearGrid.Node(n, m), 0);
                     if (isInPolygon)
                     {
                         nodeBasedMask[n][m] = true;
@@ -833,21 +1260,16 @@ void meshkernel::Mesh2D::MakeMesh(const meshkernelapi::MakeMeshParameters& MakeM
                 {
                     if (!nodeBasedMask[n][m])
                     {
-                        CurvilinearGrid.m_grid[n][m].x = doubleMissingValue;
-                        CurvilinearGrid.m_grid[n][m].y = doubleMissingValue;
+                        CurvilinearGrid.Node(n, m).x = doubleMissingValue;
+                        CurvilinearGrid.Node(n, m).y = doubleMissingValue;
                     }
                 }
             }
         }
     }
 
-    // Assign mesh
-    *this = Mesh2D(CurvilinearGrid, m_projection);
-
-    m_nodesRTreeRequiresUpdate = true;
-    m_edgesRTreeRequiresUpdate = true;
-
-    Administrate(AdministrationOptions::AdministrateMeshEdges);
+    // Assign mesh, the conversion already administrates the nodes, edges and faces
+    *this = Mesh2D(CurvilinearGrid, m_projection);
 }
 
 void meshkernel::Mesh2D::MergeNodesInPolygon(const Polygons& polygon)
@@ -934,7 +1356,7 @@ void meshkernel::Mesh2D::ComputeFaceClosedPolygon(size_t faceIndex, std::vector<
 void meshkernel::Mesh2D::MaskNodesInPolygons(const Polygons& polygon, bool inside)
 {
     std::fill(m_nodeMask.begin(), m_nodeMask.end(), 0);
-    const auto nodePolygonIndices = polygon.PolygonIndices(m_nodes);
+    const auto nodePolygonIndices = polygon.PolygonIndices(m_nodes.ToPoints());
 
     for (auto i = 0; i < GetNumNodes(); ++i)
     {
@@ -1076,44 +1498,160 @@ void meshkernel::Mesh2D::MaskFaceEdgesInPolygon(const Polygons& polygons, bool i
 
 meshkernel::Mesh2D& meshkernel::Mesh2D::operator+=(Mesh2D const& rhs)
 {
+    MESHKERNEL_TIME_SCOPE("Mesh2D::operator+=");
+
     if (m_projection != rhs.m_projection || rhs.GetNumNodes() == 0 || rhs.GetNumEdges() == 0)
     {
         throw std::invalid_argument("Mesh2D::operator+=: The two meshes cannot be added.");
     }
 
-    const auto rhsNumNodes = rhs.GetNumNodes();
-    const auto rhsNumEdges = rhs.GetNumEdges();
-
-    m_edges.resize(GetNumEdges() + rhsNumEdges);
-    m_nodes.resize(GetNumNodes() + rhsNumNodes);
-
-    //copy mesh nodes
-    for (auto n = GetNumNodes(); n < GetNumNodes() + rhsNumNodes; ++n)
+    // The meshes do not share nodes, so two administrated meshes can be appended with offset indices
+    if (HasUpToDateFaceAdministration() && rhs.HasUpToDateFaceAdministration())
     {
-        const auto index = n - GetNumNodes();
-        m_nodes[n] = rhs.m_nodes[index];
+        AppendAdministratedMesh(rhs);
+        return *this;
     }
 
-    //copy mesh edges
-    for (auto e = GetNumEdges(); e < GetNumEdges() + rhsNumEdges; ++e)
+    const auto numNodes = GetNumNodes();
+    const auto numEdges = GetNumEdges();
+
+    m_nodes.reserve(numNodes + rhs.GetNumNodes());
+    m_nodes.Append(rhs.m_nodes);
+
+    m_edges.reserve(numEdges + rhs.GetNumEdges());
+    for (const auto& [firstNode, secondNode] : rhs.m_edges)
     {
-        const auto index = e - GetNumEdges();
-        m_edges[e].first = rhs.m_edges[index].first + GetNumNodes();
-        m_edges[e].second = rhs.m_edges[index].second + GetNumNodes();
+        m_edges.emplace_back(firstNode + numNodes, secondNode + numNodes);
     }
 
     m_nodesRTreeRequiresUpdate = true;
     m_edgesRTreeRequiresUpdate = true;
+    m_boundaryLoopsRequireUpdate = true;
+    m_facesRequireUpdate = true;
 
     Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
 
     //no polygon involved, so node mask is 1 everywhere
-    m_nodeMask.resize(m_nodes.size());
-    std::fill(m_nodeMask.begin(), m_nodeMask.end(), 1);
+    m_nodeMask.assign(m_nodes.size(), 1);
 
     return *this;
 }
 
+bool meshkernel::Mesh2D::HasUpToDateFaceAdministration() const
+{
+    // an empty mesh has nothing to administrate
+    if (m_facesRequireUpdate && !(m_nodes.empty() && m_edges.empty()))
+    {
+        return false;
+    }
+
+    // The administration would remove invalid and unconnected nodes or invalid edges, renumbering the topology
+    if (m_nodesEdges.size() != m_nodes.size() ||
+        m_nodesNumEdges.size() != m_nodes.size() ||
+        m_nodesTypes.size() != m_nodes.size() ||
+        m_edgesFaces.size() != m_edges.size() ||
+        m_edgesNumFaces.size() != m_edges.size() ||
+        m_facesNodes.size() != m_numFaces ||
+        m_facesEdges.size() != m_numFaces ||
+        m_numFacesNodes.size() != m_numFaces ||
+        m_facesCircumcenters.size() != m_numFaces ||
+        m_facesMassCenters.size() != m_numFaces ||
+        m_faceArea.size() != m_numFaces)
+    {
+        return false;
+    }
+
+    for (auto n = 0; n < m_nodes.size(); ++n)
+    {
+        if (!m_nodes[n].IsValid() || m_nodesNumEdges[n] == 0)
+        {
+            return false;
+        }
+    }
+
+    return std::none_of(m_edges.begin(), m_edges.end(), [](const Edge& edge) { return edge.first == sizetMissingValue || edge.second == sizetMissingValue; });
+}
+
+void meshkernel::Mesh2D::AppendAdministratedMesh(Mesh2D const& rhs)
+{
+    const auto nodeOffset = m_nodes.size();
+    const auto edgeOffset = m_edges.size();
+    const auto faceOffset = m_numFaces;
+    const auto offsetIndex = [](size_t index, size_t offset) { return index == sizetMissingValue ? sizetMissingValue : index + offset; };
+
+    // nodes
+    m_nodes.reserve(nodeOffset + rhs.m_nodes.size());
+    m_nodes.Append(rhs.m_nodes);
+    m_nodesNumEdges.reserve(m_nodes.size());
+    m_nodesNumEdges.insert(m_nodesNumEdges.end(), rhs.m_nodesNumEdges.begin(), rhs.m_nodesNumEdges.end());
+    m_nodesEdges.reserve(m_nodes.size());
+    for (const auto& nodeEdges : rhs.m_nodesEdges)
+    {
+        auto& appendedNodeEdges = m_nodesEdges.emplace_back(nodeEdges);
+        for (auto& edge : appendedNodeEdges)
+        {
+            edge = offsetIndex(edge, edgeOffset);
+        }
+    }
+
+    // edges
+    m_edges.reserve(edgeOffset + rhs.m_edges.size());
+    for (const auto& [firstNode, secondNode] : rhs.m_edges)
+    {
+        m_edges.emplace_back(firstNode + nodeOffset, secondNode + nodeOffset);
+    }
+    m_edgesNumFaces.reserve(m_edges.size());
+    m_edgesNumFaces.insert(m_edgesNumFaces.end(), rhs.m_edgesNumFaces.begin(), rhs.m_edgesNumFaces.end());
+    m_edgesFaces.reserve(m_edges.size());
+    for (const auto& edgeFaces : rhs.m_edgesFaces)
+    {
+        auto& appendedEdgeFaces = m_edgesFaces.emplace_back(edgeFaces);
+        for (auto& face : appendedEdgeFaces)
+        {
+            face = offsetIndex(face, faceOffset);
+        }
+    }
+
+    // faces
+    m_facesNodes.reserve(faceOffset + rhs.m_numFaces);
+    m_facesEdges.reserve(faceOffset + rhs.m_numFaces);
+    for (auto f = 0; f < rhs.m_numFaces; ++f)
+    {
+        auto& faceNodes = m_facesNodes.emplace_back(rhs.m_facesNodes[f]);
+        for (auto& node : faceNodes)
+        {
+            node += nodeOffset;
+        }
+        auto& faceEdges = m_facesEdges.emplace_back(rhs.m_facesEdges[f]);
+        for (auto& edge : faceEdges)
+        {
+            edge += edgeOffset;
+        }
+    }
+    m_numFacesNodes.insert(m_numFacesNodes.end(), rhs.m_numFacesNodes.begin(), rhs.m_numFacesNodes.end());
+
+    m_numNodes = m_nodes.size();
+    m_numEdges = m_edges.size();
+    m_numFaces += rhs.m_numFaces;
+
+    // The node coordinates of both meshes can change without changing the topology (moving nodes, orthogonalization, snapping),
+    // so the geometric part of the administration is recomputed over the whole mesh. Only the face search is saved
+    for (auto n = 0; n < m_numNodes; n++)
+    {
+        SortEdgesInCounterClockWiseOrder(n);
+    }
+    ComputeFaceCircumcentersMassCentersAndAreas(true);
+    ClassifyNodes();
+
+    m_nodesRTreeRequiresUpdate = true;
+    m_edgesRTreeRequiresUpdate = true;
+    m_boundaryLoopsRequireUpdate = true;
+    UpdateRTrees();
+
+    //no polygon involved, so node mask is 1 everywhere
+    m_nodeMask.assign(m_nodes.size(), 1);
+}
+
 void meshkernel::Mesh2D::ComputeNodeMaskFromEdgeMask()
 {
     if (m_edgeMask.size() != GetNumEdges() || m_nodeMask.size() != GetNumNodes())
@@ -1250,34 +1788,48 @@ std::vector<meshkernel::Point> meshkernel::Mesh2D::GetObtuseTrianglesCenters()
     result.reserve(GetNumFaces());
     for (auto f = 0; f < GetNumFaces(); ++f)
     {
-        // a triangle
-        if (m_numFacesNodes[f] == 3)
+        if (IsObtuseTriangle(f))
         {
-            const auto firstNode = m_facesNodes[f][0];
-            const auto secondNode = m_facesNodes[f][1];
-            const auto thirdNode = m_facesNodes[f][2];
-            //compute squared edge lengths
-            const auto firstEdgeSquaredLength = ComputeSquaredDistance(m_nodes[secondNode], m_nodes[firstNode], m_projection);
-            const auto secondEdgeSquaredLength = ComputeSquaredDistance(m_nodes[thirdNode], m_nodes[firstNode], m_projection);
-            const auto thirdEdgeSquaredLength = ComputeSquaredDistance(m_nodes[thirdNode], m_nodes[secondNode], m_projection);
-
-            if (firstEdgeSquaredLength > secondEdgeSquaredLength + thirdEdgeSquaredLength ||
-                secondEdgeSquaredLength > firstEdgeSquaredLength + thirdEdgeSquaredLength ||
-                thirdEdgeSquaredLength > secondEdgeSquaredLength + firstEdgeSquaredLength)
-            {
-                result.emplace_back(m_facesMassCenters[f]);
-            }
+            result.emplace_back(m_facesMassCenters[f]);
         }
     }
     return result;
 }
 
+bool meshkernel::Mesh2D::IsObtuseTriangle(size_t face) const
+{
+    // a triangle
+    if (m_numFacesNodes[face] != 3)
+    {
+        return false;
+    }
+
+    const auto firstNode = m_facesNodes[face][0];
+    const auto secondNode = m_facesNodes[face][1];
+    const auto thirdNode = m_facesNodes[face][2];
+    //compute squared edge lengths
+    const auto firstEdgeSquaredLength = ComputeSquaredDistance(m_nodes[secondNode], m_nodes[firstNode], m_projection);
+    const auto secondEdgeSquaredLength = ComputeSquaredDistance(m_nodes[thirdNode], m_nodes[firstNode], m_projection);
+    const auto thirdEdgeSquaredLength = ComputeSquaredDistance(m_nodes[thirdNode], m_nodes[secondNode], m_projection);
+
+    return firstEdgeSquaredLength > secondEdgeSquaredLength + thirdEdgeSquaredLength ||
+           secondEdgeSquaredLength > firstEdgeSquaredLength + thirdEdgeSquaredLength ||
+           thirdEdgeSquaredLength > secondEdgeSquaredLength + firstEdgeSquaredLength;
+}
+
 std::vector<size_t> meshkernel::Mesh2D::GetEdgesCrossingSmallFlowEdges(double smallFlowEdgesThreshold)
 {
     Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
-    std::vector<size_t> result;
-    result.reserve(GetNumEdges());
-    for (auto e = 0; e < GetNumEdges(); ++e)
+    return FindEdgesCrossingSmallFlowEdges(smallFlowEdgesThreshold);
+}
+
+std::vector<size_t> meshkernel::Mesh2D::FindEdgesCrossingSmallFlowEdges(double smallFlowEdgesThreshold) const
+{
+    MESHKERNEL_TIME_SCOPE("Mesh2D::FindEdgesCrossingSmallFlowEdges");
+
+    std::vector<char> isCrossingSmallFlowEdge(GetNumEdges(), false);
+#pragma omp parallel for
+    for (int e = 0; e < static_cast<int>(GetNumEdges()); ++e)
     {
         const auto firstFace = m_edgesFaces[e][0];
         const auto secondFace = m_edgesFaces[e][1];
@@ -1287,15 +1839,38 @@ std::vector<size_t> meshkernel::Mesh2D::GetEdgesCrossingSmallFlowEdges(double sm
             const auto flowEdgeLength = ComputeDistance(m_facesCircumcenters[firstFace], m_facesCircumcenters[secondFace], m_projection);
             const double cutOffDistance = smallFlowEdgesThreshold * 0.5 * (std::sqrt(m_faceArea[firstFace]) + std::sqrt(m_faceArea[secondFace]));
 
-            if (flowEdgeLength < cutOffDistance)
-            {
-                result.emplace_back(e);
-            }
+            isCrossingSmallFlowEdge[e] = flowEdgeLength < cutOffDistance;
+        }
+    }
+
+    std::vector<size_t> result;
+    for (size_t e = 0; e < isCrossingSmallFlowEdge.size(); ++e)
+    {
+        if (isCrossingSmallFlowEdge[e])
+        {
+            result.emplace_back(e);
         }
     }
     return result;
 }
 
+double meshkernel::Mesh2D::GetFlowEdgeLengthRatio(size_t edge) const
+{
+    const auto firstFace = m_edgesFaces[edge][0];
+    const auto secondFace = m_edgesFaces[edge][1];
+    if (m_edgesNumFaces[edge] != 2 || firstFace == sizetMissingValue || secondFace == sizetMissingValue)
+    {
+        return doubleMissingValue;
+    }
+
+    const auto cutOffDistanceBase = 0.5 * (std::sqrt(m_faceArea[firstFace]) + std::sqrt(m_faceArea[secondFace]));
+    if (cutOffDistanceBase <= 0.0)
+    {
+        return doubleMissingValue;
+    }
+    return ComputeDistance(m_facesCircumcenters[firstFace], m_facesCircumcenters[secondFace], m_projection) / cutOffDistanceBase;
+}
+
 std::vector<meshkernel::Point> meshkernel::Mesh2D::GetFlowEdgesCenters(const std::vector<size_t>& edges) const
 {
     std::vector<Point> result;
@@ -1312,9 +1887,16 @@ std::vector<meshkernel::Point> meshkernel::Mesh2D::GetFlowEdgesCenters(const std
 
 void meshkernel::Mesh2D::DeleteSmallFlowEdges(double smallFlowEdgesThreshold)
 {
-    DeleteDegeneratedTriangles();
+    Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+
+    const auto degeneratedTriangles = FindDegeneratedTriangles();
+    if (!degeneratedTriangles.empty())
+    {
+        CollapseDegeneratedTriangles(degeneratedTriangles);
+        Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    }
 
-    auto edges = GetEdgesCrossingSmallFlowEdges(smallFlowEdgesThreshold);
+    const auto edges = FindEdgesCrossingSmallFlowEdges(smallFlowEdgesThreshold);
     if (!edges.empty())
     {
         // invalidate the edges
@@ -1328,35 +1910,133 @@ void meshkernel::Mesh2D::DeleteSmallFlowEdges(double smallFlowEdgesThreshold)
 
 void meshkernel::Mesh2D::DeleteSmallTrianglesAtBoundaries(double minFractionalAreaTriangles)
 {
-    // On the second part, the small triangles at the boundaries are checked
+    if (MergeSmallTrianglesAtBoundaries(FindSmallTrianglesAtBoundaries(minFractionalAreaTriangles)))
+    {
+        Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    }
+}
+
+void meshkernel::Mesh2D::DeleteSmallFlowEdgesAndSmallTrianglesAtBoundaries(double smallFlowEdgesThreshold, double minFractionalAreaTriangles)
+{
+    MESHKERNEL_TIME_SCOPE("Mesh2D::DeleteSmallFlowEdgesAndSmallTrianglesAtBoundaries");
+
+    if (!HasUpToDateFaceAdministration())
+    {
+        Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    }
+
+    // collapsing degenerated triangles moves the circumcenters of their neighbours, the flow edges are found after it
+    const auto degeneratedTriangles = FindDegeneratedTriangles();
+    if (!degeneratedTriangles.empty())
+    {
+        CollapseDegeneratedTriangles(degeneratedTriangles);
+        Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    }
+
+    // both stages detect on the same administration, the small triangles on the faces merged across the small flow edges
+    const auto smallFlowEdges = FindEdgesCrossingSmallFlowEdges(smallFlowEdgesThreshold);
+    const auto smallTrianglesNodes = FindSmallTrianglesAtBoundaries(minFractionalAreaTriangles, smallFlowEdges);
+
+    // the deletions are applied in one batch and the mesh is administrated once
+    for (const auto& e : smallFlowEdges)
+    {
+        m_edges[e] = {sizetMissingValue, sizetMissingValue};
+    }
+    const auto nodesMerged = MergeSmallTrianglesAtBoundaries(smallTrianglesNodes);
+
+    if (!smallFlowEdges.empty() || nodesMerged)
+    {
+        Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    }
+}
+
+std::vector<std::array<size_t, 3>> meshkernel::Mesh2D::FindSmallTrianglesAtBoundaries(double minFractionalAreaTriangles, const std::vector<size_t>& removedEdges) const
+{
+    MESHKERNEL_TIME_SCOPE("Mesh2D::FindSmallTrianglesAtBoundaries");
+
+    // the faces sharing a removed edge are merged: group them, the area and the number of edges of a group are those of the merged face
+    std::vector<size_t> faceGroup(GetNumFaces());
+    std::iota(faceGroup.begin(), faceGroup.end(), 0);
+    const auto findGroup = [&faceGroup](size_t face) {
+        while (faceGroup[face] != face)
+        {
+            faceGroup[face] = faceGroup[faceGroup[face]];
+            face = faceGroup[face];
+        }
+        return face;
+    };
+    std::vector<double> groupArea(m_faceArea.begin(), m_faceArea.begin() + GetNumFaces());
+    std::vector<size_t> groupNumEdges(m_numFacesNodes.begin(), m_numFacesNodes.begin() + GetNumFaces());
+    std::vector<char> isFaceMerged(GetNumFaces(), false);
+    for (const auto& edge : removedEdges)
+    {
+        const auto firstFace = m_edgesFaces[edge][0];
+        const auto secondFace = m_edgesFaces[edge][1];
+        isFaceMerged[firstFace] = true;
+        isFaceMerged[secondFace] = true;
+
+        const auto firstGroup = findGroup(firstFace);
+        const auto secondGroup = findGroup(secondFace);
+        if (firstGroup == secondGroup)
+        {
+            groupNumEdges[firstGroup] -= 2;
+            continue;
+        }
+        faceGroup[secondGroup] = firstGroup;
+        groupArea[firstGroup] += groupArea[secondGroup];
+        groupNumEdges[firstGroup] += groupNumEdges[secondGroup] - 2;
+    }
+    for (size_t f = 0; f < faceGroup.size(); ++f)
+    {
+        faceGroup[f] = findGroup(f);
+    }
+
+    // the edges of merged faces with too many edges to be found by the administration become boundary edges
+    const auto otherFaceGroup = [this, &faceGroup, &groupNumEdges](size_t face, size_t edge) {
+        if (IsEdgeOnBoundary(edge))
+        {
+            return sizetMissingValue;
+        }
+        const auto otherFace = face == m_edgesFaces[edge][0] ? m_edgesFaces[edge][1] : m_edgesFaces[edge][0];
+        const auto group = faceGroup[otherFace];
+        return groupNumEdges[group] <= maximumNumberOfEdgesPerFace ? group : sizetMissingValue;
+    };
+
     const double minCosPhi = 0.2;
-    std::vector<std::vector<size_t>> smallTrianglesNodes;
-    for (auto face = 0; face < GetNumFaces(); ++face)
+    std::vector<std::array<size_t, 3>> faceSmallTriangleNodes(GetNumFaces(), {sizetMissingValue, sizetMissingValue, sizetMissingValue});
+#pragma omp parallel for
+    for (int face = 0; face < static_cast<int>(GetNumFaces()); ++face)
     {
-        if (m_numFacesNodes[face] != numNodesInTriangle || m_faceArea[face] <= 0.0 || !IsFaceOnBoundary(face))
+        if (m_numFacesNodes[face] != numNodesInTriangle || isFaceMerged[face] || m_faceArea[face] <= 0.0)
         {
             continue;
         }
 
         // compute the average area of neighboring faces
+        bool isFaceOnBoundary = false;
         double averageOtherFacesArea = 0.0;
         size_t numNonBoundaryFaces = 0;
         for (auto e = 0; e < numNodesInTriangle; ++e)
         {
             // the edge must not be at the boundary, otherwise there is no "other" face
-            const auto edge = m_facesEdges[face][e];
-            if (IsEdgeOnBoundary(edge))
+            const auto otherGroup = otherFaceGroup(face, m_facesEdges[face][e]);
+            if (otherGroup == sizetMissingValue)
             {
+                isFaceOnBoundary = true;
                 continue;
             }
-            const auto otherFace = face == m_edgesFaces[edge][0] ? m_edgesFaces[edge][1] : m_edgesFaces[edge][0];
-            if (m_numFacesNodes[otherFace] > numNodesInTriangle)
+            if (groupNumEdges[otherGroup] > numNodesInTriangle)
             {
-                averageOtherFacesArea += m_faceArea[otherFace];
+                averageOtherFacesArea += groupArea[otherGroup];
                 numNonBoundaryFaces++;
             }
         }
 
+        if (!isFaceOnBoundary)
+        {
+            continue;
+        }
+
         if (numNonBoundaryFaces == 0 || m_faceArea[face] / (averageOtherFacesArea / double(numNonBoundaryFaces)) > minFractionalAreaTriangles)
         {
             // no valid boundary faces, the area of the current triangle is larger enough compared to the neighbors
@@ -1390,12 +2070,25 @@ void meshkernel::Mesh2D::DeleteSmallTrianglesAtBoundaries(double minFractionalAr
             }
         }
 
-        if (minCosPhiSmallTriangle < minCosPhi && thirdEdgeSmallTriangle != sizetMissingValue && IsEdgeOnBoundary(thirdEdgeSmallTriangle))
+        if (minCosPhiSmallTriangle < minCosPhi && thirdEdgeSmallTriangle != sizetMissingValue && otherFaceGroup(face, thirdEdgeSmallTriangle) == sizetMissingValue)
+        {
+            faceSmallTriangleNodes[face] = {nodeToPreserve, firstNodeToMerge, secondNodeToMerge};
+        }
+    }
+
+    std::vector<std::array<size_t, 3>> smallTrianglesNodes;
+    for (const auto& triangleNodes : faceSmallTriangleNodes)
+    {
+        if (triangleNodes[0] != sizetMissingValue)
         {
-            smallTrianglesNodes.emplace_back(std::initializer_list<size_t>{nodeToPreserve, firstNodeToMerge, secondNodeToMerge});
+            smallTrianglesNodes.emplace_back(triangleNodes);
         }
     }
+    return smallTrianglesNodes;
+}
 
+bool meshkernel::Mesh2D::MergeSmallTrianglesAtBoundaries(const std::vector<std::array<size_t, 3>>& smallTrianglesNodes)
+{
     bool nodesMerged = false;
     for (const auto& triangleNodes : smallTrianglesNodes)
     {
@@ -1407,7 +2100,8 @@ void meshkernel::Mesh2D::DeleteSmallTrianglesAtBoundaries(double minFractionalAr
         size_t numInternalEdges = 0;
         for (auto e = 0; e < m_nodesNumEdges[firstNodeToMerge]; ++e)
         {
-            if (!IsEdgeOnBoundary(m_nodesEdges[firstNodeToMerge][e]))
+            const auto edge = m_nodesEdges[firstNodeToMerge][e];
+            if (m_edges[edge].first != sizetMissingValue && !IsEdgeOnBoundary(edge))
             {
                 numInternalEdges++;
             }
@@ -1423,7 +2117,8 @@ void meshkernel::Mesh2D::DeleteSmallTrianglesAtBoundaries(double minFractionalAr
         numInternalEdges = 0;
         for (auto e = 0; e < m_nodesNumEdges[secondNodeToMerge]; ++e)
         {
-            if (!IsEdgeOnBoundary(m_nodesEdges[secondNodeToMerge][e]))
+            const auto edge = m_nodesEdges[secondNodeToMerge][e];
+            if (m_edges[edge].first != sizetMissingValue && !IsEdgeOnBoundary(edge))
             {
                 numInternalEdges++;
             }
@@ -1436,10 +2131,7 @@ void meshkernel::Mesh2D::DeleteSmallTrianglesAtBoundaries(double minFractionalAr
         }
     }
 
-    if (nodesMerged)
-    {
-        Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
-    }
+    return nodesMerged;
 }
 
 void meshkernel::Mesh2D::ComputeNodeNeighbours()
@@ -1461,62 +2153,66 @@ void meshkernel::Mesh2D::ComputeNodeNeighbours()
 
 std::vector<double> meshkernel::Mesh2D::GetOrthogonality()
 {
-    std::vector<double> result;
-    result.reserve(GetNumEdges());
-    for (auto e = 0; e < GetNumEdges(); e++)
+    std::vector<double> result(GetNumEdges());
+    const auto numEdges = static_cast<int>(GetNumEdges());
+#pragma omp parallel for
+    for (int e = 0; e < numEdges; e++)
     {
-        auto val = doubleMissingValue;
-        const auto firstNode = m_edges[e].first;
-        const auto secondNode = m_edges[e].second;
-
-        if (firstNode != sizetMissingValue && secondNode != sizetMissingValue && !IsEdgeOnBoundary(e))
-        {
-            val = NormalizedInnerProductTwoSegments(m_nodes[firstNode],
-                                                    m_nodes[secondNode],
-                                                    m_facesCircumcenters[m_edgesFaces[e][0]],
-                                                    m_facesCircumcenters[m_edgesFaces[e][1]],
-                                                    m_projection);
-            if (val != doubleMissingValue)
-            {
-                val = std::abs(val);
-            }
-        }
-        result.emplace_back(val);
+        result[e] = GetEdgeOrthogonality(e);
     }
     return result;
 }
 
-std::vector<double> meshkernel::Mesh2D::GetSmoothness()
+double meshkernel::Mesh2D::GetEdgeOrthogonality(size_t edge) const
 {
-    std::vector<double> result;
-    result.reserve(GetNumEdges());
-    for (auto e = 0; e < GetNumEdges(); e++)
+    const auto firstNode = m_edges[edge].first;
+    const auto secondNode = m_edges[edge].second;
+    if (firstNode == sizetMissingValue || secondNode == sizetMissingValue || m_edgesNumFaces[edge] != 2)
     {
-        auto val = doubleMissingValue;
-        const auto firstNode = m_edges[e].first;
-        const auto secondNode = m_edges[e].second;
+        return doubleMissingValue;
+    }
 
-        if (firstNode != sizetMissingValue && secondNode != sizetMissingValue && !IsEdgeOnBoundary(e))
-        {
-            const auto leftFace = m_edgesFaces[e][0];
-            const auto rightFace = m_edgesFaces[e][1];
-            const auto leftFaceArea = m_faceArea[leftFace];
-            const auto rightFaceArea = m_faceArea[rightFace];
+    const auto val = NormalizedInnerProductTwoSegments(m_nodes[firstNode],
+                                                       m_nodes[secondNode],
+                                                       m_facesCircumcenters[m_edgesFaces[edge][0]],
+                                                       m_facesCircumcenters[m_edgesFaces[edge][1]],
+                                                       m_projection);
+    return val != doubleMissingValue ? std::abs(val) : val;
+}
 
-            if (leftFaceArea < minimumCellArea || rightFaceArea < minimumCellArea)
-            {
-                val = rightFaceArea / leftFaceArea;
-            }
-            if (val < 1.0)
-            {
-                val = 1.0 / val;
-            }
-        }
-        result.emplace_back(val);
+std::vector<double> meshkernel::Mesh2D::GetSmoothness()
+{
+    std::vector<double> result(GetNumEdges());
+    const auto numEdges = static_cast<int>(GetNumEdges());
+#pragma omp parallel for
+    for (int e = 0; e < numEdges; e++)
+    {
+        result[e] = GetEdgeSmoothness(e);
     }
     return result;
 }
 
+double meshkernel::Mesh2D::GetEdgeSmoothness(size_t edge) const
+{
+    const auto firstNode = m_edges[edge].first;
+    const auto secondNode = m_edges[edge].second;
+    if (firstNode == sizetMissingValue || secondNode == sizetMissingValue || m_edgesNumFaces[edge] != 2)
+    {
+        return doubleMissingValue;
+    }
+
+    // the area ratio is not defined next to degenerated faces
+    const auto leftFaceArea = m_faceArea[m_edgesFaces[edge][0]];
+    const auto rightFaceArea = m_faceArea[m_edgesFaces[edge][1]];
+    if (leftFaceArea < minimumCellArea || rightFaceArea < minimumCellArea)
+    {
+        return doubleMissingValue;
+    }
+
+    const auto val = rightFaceArea / leftFaceArea;
+    return val < 1.0 ? 1.0 / val : val;
+}
+
 void meshkernel::Mesh2D::ComputeAspectRatios(std::vector<double>& aspectRatios)
 {
     std::vector<std::vector<double>> averageEdgesLength(GetNumEdges(), std::vector<double>(2, doubleMissingValue));
@@ -1672,6 +2368,8 @@ void meshkernel::Mesh2D::TriangulateFaces()
     }
 
     m_edgesRTreeRequiresUpdate = true;
+    m_boundaryLoopsRequireUpdate = true;
+    m_facesRequireUpdate = true;
 }
 
 void meshkernel::Mesh2D::MakeDualFace(size_t node, double enlargementFactor, std::vector<Point>& dualFace)
@@ -1797,97 +2495,154 @@ std::vector<size_t> meshkernel::Mesh2D::SortedFacesAroundNode(size_t node) const
 
 std::vector<meshkernel::Point> meshkernel::Mesh2D::MeshBoundaryToPolygon(const std::vector<Point>& polygon)
 {
+    MESHKERNEL_TIME_SCOPE("Mesh2D::MeshBoundaryToPolygon");
 
-    // Find faces
-    Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
-    std::vector<bool> isVisited(GetNumEdges(), false);
-    std::vector<Point> meshBoundaryPolygon;
-    meshBoundaryPolygon.reserve(GetNumNodes());
+    const auto& boundaryLoops = GetBoundaryLoops();
 
-    for (auto e = 0; e < GetNumEdges(); e++)
+    // prepare the polygon: each boundary node is tested once, the nodes outside the bounding box are discarded upfront
+    std::vector<char> isBoundaryNode(GetNumNodes(), false);
+    for (const auto& loop : boundaryLoops)
     {
-        if (isVisited[e] || !IsEdgeOnBoundary(e))
+        for (const auto& node : loop)
         {
-            continue;
+            isBoundaryNode[node] = true;
         }
+    }
 
-        const auto firstNodeIndex = m_edges[e].first;
-        const auto secondNodeIndex = m_edges[e].second;
-        const auto firstNode = m_nodes[firstNodeIndex];
-        const auto secondNode = m_nodes[secondNodeIndex];
-
-        const auto firstNodeInPolygon = IsPointInPolygonNodes(m_nodes[firstNodeIndex], polygon, m_projection);
-        const auto secondNodeInPolygon = IsPointInPolygonNodes(m_nodes[secondNodeIndex], polygon, m_projection);
+    const auto checkBoundingBox = polygon.size() >= numNodesInTriangle;
+    Point lowerLeft;
+    Point upperRight;
+    if (checkBoundingBox)
+    {
+        std::tie(lowerLeft, upperRight) = GetBoundingBox(polygon);
+    }
 
-        if (!firstNodeInPolygon && !secondNodeInPolygon)
+    std::vector<char> isNodeInPolygon(GetNumNodes(), false);
+#pragma omp parallel for
+    for (int n = 0; n < static_cast<int>(GetNumNodes()); ++n)
+    {
+        if (!isBoundaryNode[n] || (checkBoundingBox && !IsValueInBoundingBox(m_nodes[n], lowerLeft, upperRight)))
         {
             continue;
         }
+        isNodeInPolygon[n] = IsPointInPolygonNodes(m_nodes[n], polygon, m_projection);
+    }
+
+    std::vector<Point> meshBoundaryPolygon;
+    meshBoundaryPolygon.reserve(GetNumNodes());
+    const auto addPolyline = [&](const std::vector<size_t>& loop, size_t start, size_t end) {
+        // a single edge is kept if one of its nodes is inside, longer polylines have their internal nodes inside
+        if (end - start == 1 && !isNodeInPolygon[loop[start]] && !isNodeInPolygon[loop[end]])
+        {
+            return;
+        }
 
         //Start a new polyline
         if (!meshBoundaryPolygon.empty())
         {
             meshBoundaryPolygon.emplace_back(doubleMissingValue, doubleMissingValue);
         }
+        for (auto n = start; n <= end; ++n)
+        {
+            meshBoundaryPolygon.emplace_back(m_nodes[loop[n]]);
+        }
+        meshBoundaryPolygon.emplace_back(doubleMissingValue, doubleMissingValue);
+    };
+
+    std::vector<size_t> rotatedLoop;
+    for (const auto& loop : boundaryLoops)
+    {
+        const auto outsideNode = std::find_if(loop.begin(), loop.end(), [&](size_t node) { return !isNodeInPolygon[node]; });
+        if (outsideNode == loop.end())
+        {
+            addPolyline(loop, 0, loop.size() - 1);
+            continue;
+        }
+
+        // a closed loop is started at a node outside the polygon, so no polyline wraps around its end
+        const auto* currentLoop = &loop;
+        if (loop.size() > 2 && loop.front() == loop.back())
+        {
+            rotatedLoop.assign(outsideNode, loop.end() - 1);
+            rotatedLoop.insert(rotatedLoop.end(), loop.begin(), outsideNode + 1);
+            currentLoop = &rotatedLoop;
+        }
+
+        // split the loop at the nodes outside the polygon
+        size_t start = 0;
+        for (size_t n = 1; n < currentLoop->size(); ++n)
+        {
+            if (!isNodeInPolygon[(*currentLoop)[n]] || n == currentLoop->size() - 1)
+            {
+                addPolyline(*currentLoop, start, n);
+                start = n;
+            }
+        }
+    }
+    return meshBoundaryPolygon;
+}
+
+const std::vector<std::vector<size_t>>& meshkernel::Mesh2D::GetBoundaryLoops()
+{
+    if (m_boundaryLoopsRequireUpdate)
+    {
+        Administrate(AdministrationOptions::AdministrateMeshEdgesAndFaces);
+        ComputeBoundaryLoops();
+        m_boundaryLoopsRequireUpdate = false;
+    }
+    return m_boundaryLoops;
+}
+
+void meshkernel::Mesh2D::ComputeBoundaryLoops()
+{
+    MESHKERNEL_TIME_SCOPE("Mesh2D::ComputeBoundaryLoops");
+
+    m_boundaryLoops.clear();
+    std::vector<bool> isVisited(GetNumEdges(), false);
+    std::vector<size_t> secondTail;
+    for (size_t e = 0; e < GetNumEdges(); e++)
+    {
+        if (isVisited[e] || !IsEdgeOnBoundary(e))
+        {
+            continue;
+        }
 
-        // Put the current edge on the mesh boundary, mark it as visited
-        const auto startPolygonEdges = meshBoundaryPolygon.size();
-        meshBoundaryPolygon.emplace_back(firstNode);
-        meshBoundaryPolygon.emplace_back(secondNode);
+        // Put the current edge on the loop, mark it as visited
+        const auto firstNodeIndex = m_edges[e].first;
+        const auto secondNodeIndex = m_edges[e].second;
+        std::vector<size_t> loopNodes{firstNodeIndex, secondNodeIndex};
         isVisited[e] = true;
 
         // walk the current mesh boundary
         auto currentNode = secondNodeIndex;
-        WalkBoundaryFromNode(polygon, isVisited, currentNode, meshBoundaryPolygon);
-
-        const auto numNodesFirstTail = meshBoundaryPolygon.size();
+        WalkBoundaryFromNode(isVisited, currentNode, loopNodes);
 
-        // if the boundary polygon is not closed
+        // if the loop is not closed, grow a second tail starting at the other side of the first edge
         if (currentNode != firstNodeIndex)
         {
-            //Now grow a polyline starting at the other side of the original link L, i.e., the second tail
+            secondTail.clear();
             currentNode = firstNodeIndex;
-            WalkBoundaryFromNode(polygon, isVisited, currentNode, meshBoundaryPolygon);
-        }
+            WalkBoundaryFromNode(isVisited, currentNode, secondTail);
 
-        // There is a nonempty second tail, so reverse the first tail, so that they connect.
-        if (meshBoundaryPolygon.size() > numNodesFirstTail)
-        {
-            const auto start = startPolygonEdges + static_cast<size_t>(std::ceil((numNodesFirstTail - startPolygonEdges + static_cast<size_t>(1)) * 0.5));
-            for (auto n = start; n < numNodesFirstTail; n++)
+            // There is a nonempty second tail, so reverse the first tail, so that they connect.
+            if (!secondTail.empty())
             {
-                const auto backupPoint = meshBoundaryPolygon[n];
-                const auto replaceIndex = numNodesFirstTail - n + firstNodeIndex;
-                meshBoundaryPolygon[n] = meshBoundaryPolygon[replaceIndex];
-                meshBoundaryPolygon[replaceIndex] = backupPoint;
+                std::reverse(loopNodes.begin(), loopNodes.end());
+                loopNodes.insert(loopNodes.end(), secondTail.begin(), secondTail.end());
             }
         }
 
-        //Start a new polyline
-        meshBoundaryPolygon.emplace_back(doubleMissingValue, doubleMissingValue);
+        m_boundaryLoops.emplace_back(std::move(loopNodes));
     }
-    return meshBoundaryPolygon;
 }
 
-void meshkernel::Mesh2D::WalkBoundaryFromNode(const std::vector<Point>& polygonNodes,
-                                              std::vector<bool>& isVisited,
+void meshkernel::Mesh2D::WalkBoundaryFromNode(std::vector<bool>& isVisited,
                                               size_t& currentNode,
-                                              std::vector<Point>& meshBoundaryPolygon) const
+                                              std::vector<size_t>& loopNodes) const
 {
     size_t e = 0;
-    bool currentNodeInPolygon = false;
     while (e < m_nodesNumEdges[currentNode])
     {
-        if (!currentNodeInPolygon)
-        {
-            currentNodeInPolygon = IsPointInPolygonNodes(m_nodes[currentNode], polygonNodes, m_projection);
-        }
-
-        if (!currentNodeInPolygon)
-        {
-            break;
-        }
-
         const auto currentEdge = m_nodesEdges[currentNode][e];
         if (isVisited[currentEdge] || !IsEdgeOnBoundary(currentEdge))
         {
@@ -1897,9 +2652,8 @@ void meshkernel::Mesh2D::WalkBoundaryFromNode(const std::vector<Point>& polygonN
 
         currentNode = OtherNodeOfEdge(m_edges[currentEdge], currentNode);
         e = 0;
-        currentNodeInPolygon = false;
 
-        meshBoundaryPolygon.emplace_back(m_nodes[currentNode]);
+        loopNodes.emplace_back(currentNode);
         isVisited[currentEdge] = true;
     }
 }
@@ -2018,6 +2772,8 @@ void meshkernel::Mesh2D::DeleteMesh(const Polygons& polygons, int deletionOption
 
     m_nodesRTreeRequiresUpdate = true;
     m_edgesRTreeRequiresUpdate = true;
+    m_boundaryLoopsRequireUpdate = true;
+    m_facesRequireUpdate = true;
 
     Administrate(AdministrationOptions::AdministrateMeshEdges);
 }
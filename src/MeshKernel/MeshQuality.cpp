@@ -0,0 +1,163 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <MeshKernel/Instrumentation.hpp>
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/MeshQuality.hpp>
+
+meshkernel::MeshQuality::MeshQuality(std::shared_ptr<Mesh2D> mesh, size_t numHistogramBins) : m_mesh(mesh),
+                                                                                              m_numHistogramBins(numHistogramBins)
+{
+    if (m_numHistogramBins == 0)
+    {
+        throw std::invalid_argument("MeshQuality::MeshQuality: The number of histogram bins must be positive.");
+    }
+}
+
+void meshkernel::MeshQuality::Compute()
+{
+    MESHKERNEL_TIME_SCOPE("MeshQuality::Compute");
+
+    auto& orthogonality = m_values[static_cast<size_t>(Metric::Orthogonality)];
+    auto& smoothness = m_values[static_cast<size_t>(Metric::Smoothness)];
+    auto& flowEdgeLengthRatio = m_values[static_cast<size_t>(Metric::FlowEdgeLengthRatio)];
+    auto& aspectRatio = m_values[static_cast<size_t>(Metric::AspectRatio)];
+
+    // the per-edge metrics, in a single sweep
+    const auto numEdges = static_cast<int>(m_mesh->GetNumEdges());
+    orthogonality.resize(numEdges);
+    smoothness.resize(numEdges);
+    flowEdgeLengthRatio.resize(numEdges);
+#pragma omp parallel for
+    for (int e = 0; e < numEdges; ++e)
+    {
+        orthogonality[e] = m_mesh->GetEdgeOrthogonality(e);
+        smoothness[e] = m_mesh->GetEdgeSmoothness(e);
+        flowEdgeLengthRatio[e] = m_mesh->GetFlowEdgeLengthRatio(e);
+    }
+
+    // the per-face metrics
+    const auto numFaces = static_cast<int>(m_mesh->GetNumFaces());
+    std::vector<char> isObtuseTriangle(numFaces);
+#pragma omp parallel for
+    for (int f = 0; f < numFaces; ++f)
+    {
+        isObtuseTriangle[f] = m_mesh->IsObtuseTriangle(f) ? 1 : 0;
+    }
+    m_obtuseTriangles.clear();
+    for (int f = 0; f < numFaces; ++f)
+    {
+        if (isObtuseTriangle[f] != 0)
+        {
+            m_obtuseTriangles.emplace_back(f);
+        }
+    }
+
+    aspectRatio.clear();
+    m_mesh->ComputeAspectRatios(aspectRatio);
+
+    for (size_t m = 0; m < NumMetrics; ++m)
+    {
+        m_statistics[m] = ComputeStatistics(m_values[m]);
+    }
+}
+
+meshkernel::QualityStatistics meshkernel::MeshQuality::ComputeStatistics(const std::vector<double>& values) const
+{
+    QualityStatistics statistics;
+    statistics.m_histogram.assign(m_numHistogramBins, 0);
+
+    double sum = 0.0;
+    for (const auto& value : values)
+    {
+        if (value == doubleMissingValue)
+        {
+            continue;
+        }
+        statistics.m_minimum = statistics.m_numValues == 0 ? value : std::min(statistics.m_minimum, value);
+        statistics.m_maximum = statistics.m_numValues == 0 ? value : std::max(statistics.m_maximum, value);
+        sum += value;
+        statistics.m_numValues++;
+    }
+    if (statistics.m_numValues == 0)
+    {
+        return statistics;
+    }
+    statistics.m_mean = sum / static_cast<double>(statistics.m_numValues);
+
+    const auto range = statistics.m_maximum - statistics.m_minimum;
+    for (const auto& value : values)
+    {
+        if (value == doubleMissingValue)
+        {
+            continue;
+        }
+        size_t bin = 0;
+        if (range > 0.0)
+        {
+            bin = std::min(static_cast<size_t>((value - statistics.m_minimum) / range * static_cast<double>(m_numHistogramBins)), m_numHistogramBins - 1);
+        }
+        statistics.m_histogram[bin]++;
+    }
+
+    return statistics;
+}
+
+std::vector<size_t> meshkernel::MeshQuality::GetEdgesCrossingSmallFlowEdges(double smallFlowEdgesThreshold) const
+{
+    const auto& flowEdgeLengthRatio = GetValues(Metric::FlowEdgeLengthRatio);
+
+    std::vector<size_t> result;
+    for (size_t e = 0; e < flowEdgeLengthRatio.size(); ++e)
+    {
+        if (flowEdgeLengthRatio[e] != doubleMissingValue && flowEdgeLengthRatio[e] < smallFlowEdgesThreshold)
+        {
+            result.emplace_back(e);
+        }
+    }
+    return result;
+}
+
+std::string meshkernel::MeshQuality::GetMetricName(Metric metric)
+{
+    switch (metric)
+    {
+    case Metric::Orthogonality:
+        return "Orthogonality";
+    case Metric::Smoothness:
+        return "Smoothness";
+    case Metric::AspectRatio:
+        return "AspectRatio";
+    case Metric::FlowEdgeLengthRatio:
+        return "FlowEdgeLengthRatio";
+    default:
+        return "";
+    }
+}
@@ -37,6 +37,7 @@
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/MeshRefinement.hpp>
 #include <MeshKernel/Operations.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 #include <MeshKernel/RTree.hpp>
 
 meshkernel::MeshRefinement::MeshRefinement(std::shared_ptr<Mesh2D> mesh,
@@ -93,8 +94,16 @@ void meshkernel::MeshRefinement::Compute()
     ComputeNodeMaskAtPolygonPerimeter();
 
     auto numFacesAfterRefinement = m_mesh->GetNumFaces();
+    bool isCancelled = false;
     for (auto level = 0; level < m_interpolationParameters.MaxNumberOfRefinementIterations; level++)
     {
+        // a cancelled refinement stops between two levels, the hanging nodes are still connected below
+        isCancelled = !ProgressMonitor::TryReport(static_cast<double>(level) / static_cast<double>(m_interpolationParameters.MaxNumberOfRefinementIterations));
+        if (isCancelled)
+        {
+            break;
+        }
+
         if (level > 0)
         {
             FindBrotherEdges();
@@ -196,6 +205,32 @@ void meshkernel::MeshRefinement::Compute()
         ConnectHangingNodes();
         m_mesh->Administrate(Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
     }
+
+    // the levels only add nodes, edges and faces, the mesh and the masks are at their largest now
+    ProgressMonitor::SampleMemoryUsage([this](MemoryUsage& memoryUsage) {
+        m_mesh->AccumulateMemoryUsage(memoryUsage);
+        AccumulateMemoryUsage(memoryUsage);
+    });
+
+    if (isCancelled)
+    {
+        throw OperationCancelledError("MeshRefinement::Compute: The operation has been cancelled.");
+    }
+}
+
+void meshkernel::MeshRefinement::AccumulateMemoryUsage(MemoryUsage& memoryUsage) const
+{
+    memoryUsage.AddVectors("Mesh refinement masks", m_faceMask, m_edgeMask, m_brotherEdges);
+    memoryUsage.AddVectors("Mesh refinement caches",
+                           m_isHangingNodeCache,
+                           m_isHangingEdgeCache,
+                           m_polygonNodesCache,
+                           m_localNodeIndicesCache,
+                           m_globalEdgeIndicesCache);
+    if (m_averaging != nullptr)
+    {
+        m_averaging->AccumulateMemoryUsage(memoryUsage);
+    }
 }
 
 size_t meshkernel::MeshRefinement::DeleteIsolatedHangingnodes()
@@ -471,8 +506,8 @@ void meshkernel::MeshRefinement::RefineFacesBySplittingEdges(size_t numEdgesBefo
         //Compute the center of the edge
         const auto firstNodeIndex = m_mesh->m_edges[e].first;
         const auto secondNodeIndex = m_mesh->m_edges[e].second;
-        const auto firstNode = m_mesh->m_nodes[firstNodeIndex];
-        const auto secondNode = m_mesh->m_nodes[secondNodeIndex];
+        const Point firstNode = m_mesh->m_nodes[firstNodeIndex];
+        const Point secondNode = m_mesh->m_nodes[secondNodeIndex];
 
         Point middle{(firstNode.x + secondNode.x) * 0.5, (firstNode.y + secondNode.y) * 0.5};
         if (m_mesh->m_projection == Projection::spherical)
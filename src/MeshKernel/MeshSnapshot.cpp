@@ -0,0 +1,594 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <MeshKernel/Constants.hpp>
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/MeshSnapshot.hpp>
+
+namespace
+{
+    static_assert(sizeof(size_t) == sizeof(std::uint64_t), "Indices are stored as 64 bits unsigned integers");
+    static_assert(sizeof(meshkernel::Point) == 2 * sizeof(double), "Points are stored as pairs of doubles");
+    static_assert(sizeof(meshkernel::Edge) == 2 * sizeof(std::uint64_t), "Edges are stored as pairs of 64 bits unsigned integers");
+
+    /// @brief The sections of a snapshot, in file order
+    enum Section : size_t
+    {
+        NodesXSection,
+        NodesYSection,
+        NodesEdgesOffsetsSection,
+        NodesEdgesSection,
+        NodesTypesSection,
+        EdgesSection,
+        EdgesNumFacesSection,
+        EdgesFacesSection,
+        FacesOffsetsSection,
+        FacesNodesSection,
+        FacesEdgesSection,
+        FacesCircumcentersSection,
+        FacesMassCentersSection,
+        FacesAreasSection,
+        NumSections
+    };
+
+    /// @brief The size in bytes of one element of each section
+    constexpr std::array<size_t, NumSections> sectionElementSizes{sizeof(double),
+                                                                  sizeof(double),
+                                                                  sizeof(std::uint64_t),
+                                                                  sizeof(std::uint64_t),
+                                                                  sizeof(std::int32_t),
+                                                                  sizeof(meshkernel::Edge),
+                                                                  sizeof(std::uint64_t),
+                                                                  2 * sizeof(std::uint64_t),
+                                                                  sizeof(std::uint64_t),
+                                                                  sizeof(std::uint64_t),
+                                                                  sizeof(std::uint64_t),
+                                                                  sizeof(meshkernel::Point),
+                                                                  sizeof(meshkernel::Point),
+                                                                  sizeof(double)};
+
+    constexpr std::array<char, 8> snapshotMagic{'M', 'K', 'S', 'N', 'A', 'P', 'S', 'H'};
+    constexpr std::uint32_t byteOrderMark = 0x01020304;
+    constexpr size_t sectionAlignment = 8;
+
+    /// @brief The location of a section in the file
+    struct SectionEntry
+    {
+        std::uint64_t offset; ///< The offset in bytes from the start of the file
+        std::uint64_t count;  ///< The number of elements
+    };
+
+    /// @brief The snapshot file header
+    struct SnapshotHeader
+    {
+        std::array<char, 8> magic;                      ///< The file identifier
+        std::uint32_t version;                          ///< The format version
+        std::uint32_t byteOrderMark;                    ///< Used to detect byte order mismatches
+        std::uint32_t projection;                       ///< The mesh projection
+        std::uint32_t numSections;                      ///< The number of sections
+        std::array<SectionEntry, NumSections> sections; ///< The section table
+    };
+
+    /// @brief Converts a vector of vectors to offsets and concatenated values (compressed row format)
+    /// @param[in] rows The vector of vectors, rows beyond its size are considered empty
+    /// @param[in] numRows The number of rows to convert
+    /// @param[out] offsets The offsets of each row in values, with numRows + 1 entries
+    /// @param[out] values The concatenated values
+    void ToCompressedRows(const std::vector<std::vector<size_t>>& rows, size_t numRows, std::vector<std::uint64_t>& offsets, std::vector<std::uint64_t>& values)
+    {
+        offsets.resize(numRows + 1);
+        offsets[0] = 0;
+        for (size_t r = 0; r < numRows; ++r)
+        {
+            offsets[r + 1] = offsets[r] + (r < rows.size() ? rows[r].size() : 0);
+        }
+
+        values.clear();
+        values.reserve(offsets.back());
+        for (size_t r = 0; r < std::min(numRows, rows.size()); ++r)
+        {
+            values.insert(values.end(), rows[r].begin(), rows[r].end());
+        }
+    }
+
+    /// @brief Converts offsets and concatenated values to a vector of vectors
+    std::vector<std::vector<size_t>> FromCompressedRows(const meshkernel::ArrayView<std::uint64_t>& offsets, const meshkernel::ArrayView<std::uint64_t>& values)
+    {
+        std::vector<std::vector<size_t>> rows(offsets.empty() ? 0 : offsets.size() - 1);
+        for (size_t r = 0; r < rows.size(); ++r)
+        {
+            rows[r].assign(values.begin() + offsets[r], values.begin() + offsets[r + 1]);
+        }
+        return rows;
+    }
+} // namespace
+
+void meshkernel::MeshSnapshot::Write(const std::string& filePath, const Mesh2D& mesh)
+{
+    const auto numNodes = mesh.GetNumNodes();
+    const auto numEdges = mesh.GetNumEdges();
+    const auto numFaces = mesh.GetNumFaces();
+
+    if (mesh.m_nodesTypes.size() < numNodes ||
+        mesh.m_edgesNumFaces.size() < numEdges ||
+        mesh.m_edgesFaces.size() < numEdges ||
+        mesh.m_facesNodes.size() < numFaces ||
+        mesh.m_facesEdges.size() < numFaces ||
+        mesh.m_facesCircumcenters.size() < numFaces ||
+        mesh.m_facesMassCenters.size() < numFaces ||
+        mesh.m_faceArea.size() < numFaces)
+    {
+        throw std::invalid_argument("MeshSnapshot::Write: The mesh faces have not been administered.");
+    }
+
+    // the variable length mappings in compressed row format
+    std::vector<std::uint64_t> nodesEdgesOffsets;
+    std::vector<std::uint64_t> nodesEdges;
+    ToCompressedRows(mesh.m_nodesEdges, numNodes, nodesEdgesOffsets, nodesEdges);
+
+    std::vector<std::uint64_t> facesOffsets;
+    std::vector<std::uint64_t> facesNodes;
+    ToCompressedRows(mesh.m_facesNodes, numFaces, facesOffsets, facesNodes);
+
+    std::vector<std::uint64_t> facesEdgesOffsets;
+    std::vector<std::uint64_t> facesEdges;
+    ToCompressedRows(mesh.m_facesEdges, numFaces, facesEdgesOffsets, facesEdges);
+    if (facesEdgesOffsets != facesOffsets)
+    {
+        throw std::invalid_argument("MeshSnapshot::Write: The number of face nodes and face edges differ.");
+    }
+
+    std::vector<std::uint64_t> edgesFaces(numEdges * 2, sizetMissingValue);
+    for (size_t e = 0; e < numEdges; ++e)
+    {
+        std::copy_n(mesh.m_edgesFaces[e].begin(), std::min<size_t>(2, mesh.m_edgesFaces[e].size()), edgesFaces.begin() + 2 * e);
+    }
+
+    // the data of each section, the node coordinate arrays are written as they are stored in the mesh
+    std::array<const void*, NumSections> sectionData{};
+    std::array<std::uint64_t, NumSections> sectionCounts{};
+    sectionData[NodesXSection] = mesh.m_nodes.GetX().data();
+    sectionCounts[NodesXSection] = numNodes;
+    sectionData[NodesYSection] = mesh.m_nodes.GetY().data();
+    sectionCounts[NodesYSection] = numNodes;
+    sectionData[NodesEdgesOffsetsSection] = nodesEdgesOffsets.data();
+    sectionCounts[NodesEdgesOffsetsSection] = nodesEdgesOffsets.size();
+    sectionData[NodesEdgesSection] = nodesEdges.data();
+    sectionCounts[NodesEdgesSection] = nodesEdges.size();
+    sectionData[NodesTypesSection] = mesh.m_nodesTypes.data();
+    sectionCounts[NodesTypesSection] = numNodes;
+    sectionData[EdgesSection] = mesh.m_edges.data();
+    sectionCounts[EdgesSection] = numEdges;
+    sectionData[EdgesNumFacesSection] = mesh.m_edgesNumFaces.data();
+    sectionCounts[EdgesNumFacesSection] = numEdges;
+    sectionData[EdgesFacesSection] = edgesFaces.data();
+    sectionCounts[EdgesFacesSection] = numEdges;
+    sectionData[FacesOffsetsSection] = facesOffsets.data();
+    sectionCounts[FacesOffsetsSection] = facesOffsets.size();
+    sectionData[FacesNodesSection] = facesNodes.data();
+    sectionCounts[FacesNodesSection] = facesNodes.size();
+    sectionData[FacesEdgesSection] = facesEdges.data();
+    sectionCounts[FacesEdgesSection] = facesEdges.size();
+    sectionData[FacesCircumcentersSection] = mesh.m_facesCircumcenters.data();
+    sectionCounts[FacesCircumcentersSection] = numFaces;
+    sectionData[FacesMassCentersSection] = mesh.m_facesMassCenters.data();
+    sectionCounts[FacesMassCentersSection] = numFaces;
+    sectionData[FacesAreasSection] = mesh.m_faceArea.data();
+    sectionCounts[FacesAreasSection] = numFaces;
+
+    SnapshotHeader header{};
+    header.magic = snapshotMagic;
+    header.version = Version;
+    header.byteOrderMark = byteOrderMark;
+    header.projection = static_cast<std::uint32_t>(mesh.m_projection);
+    header.numSections = NumSections;
+
+    std::uint64_t offset = sizeof(SnapshotHeader);
+    for (size_t s = 0; s < NumSections; ++s)
+    {
+        offset = (offset + sectionAlignment - 1) / sectionAlignment * sectionAlignment;
+        header.sections[s] = {offset, sectionCounts[s]};
+        offset += sectionCounts[s] * sectionElementSizes[s];
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::invalid_argument("MeshSnapshot::Write: Could not open " + filePath + " for writing.");
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(SnapshotHeader));
+    std::uint64_t position = sizeof(SnapshotHeader);
+    const std::array<char, sectionAlignment> padding{};
+    for (size_t s = 0; s < NumSections; ++s)
+    {
+        file.write(padding.data(), static_cast<std::streamsize>(header.sections[s].offset - position));
+        const auto numBytes = sectionCounts[s] * sectionElementSizes[s];
+        if (numBytes > 0)
+        {
+            file.write(static_cast<const char*>(sectionData[s]), static_cast<std::streamsize>(numBytes));
+        }
+        position = header.sections[s].offset + numBytes;
+    }
+
+    if (!file)
+    {
+        throw std::invalid_argument("MeshSnapshot::Write: Could not write " + filePath + ".");
+    }
+}
+
+meshkernel::MeshSnapshot::MeshSnapshot(const std::string& filePath)
+{
+#if defined(_WIN32)
+    const auto fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        throw std::invalid_argument("MeshSnapshot: Could not open " + filePath + ".");
+    }
+    m_fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(SnapshotHeader)))
+    {
+        Unmap();
+        throw std::invalid_argument("MeshSnapshot: " + filePath + " is not a mesh snapshot.");
+    }
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    m_mapHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapHandle != nullptr)
+    {
+        m_data = static_cast<const char*>(MapViewOfFile(m_mapHandle, FILE_MAP_READ, 0, 0, 0));
+    }
+#else
+    const auto fileDescriptor = open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw std::invalid_argument("MeshSnapshot: Could not open " + filePath + ".");
+    }
+
+    struct stat fileStatus
+    {
+    };
+    if (fstat(fileDescriptor, &fileStatus) != 0 || static_cast<size_t>(fileStatus.st_size) < sizeof(SnapshotHeader))
+    {
+        close(fileDescriptor);
+        throw std::invalid_argument("MeshSnapshot: " + filePath + " is not a mesh snapshot.");
+    }
+    m_size = static_cast<size_t>(fileStatus.st_size);
+
+    // the mapping stays valid after closing the file descriptor
+    auto* const data = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (data != MAP_FAILED)
+    {
+        m_data = static_cast<const char*>(data);
+    }
+#endif
+
+    if (m_data == nullptr)
+    {
+        Unmap();
+        throw std::invalid_argument("MeshSnapshot: Could not map " + filePath + ".");
+    }
+
+    try
+    {
+        Validate();
+    }
+    catch (...)
+    {
+        Unmap();
+        throw;
+    }
+}
+
+meshkernel::MeshSnapshot::~MeshSnapshot()
+{
+    Unmap();
+}
+
+void meshkernel::MeshSnapshot::Unmap()
+{
+#if defined(_WIN32)
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapHandle != nullptr)
+    {
+        CloseHandle(m_mapHandle);
+    }
+    if (m_fileHandle != nullptr)
+    {
+        CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_fileHandle = nullptr;
+    m_mapHandle = nullptr;
+}
+
+void meshkernel::MeshSnapshot::Validate() const
+{
+    SnapshotHeader header;
+    std::memcpy(&header, m_data, sizeof(SnapshotHeader));
+
+    if (header.magic != snapshotMagic)
+    {
+        throw std::invalid_argument("MeshSnapshot: The file is not a mesh snapshot.");
+    }
+    if (header.byteOrderMark != byteOrderMark)
+    {
+        throw std::invalid_argument("MeshSnapshot: The snapshot has been written with a different byte order.");
+    }
+    if (header.version != Version)
+    {
+        throw std::invalid_argument("MeshSnapshot: Unsupported snapshot version " + std::to_string(header.version) + ".");
+    }
+    if (header.projection > static_cast<std::uint32_t>(Projection::sphericalAccurate) || header.numSections != NumSections)
+    {
+        throw std::invalid_argument("MeshSnapshot: The snapshot header is corrupt.");
+    }
+
+    for (size_t s = 0; s < NumSections; ++s)
+    {
+        const auto& [offset, count] = header.sections[s];
+        if (offset % sectionAlignment != 0 || offset > m_size || count > (m_size - offset) / sectionElementSizes[s])
+        {
+            throw std::invalid_argument("MeshSnapshot: The snapshot is truncated or corrupt.");
+        }
+    }
+
+    // the offsets must address the concatenated values
+    const auto validateOffsets = [](const ArrayView<std::uint64_t>& offsets, size_t numRows, size_t numValues) {
+        if (numRows == 0 && offsets.empty())
+        {
+            return;
+        }
+        if (offsets.size() != numRows + 1 || offsets[0] != 0 || offsets[numRows] != numValues || !std::is_sorted(offsets.begin(), offsets.end()))
+        {
+            throw std::invalid_argument("MeshSnapshot: The snapshot offsets are corrupt.");
+        }
+    };
+
+    const auto numNodes = NodesX().size();
+    const auto numEdges = Edges().size();
+    const auto numFaces = FacesCircumcenters().size();
+    validateOffsets(NodesEdgesOffsets(), numNodes, NodesEdges().size());
+    validateOffsets(FacesOffsets(), numFaces, FacesNodes().size());
+    if (NodesY().size() != numNodes ||
+        NodesTypes().size() != numNodes ||
+        EdgesNumFaces().size() != numEdges ||
+        EdgesFaces().size() != 2 * numEdges ||
+        FacesEdges().size() != FacesNodes().size() ||
+        FacesMassCenters().size() != numFaces ||
+        FacesAreas().size() != numFaces)
+    {
+        throw std::invalid_argument("MeshSnapshot: The snapshot section sizes are inconsistent.");
+    }
+
+    // the indices are used without bound checks once the mesh is restored
+    const auto validateIndices = [](const ArrayView<std::uint64_t>& indices, size_t numEntities, bool allowMissing) {
+        const auto isInvalid = [numEntities, allowMissing](std::uint64_t index) {
+            return index >= numEntities && !(allowMissing && index == sizetMissingValue);
+        };
+        if (std::any_of(indices.begin(), indices.end(), isInvalid))
+        {
+            throw std::invalid_argument("MeshSnapshot: The snapshot indices are out of range.");
+        }
+    };
+
+    const auto edges = Edges();
+    const auto isInvalidEdge = [numNodes](const Edge& edge) { return edge.first >= numNodes || edge.second >= numNodes; };
+    if (std::any_of(edges.begin(), edges.end(), isInvalidEdge))
+    {
+        throw std::invalid_argument("MeshSnapshot: The snapshot indices are out of range.");
+    }
+    validateIndices(NodesEdges(), numEdges, false);
+    validateIndices(EdgesFaces(), numFaces, true);
+    validateIndices(FacesNodes(), numNodes, false);
+    validateIndices(FacesEdges(), numEdges, false);
+
+    const auto edgesNumFaces = EdgesNumFaces();
+    if (std::any_of(edgesNumFaces.begin(), edgesNumFaces.end(), [](std::uint64_t numFaces) { return numFaces > 2; }))
+    {
+        throw std::invalid_argument("MeshSnapshot: The snapshot indices are out of range.");
+    }
+}
+
+template <typename T>
+meshkernel::ArrayView<T> meshkernel::MeshSnapshot::GetSection(size_t section) const
+{
+    SnapshotHeader header;
+    std::memcpy(&header, m_data, sizeof(SnapshotHeader));
+    const auto& [offset, count] = header.sections[section];
+    const auto numElements = count * sectionElementSizes[section] / sizeof(T);
+    return {reinterpret_cast<const T*>(m_data + offset), static_cast<size_t>(numElements)};
+}
+
+meshkernel::Projection meshkernel::MeshSnapshot::GetProjection() const
+{
+    SnapshotHeader header;
+    std::memcpy(&header, m_data, sizeof(SnapshotHeader));
+    return static_cast<Projection>(header.projection);
+}
+
+meshkernel::ArrayView<double> meshkernel::MeshSnapshot::NodesX() const
+{
+    return GetSection<double>(NodesXSection);
+}
+
+meshkernel::ArrayView<double> meshkernel::MeshSnapshot::NodesY() const
+{
+    return GetSection<double>(NodesYSection);
+}
+
+meshkernel::ArrayView<std::uint64_t> meshkernel::MeshSnapshot::NodesEdgesOffsets() const
+{
+    return GetSection<std::uint64_t>(NodesEdgesOffsetsSection);
+}
+
+meshkernel::ArrayView<std::uint64_t> meshkernel::MeshSnapshot::NodesEdges() const
+{
+    return GetSection<std::uint64_t>(NodesEdgesSection);
+}
+
+meshkernel::ArrayView<std::int32_t> meshkernel::MeshSnapshot::NodesTypes() const
+{
+    return GetSection<std::int32_t>(NodesTypesSection);
+}
+
+meshkernel::ArrayView<meshkernel::Edge> meshkernel::MeshSnapshot::Edges() const
+{
+    return GetSection<Edge>(EdgesSection);
+}
+
+meshkernel::ArrayView<std::uint64_t> meshkernel::MeshSnapshot::EdgesNumFaces() const
+{
+    return GetSection<std::uint64_t>(EdgesNumFacesSection);
+}
+
+meshkernel::ArrayView<std::uint64_t> meshkernel::MeshSnapshot::EdgesFaces() const
+{
+    return GetSection<std::uint64_t>(EdgesFacesSection);
+}
+
+meshkernel::ArrayView<std::uint64_t> meshkernel::MeshSnapshot::FacesOffsets() const
+{
+    return GetSection<std::uint64_t>(FacesOffsetsSection);
+}
+
+meshkernel::ArrayView<std::uint64_t> meshkernel::MeshSnapshot::FacesNodes() const
+{
+    return GetSection<std::uint64_t>(FacesNodesSection);
+}
+
+meshkernel::ArrayView<std::uint64_t> meshkernel::MeshSnapshot::FacesEdges() const
+{
+    return GetSection<std::uint64_t>(FacesEdgesSection);
+}
+
+meshkernel::ArrayView<meshkernel::Point> meshkernel::MeshSnapshot::FacesCircumcenters() const
+{
+    return GetSection<Point>(FacesCircumcentersSection);
+}
+
+meshkernel::ArrayView<meshkernel::Point> meshkernel::MeshSnapshot::FacesMassCenters() const
+{
+    return GetSection<Point>(FacesMassCentersSection);
+}
+
+meshkernel::ArrayView<double> meshkernel::MeshSnapshot::FacesAreas() const
+{
+    return GetSection<double>(FacesAreasSection);
+}
+
+std::shared_ptr<meshkernel::Mesh2D> meshkernel::MeshSnapshot::ToMesh2D() const
+{
+    auto mesh = std::make_shared<Mesh2D>();
+    mesh->m_projection = GetProjection();
+
+    // nodes
+    const auto nodes = NodesX();
+    mesh->m_nodes.Assign(nodes.size(), nodes.data(), NodesY().data());
+    mesh->m_nodesEdges = FromCompressedRows(NodesEdgesOffsets(), NodesEdges());
+    mesh->m_nodesEdges.resize(nodes.size());
+    mesh->m_nodesNumEdges.resize(nodes.size());
+    for (size_t n = 0; n < nodes.size(); ++n)
+    {
+        mesh->m_nodesNumEdges[n] = mesh->m_nodesEdges[n].size();
+    }
+    const auto nodesTypes = NodesTypes();
+    mesh->m_nodesTypes.assign(nodesTypes.begin(), nodesTypes.end());
+
+    // edges
+    const auto edges = Edges();
+    mesh->m_edges.assign(edges.begin(), edges.end());
+    const auto edgesNumFaces = EdgesNumFaces();
+    mesh->m_edgesNumFaces.assign(edgesNumFaces.begin(), edgesNumFaces.end());
+    const auto edgesFaces = EdgesFaces();
+    mesh->m_edgesFaces.resize(edges.size());
+    for (size_t e = 0; e < edges.size(); ++e)
+    {
+        mesh->m_edgesFaces[e] = {edgesFaces[2 * e], edgesFaces[2 * e + 1]};
+    }
+
+    // faces
+    mesh->m_facesNodes = FromCompressedRows(FacesOffsets(), FacesNodes());
+    mesh->m_facesEdges = FromCompressedRows(FacesOffsets(), FacesEdges());
+    mesh->m_numFacesNodes.resize(mesh->m_facesNodes.size());
+    for (size_t f = 0; f < mesh->m_facesNodes.size(); ++f)
+    {
+        mesh->m_numFacesNodes[f] = mesh->m_facesNodes[f].size();
+    }
+    const auto circumcenters = FacesCircumcenters();
+    mesh->m_facesCircumcenters.assign(circumcenters.begin(), circumcenters.end());
+    const auto massCenters = FacesMassCenters();
+    mesh->m_facesMassCenters.assign(massCenters.begin(), massCenters.end());
+    const auto areas = FacesAreas();
+    mesh->m_faceArea.assign(areas.begin(), areas.end());
+
+    mesh->m_numNodes = nodes.size();
+    mesh->m_numEdges = edges.size();
+    mesh->m_numFaces = circumcenters.size();
+
+    // the derived quantities are not stored, no polygon is involved so the node mask is 1 everywhere
+    mesh->m_nodeMask.assign(nodes.size(), 1);
+    mesh->ComputeEdgesLengths();
+
+    // the validated sections restore a consistent face administration, so it is not searched again
+    mesh->m_facesRequireUpdate = false;
+
+    return mesh;
+}
@@ -1185,7 +1185,6 @@ namespace meshkernel
         area = 0.0;
         double xCenterOfMass = 0.0;
         double yCenterOfMass = 0.0;
-        const double minArea = 1e-8;
         const Point reference = ReferencePoint(polygon, projection);
         const auto numberOfPointsOpenedPolygon = polygon.size() - 1;
         for (auto n = 0; n < numberOfPointsOpenedPolygon; n++)
@@ -1212,7 +1211,7 @@ namespace meshkernel
 
         isCounterClockWise = area > 0.0;
 
-        area = std::abs(area) < minArea ? minArea : area;
+        area = std::abs(area) < minimumFaceArea ? minimumFaceArea : area;
 
         const double fac = 1.0 / (3.0 * area);
         xCenterOfMass = fac * xCenterOfMass;
@@ -1249,13 +1248,13 @@ namespace meshkernel
         }
     }
 
-    std::vector<std::vector<Point>> DiscretizeTransfinite(const std::vector<Point>& sideOne,
-                                                          const std::vector<Point>& sideTwo,
-                                                          const std::vector<Point>& sideThree,
-                                                          const std::vector<Point>& sideFour,
-                                                          const Projection& projection,
-                                                          size_t numM,
-                                                          size_t numN)
+    CurvilinearGrid DiscretizeTransfinite(const std::vector<Point>& sideOne,
+                                          const std::vector<Point>& sideTwo,
+                                          const std::vector<Point>& sideThree,
+                                          const std::vector<Point>& sideFour,
+                                          const Projection& projection,
+                                          size_t numM,
+                                          size_t numN)
     {
         double totalLengthOne;
         std::vector<double> sideOneAdimensional(sideOne.size());
@@ -1277,8 +1276,12 @@ namespace meshkernel
         const auto numMPoints = numM + 1;
         const auto numNPoints = numN + 1;
 
-        std::vector<std::vector<double>> iWeightFactor(numMPoints, std::vector<double>(numNPoints));
-        std::vector<std::vector<double>> jWeightFactor(numMPoints, std::vector<double>(numNPoints));
+        // the weights are stored row-major in flat arrays, the entry (i, j) is located at i * numNPoints + j
+        const auto numPoints = numMPoints * numNPoints;
+        const auto index = [numNPoints](size_t i, size_t j) { return i * numNPoints + j; };
+
+        std::vector<double> iWeightFactor(numPoints);
+        std::vector<double> jWeightFactor(numPoints);
         for (auto i = 0; i < numMPoints; i++)
         {
             for (auto j = 0; j < numNPoints; j++)
@@ -1286,41 +1289,37 @@ namespace meshkernel
                 const double mWeight = double(i) / double(numM);
                 const double nWeight = double(j) / double(numN);
 
-                iWeightFactor[i][j] = (1.0 - nWeight) * sideThreeAdimensional[i] + nWeight * sideFourAdimensional[i];
-                jWeightFactor[i][j] = (1.0 - mWeight) * sideOneAdimensional[j] + mWeight * sideTwoAdimensional[j];
+                iWeightFactor[index(i, j)] = (1.0 - nWeight) * sideThreeAdimensional[i] + nWeight * sideFourAdimensional[i];
+                jWeightFactor[index(i, j)] = (1.0 - mWeight) * sideOneAdimensional[j] + mWeight * sideTwoAdimensional[j];
             }
         }
 
-        std::vector<std::vector<double>> weightOne(numMPoints, std::vector<double>(numNPoints));
-        std::vector<std::vector<double>> weightTwo(numMPoints, std::vector<double>(numNPoints));
-        std::vector<std::vector<double>> weightThree(numMPoints, std::vector<double>(numNPoints));
-        std::vector<std::vector<double>> weightFour(numMPoints, std::vector<double>(numNPoints));
-        for (auto i = 0; i < numMPoints; i++)
+        std::vector<double> weightOne(numPoints);
+        std::vector<double> weightTwo(numPoints);
+        std::vector<double> weightThree(numPoints);
+        std::vector<double> weightFour(numPoints);
+        for (auto k = 0; k < numPoints; k++)
         {
-            for (auto j = 0; j < numNPoints; j++)
-            {
-
-                weightOne[i][j] = (1.0 - jWeightFactor[i][j]) * totalLengthThree + jWeightFactor[i][j] * totalLengthFour;
-                weightTwo[i][j] = (1.0 - iWeightFactor[i][j]) * totalLengthOne + iWeightFactor[i][j] * totalLengthTwo;
-                weightThree[i][j] = weightTwo[i][j] / weightOne[i][j];
-                weightFour[i][j] = weightOne[i][j] / weightTwo[i][j];
-                const double wa = 1.0 / (weightThree[i][j] + weightFour[i][j]);
-                weightOne[i][j] = wa * weightThree[i][j];
-                weightTwo[i][j] = wa * weightFour[i][j];
-            }
+            weightOne[k] = (1.0 - jWeightFactor[k]) * totalLengthThree + jWeightFactor[k] * totalLengthFour;
+            weightTwo[k] = (1.0 - iWeightFactor[k]) * totalLengthOne + iWeightFactor[k] * totalLengthTwo;
+            weightThree[k] = weightTwo[k] / weightOne[k];
+            weightFour[k] = weightOne[k] / weightTwo[k];
+            const double wa = 1.0 / (weightThree[k] + weightFour[k]);
+            weightOne[k] = wa * weightThree[k];
+            weightTwo[k] = wa * weightFour[k];
         }
 
         //border points
-        std::vector<std::vector<Point>> result(numMPoints, std::vector<Point>(numNPoints));
+        CurvilinearGrid result(numM, numN);
         for (auto i = 0; i < numMPoints; i++)
         {
-            result[i][0] = sideThree[i];
-            result[i][numN] = sideFour[i];
+            result.Node(i, 0) = sideThree[i];
+            result.Node(i, numN) = sideFour[i];
         }
         for (auto i = 0; i < numNPoints; i++)
         {
-            result[0][i] = sideOne[i];
-            result[numM][i] = sideTwo[i];
+            result.Node(0, i) = sideOne[i];
+            result.Node(numM, i) = sideTwo[i];
         }
 
         // first interpolation
@@ -1328,12 +1327,13 @@ namespace meshkernel
         {
             for (auto j = 1; j < numN; j++)
             {
+                const auto k = index(i, j);
 
-                result[i][j].x = (sideOne[j].x * (1.0 - iWeightFactor[i][j]) + sideTwo[j].x * iWeightFactor[i][j]) * weightOne[i][j] +
-                                 (sideThree[i].x * (1.0 - jWeightFactor[i][j]) + sideFour[i].x * jWeightFactor[i][j]) * weightTwo[i][j];
+                result.Node(i, j).x = (sideOne[j].x * (1.0 - iWeightFactor[k]) + sideTwo[j].x * iWeightFactor[k]) * weightOne[k] +
+                                      (sideThree[i].x * (1.0 - jWeightFactor[k]) + sideFour[i].x * jWeightFactor[k]) * weightTwo[k];
 
-                result[i][j].y = (sideOne[j].y * (1.0 - iWeightFactor[i][j]) + sideTwo[j].y * iWeightFactor[i][j]) * weightOne[i][j] +
-                                 (sideThree[i].y * (1.0 - jWeightFactor[i][j]) + sideFour[i].y * jWeightFactor[i][j]) * weightTwo[i][j];
+                result.Node(i, j).y = (sideOne[j].y * (1.0 - iWeightFactor[k]) + sideTwo[j].y * iWeightFactor[k]) * weightOne[k] +
+                                      (sideThree[i].y * (1.0 - jWeightFactor[k]) + sideFour[i].y * jWeightFactor[k]) * weightTwo[k];
             }
         }
 
@@ -1342,10 +1342,11 @@ namespace meshkernel
         {
             for (auto j = 0; j < numNPoints; j++)
             {
-                weightOne[i][j] = (1.0 - jWeightFactor[i][j]) * sideThreeAdimensional[i] * totalLengthThree +
-                                  jWeightFactor[i][j] * sideFourAdimensional[i] * totalLengthFour;
-                weightTwo[i][j] = (1.0 - iWeightFactor[i][j]) * sideOneAdimensional[j] * totalLengthOne +
-                                  iWeightFactor[i][j] * sideTwoAdimensional[j] * totalLengthTwo;
+                const auto k = index(i, j);
+                weightOne[k] = (1.0 - jWeightFactor[k]) * sideThreeAdimensional[i] * totalLengthThree +
+                               jWeightFactor[k] * sideFourAdimensional[i] * totalLengthFour;
+                weightTwo[k] = (1.0 - iWeightFactor[k]) * sideOneAdimensional[j] * totalLengthOne +
+                               iWeightFactor[k] * sideTwoAdimensional[j] * totalLengthTwo;
             }
         }
 
@@ -1353,7 +1354,7 @@ namespace meshkernel
         {
             for (auto j = 0; j < numNPoints; j++)
             {
-                weightThree[i][j] = weightOne[i][j] - weightOne[i - 1][j];
+                weightThree[index(i, j)] = weightOne[index(i, j)] - weightOne[index(i - 1, j)];
             }
         }
 
@@ -1361,7 +1362,7 @@ namespace meshkernel
         {
             for (auto j = 1; j < numNPoints; j++)
             {
-                weightFour[i][j] = weightTwo[i][j] - weightTwo[i][j - 1];
+                weightFour[index(i, j)] = weightTwo[index(i, j)] - weightTwo[index(i, j - 1)];
             }
         }
 
@@ -1369,7 +1370,7 @@ namespace meshkernel
         {
             for (auto j = 1; j < numNPoints - 1; j++)
             {
-                weightOne[i][j] = 0.25 * (weightFour[i][j] + weightFour[i][j + 1] + weightFour[i - 1][j] + weightFour[i - 1][j + 1]) / weightThree[i][j];
+                weightOne[index(i, j)] = 0.25 * (weightFour[index(i, j)] + weightFour[index(i, j + 1)] + weightFour[index(i - 1, j)] + weightFour[index(i - 1, j + 1)]) / weightThree[index(i, j)];
             }
         }
 
@@ -1377,7 +1378,7 @@ namespace meshkernel
         {
             for (auto j = 1; j < numNPoints; j++)
             {
-                weightTwo[i][j] = 0.25 * (weightThree[i][j] + weightThree[i][j - 1] + weightThree[i + 1][j] + weightThree[i + 1][j - 1]) / weightFour[i][j];
+                weightTwo[index(i, j)] = 0.25 * (weightThree[index(i, j)] + weightThree[index(i, j - 1)] + weightThree[index(i + 1, j)] + weightThree[index(i + 1, j - 1)]) / weightFour[index(i, j)];
             }
         }
 
@@ -1390,8 +1391,8 @@ namespace meshkernel
             {
                 for (auto j = 0; j < numNPoints; j++)
                 {
-                    weightThree[i][j] = result[i][j].x;
-                    weightFour[i][j] = result[i][j].y;
+                    weightThree[index(i, j)] = result.Node(i, j).x;
+                    weightFour[index(i, j)] = result.Node(i, j).y;
                 }
             }
 
@@ -1399,14 +1400,14 @@ namespace meshkernel
             {
                 for (auto j = 1; j < numN; j++)
                 {
+                    const auto k = index(i, j);
+                    const double wa = 1.0 / (weightOne[k] + weightOne[index(i + 1, j)] + weightTwo[k] + weightTwo[index(i, j + 1)]);
 
-                    const double wa = 1.0 / (weightOne[i][j] + weightOne[i + 1][j] + weightTwo[i][j] + weightTwo[i][j + 1]);
-
-                    result[i][j].x = wa * (weightThree[i - 1][j] * weightOne[i][j] + weightThree[i + 1][j] * weightOne[i + 1][j] +
-                                           weightThree[i][j - 1] * weightTwo[i][j] + weightThree[i][j + 1] * weightTwo[i][j + 1]);
+                    result.Node(i, j).x = wa * (weightThree[index(i - 1, j)] * weightOne[k] + weightThree[index(i + 1, j)] * weightOne[index(i + 1, j)] +
+                                                weightThree[index(i, j - 1)] * weightTwo[k] + weightThree[index(i, j + 1)] * weightTwo[index(i, j + 1)]);
 
-                    result[i][j].y = wa * (weightFour[i - 1][j] * weightOne[i][j] + weightFour[i + 1][j] * weightOne[i + 1][j] +
-                                           weightFour[i][j - 1] * weightTwo[i][j] + weightFour[i][j + 1] * weightTwo[i][j + 1]);
+                    result.Node(i, j).y = wa * (weightFour[index(i - 1, j)] * weightOne[k] + weightFour[index(i + 1, j)] * weightOne[index(i + 1, j)] +
+                                                weightFour[index(i, j - 1)] * weightTwo[k] + weightFour[index(i, j + 1)] * weightTwo[index(i, j + 1)]);
                 }
             }
         }
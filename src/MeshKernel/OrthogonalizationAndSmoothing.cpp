@@ -32,12 +32,14 @@
 
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 #include <MeshKernel/LandBoundaries.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/OrthogonalizationAndSmoothing.hpp>
 #include <MeshKernel/Orthogonalizer.hpp>
 #include <MeshKernel/Polygons.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 #include <MeshKernel/Smoother.hpp>
 
 meshkernel::OrthogonalizationAndSmoothing::OrthogonalizationAndSmoothing(std::shared_ptr<Mesh2D> mesh,
@@ -76,8 +78,8 @@ void meshkernel::OrthogonalizationAndSmoothing::Initialize()
     m_mu = std::min(1e-2, m_mumax);
 
     // back-up original nodes, for projection on original mesh boundary
-    m_originalNodes = m_mesh->m_nodes;
-    m_orthogonalCoordinates = m_mesh->m_nodes;
+    m_originalNodes = m_mesh->m_nodes.ToPoints();
+    m_orthogonalCoordinates = m_mesh->m_nodes.ToPoints();
 
     // account for enclosing polygon
     m_landBoundaries->FindNearestMeshBoundary(m_projectToLandBoundaryOption);
@@ -103,14 +105,33 @@ void meshkernel::OrthogonalizationAndSmoothing::Initialize()
 
 void meshkernel::OrthogonalizationAndSmoothing::Compute()
 {
-    for (auto outerIter = 0; outerIter < m_orthogonalizationParameters.OuterIterations; outerIter++)
+    const auto numIterations = static_cast<double>(m_orthogonalizationParameters.OuterIterations) *
+                               static_cast<double>(m_orthogonalizationParameters.BoundaryIterations) *
+                               static_cast<double>(m_orthogonalizationParameters.InnerIterations);
+    double iteration = 0.0;
+    bool isCancelled = false;
+    for (auto outerIter = 0; outerIter < m_orthogonalizationParameters.OuterIterations && !isCancelled; outerIter++)
     {
         PrepareOuterIteration();
-        for (auto boundaryIter = 0; boundaryIter < m_orthogonalizationParameters.BoundaryIterations; boundaryIter++)
+
+        // the linear system is allocated, the inner iterations do not change the allocations
+        ProgressMonitor::SampleMemoryUsage([this](MemoryUsage& memoryUsage) {
+            m_mesh->AccumulateMemoryUsage(memoryUsage);
+            AccumulateMemoryUsage(memoryUsage);
+        });
+
+        for (auto boundaryIter = 0; boundaryIter < m_orthogonalizationParameters.BoundaryIterations && !isCancelled; boundaryIter++)
         {
             for (auto innerIter = 0; innerIter < m_orthogonalizationParameters.InnerIterations; innerIter++)
             {
+                // a cancelled orthogonalization stops between two inner iterations, the outer iteration is still finalized
+                isCancelled = !ProgressMonitor::TryReport(iteration / numIterations);
+                if (isCancelled)
+                {
+                    break;
+                }
                 InnerIteration();
+                iteration += 1.0;
 
             } // inner iteration
         }     // boundary iter
@@ -118,6 +139,11 @@ void meshkernel::OrthogonalizationAndSmoothing::Compute()
         //update mu
         FinalizeOuterIteration();
     } // outer iter
+
+    if (isCancelled)
+    {
+        throw OperationCancelledError("OrthogonalizationAndSmoothing::Compute: The operation has been cancelled.");
+    }
 }
 
 void meshkernel::OrthogonalizationAndSmoothing::PrepareOuterIteration()
@@ -173,6 +199,20 @@ void meshkernel::OrthogonalizationAndSmoothing::FinalizeOuterIteration()
     }
 }
 
+void meshkernel::OrthogonalizationAndSmoothing::AccumulateMemoryUsage(MemoryUsage& memoryUsage) const
+{
+    memoryUsage.AddVectors("Orthogonalization linear system",
+                           m_compressedEndNodeIndex,
+                           m_compressedStartNodeIndex,
+                           m_compressedWeightX,
+                           m_compressedWeightY,
+                           m_compressedRhs,
+                           m_compressedNodesNodes);
+    memoryUsage.AddVectors("Orthogonalization coordinates", m_localCoordinatesIndices, m_localCoordinates, m_orthogonalCoordinates, m_originalNodes);
+    m_smoother->AccumulateMemoryUsage(memoryUsage);
+    m_orthogonalizer->AccumulateMemoryUsage(memoryUsage);
+}
+
 void meshkernel::OrthogonalizationAndSmoothing::ComputeLinearSystemTerms()
 {
     const double max_aptf = std::max(m_orthogonalizationParameters.OrthogonalizationToSmoothingFactorBoundary, m_orthogonalizationParameters.OrthogonalizationToSmoothingFactor);
@@ -228,6 +268,8 @@ void meshkernel::OrthogonalizationAndSmoothing::ComputeLinearSystemTerms()
 
 void meshkernel::OrthogonalizationAndSmoothing::InnerIteration()
 {
+    MESHKERNEL_TIME_SCOPE("OrthogonalizationAndSmoothing::InnerIteration");
+
 #pragma omp parallel for
     for (auto n = 0; n < m_mesh->GetNumNodes(); n++)
     {
@@ -31,6 +31,7 @@
 
 #include <MeshKernel/Constants.hpp>
 #include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/Orthogonalizer.hpp>
@@ -41,6 +42,8 @@ meshkernel::Orthogonalizer::Orthogonalizer(std::shared_ptr<Mesh2D> mesh) : m_mes
 
 void meshkernel::Orthogonalizer::Compute()
 {
+    MESHKERNEL_TIME_SCOPE("Orthogonalizer::Compute");
+
     m_mesh->ComputeNodeNeighbours();
     m_weights.resize(m_mesh->GetNumNodes(), std::vector<double>(m_mesh->m_maxNumNeighbours, 0.0));
     m_rhs.resize(m_mesh->GetNumNodes(), std::vector<double>(2, 0.0));
@@ -109,3 +112,8 @@ void meshkernel::Orthogonalizer::Compute()
         }
     }
 }
+
+void meshkernel::Orthogonalizer::AccumulateMemoryUsage(MemoryUsage& memoryUsage) const
+{
+    memoryUsage.AddVectors("Orthogonalizer weights", m_aspectRatios, m_weights, m_rhs);
+}
@@ -25,12 +25,15 @@
 //
 //------------------------------------------------------------------------------
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
 #include <MeshKernel/Constants.hpp>
 #include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/Polygons.hpp>
 #include <MeshKernel/TriangulationWrapper.hpp>
@@ -46,18 +49,16 @@ namespace meshkernel
 
     std::vector<std::vector<Point>> Polygons::ComputePointsInPolygons() const
     {
+        MESHKERNEL_TIME_SCOPE("Polygons::ComputePointsInPolygons");
 
-        std::vector<std::vector<Point>> generatedPoints;
-        generatedPoints.reserve(GetNumPolygons());
-        std::vector<Point> localPolygon(GetNumNodes());
-
+        // the closed polygons are collected and validated upfront, so the parallel loop does not throw
+        std::vector<std::vector<Point>> localPolygons;
+        std::vector<double> averageTriangleAreas;
+        localPolygons.reserve(GetNumPolygons());
+        averageTriangleAreas.reserve(GetNumPolygons());
         for (const auto& index : m_indices)
         {
-            localPolygon.clear();
-            for (auto j = index[0]; j <= index[1]; ++j)
-            {
-                localPolygon.emplace_back(m_nodes[j]);
-            }
+            std::vector<Point> localPolygon(m_nodes.begin() + index[0], m_nodes.begin() + index[1] + 1);
 
             // not a closed polygon
             const auto numLocalPoints = localPolygon.size();
@@ -85,13 +86,21 @@ namespace meshkernel
                 throw AlgorithmError("Polygons::ComputePointsInPolygons: The number of triangles is <= 0.");
             }
 
+            localPolygons.emplace_back(std::move(localPolygon));
+            averageTriangleAreas.emplace_back(averageTriangleArea);
+        }
+
+        // the polygons are independent and triangulated in parallel, each result is moved out of its triangulation
+        std::vector<std::vector<Point>> generatedPoints(localPolygons.size());
+#pragma omp parallel for schedule(dynamic)
+        for (int p = 0; p < static_cast<int>(localPolygons.size()); ++p)
+        {
             TriangulationWrapper triangulationWrapper;
-            triangulationWrapper.Compute(localPolygon,
+            triangulationWrapper.Compute(localPolygons[p],
                                          TriangulationWrapper::TriangulationOptions::GeneratePoints,
-                                         averageTriangleArea,
-                                         numberOfTriangles);
+                                         averageTriangleAreas[p]);
 
-            generatedPoints.emplace_back(triangulationWrapper.m_nodes);
+            generatedPoints[p] = std::move(triangulationWrapper.m_nodes);
         }
 
         return generatedPoints;
@@ -134,15 +143,19 @@ namespace meshkernel
             throw std::invalid_argument("Polygons::RefineFirstPolygon: The indices are not valid.");
         }
 
-        const auto edgeLengths = PolygonEdgeLengths(m_nodes);
-        std::vector<double> nodeLengthCoordinate(edgeLengths.size());
-        nodeLengthCoordinate[0] = 0.0;
-        for (auto i = 1; i < edgeLengths.size(); ++i)
+        // the edge lengths and the prefix-summed arc lengths of the refined part only, indexed from the start index
+        const auto numRefinedNodes = endIndex - startIndex + 1;
+        std::vector<double> edgeLengths(numRefinedNodes, 0.0);
+        std::vector<double> nodeLengthCoordinate(numRefinedNodes, 0.0);
+        for (size_t i = 1; i < numRefinedNodes; ++i)
         {
+            edgeLengths[i - 1] = ComputeDistance(m_nodes[startIndex + i - 1], m_nodes[startIndex + i], m_projection);
             nodeLengthCoordinate[i] = nodeLengthCoordinate[i - 1] + edgeLengths[i - 1];
         }
+        const auto arcLength = [&](size_t index) { return nodeLengthCoordinate[index - startIndex]; };
+        const auto edgeLength = [&](size_t index) { return edgeLengths[index - startIndex]; };
 
-        const auto numNodesRefinedPart = size_t(std::ceil((nodeLengthCoordinate[endIndex] - nodeLengthCoordinate[startIndex]) / refinementDistance) + (double(endIndex) - double(startIndex)));
+        const auto numNodesRefinedPart = size_t(std::ceil(arcLength(endIndex) / refinementDistance) + (double(endIndex) - double(startIndex)));
         const auto numNodesNotRefinedPart = startIndex - m_indices[polygonIndex][0] + m_indices[polygonIndex][1] - endIndex;
         const auto totalNumNodes = numNodesRefinedPart + numNodesNotRefinedPart;
         std::vector<Point> refinedPolygon;
@@ -159,13 +172,13 @@ namespace meshkernel
         auto nextNodeIndex = nodeIndex + 1;
         Point p0 = m_nodes[nodeIndex];
         Point p1 = m_nodes[nextNodeIndex];
-        double pointLengthCoordinate = nodeLengthCoordinate[startIndex];
+        double pointLengthCoordinate = arcLength(startIndex);
         bool snappedToLastPoint = false;
         while (nodeIndex < endIndex)
         {
             // initial point already accounted for
             pointLengthCoordinate += refinementDistance;
-            if (pointLengthCoordinate > nodeLengthCoordinate[nextNodeIndex])
+            if (pointLengthCoordinate > arcLength(nextNodeIndex))
             {
                 // if not snapped to the original last polygon point, snap it
                 if (!snappedToLastPoint)
@@ -177,7 +190,7 @@ namespace meshkernel
                 bool nextNodeFound = false;
                 for (auto i = nextNodeIndex + 1; i <= endIndex; ++i)
                 {
-                    if (nodeLengthCoordinate[i] > pointLengthCoordinate)
+                    if (arcLength(i) > pointLengthCoordinate)
                     {
                         nextNodeFound = true;
                         nodeIndex = i - 1;
@@ -192,11 +205,11 @@ namespace meshkernel
 
                 p0 = m_nodes[nodeIndex];
                 p1 = m_nodes[nextNodeIndex];
-                pointLengthCoordinate = nodeLengthCoordinate[nodeIndex] + refinementDistance;
+                pointLengthCoordinate = arcLength(nodeIndex) + refinementDistance;
                 snappedToLastPoint = false;
             }
-            double distanceFromLastNode = pointLengthCoordinate - nodeLengthCoordinate[nodeIndex];
-            const double factor = distanceFromLastNode / edgeLengths[nodeIndex];
+            double distanceFromLastNode = pointLengthCoordinate - arcLength(nodeIndex);
+            const double factor = distanceFromLastNode / edgeLength(nodeIndex);
             Point p;
             if (IsEqual(factor, 1.0))
             {
@@ -205,7 +218,7 @@ namespace meshkernel
             }
             else
             {
-                p = p0 + (p1 - p0) * distanceFromLastNode / edgeLengths[nodeIndex];
+                p = p0 + (p1 - p0) * distanceFromLastNode / edgeLength(nodeIndex);
             }
             refinedPolygon.emplace_back(p);
         }
@@ -221,45 +234,11 @@ namespace meshkernel
 
     Polygons Polygons::OffsetCopy(double distance, bool innerAndOuter) const
     {
-        auto sizenewPolygon = GetNumNodes();
+        const auto numNodes = GetNumNodes();
+        auto sizenewPolygon = numNodes;
         if (innerAndOuter)
         {
-            sizenewPolygon += GetNumNodes() + 1;
-        }
-
-        std::vector<Point> normalVectors(sizenewPolygon);
-        double dxNormalPreviousEdge = 0.0;
-        double dyNormalPreviousEdge = 0.0;
-        double dxNormal = 0.0;
-        double dyNormal = 0.0;
-        for (auto n = 0; n < GetNumNodes(); n++)
-        {
-            if (n < GetNumNodes() - 1)
-            {
-                const auto dx = GetDx(m_nodes[n], m_nodes[n + 1], m_projection);
-                const auto dy = GetDy(m_nodes[n], m_nodes[n + 1], m_projection);
-                const auto nodeDistance = std::sqrt(dx * dx + dy * dy);
-                dxNormal = -dy / nodeDistance;
-                dyNormal = dx / nodeDistance;
-            }
-            else
-            {
-                dxNormal = dxNormalPreviousEdge;
-                dyNormal = dyNormalPreviousEdge;
-            }
-
-            if (n == 0)
-            {
-                dxNormalPreviousEdge = dxNormal;
-                dyNormalPreviousEdge = dyNormal;
-            }
-
-            const double factor = 1.0 / (1.0 + dxNormalPreviousEdge * dxNormal + dyNormalPreviousEdge * dyNormal);
-            normalVectors[n].x = factor * (dxNormalPreviousEdge + dxNormal);
-            normalVectors[n].y = factor * (dyNormalPreviousEdge + dyNormal);
-
-            dxNormalPreviousEdge = dxNormal;
-            dyNormalPreviousEdge = dyNormal;
+            sizenewPolygon += numNodes + 1;
         }
 
         // negative sign introduced because normal vector pointing inward
@@ -269,11 +248,30 @@ namespace meshkernel
             distance = distance / (earth_radius * degrad_hp);
         }
 
+        // the unit normal of the edge starting at a node
+        const auto edgeNormal = [&](size_t n) {
+            const auto dx = GetDx(m_nodes[n], m_nodes[n + 1], m_projection);
+            const auto dy = GetDy(m_nodes[n], m_nodes[n + 1], m_projection);
+            const auto nodeDistance = std::sqrt(dx * dx + dy * dy);
+            return Point{-dy / nodeDistance, dx / nodeDistance};
+        };
+
+        // each node is offset along the bisector of its previous and next edge normals, the nodes are independent
         std::vector<Point> newPolygonPoints(sizenewPolygon, {doubleMissingValue, doubleMissingValue});
-        for (auto i = 0; i < GetNumNodes(); i++)
+#pragma omp parallel for
+        for (int i = 0; i < static_cast<int>(numNodes); i++)
         {
-            auto dx = normalVectors[i].x * distance;
-            const auto dy = normalVectors[i].y * distance;
+            Point normalPreviousEdge{0.0, 0.0};
+            Point normal{0.0, 0.0};
+            if (numNodes > 1)
+            {
+                normalPreviousEdge = edgeNormal(i == 0 ? 0 : i - 1);
+                normal = i < static_cast<int>(numNodes) - 1 ? edgeNormal(i) : normalPreviousEdge;
+            }
+
+            const double factor = 1.0 / (1.0 + normalPreviousEdge.x * normal.x + normalPreviousEdge.y * normal.y);
+            auto dx = factor * (normalPreviousEdge.x + normal.x) * distance;
+            const auto dy = factor * (normalPreviousEdge.y + normal.y) * distance;
             if (m_projection == Projection::spherical)
             {
                 dx = dx / std::cos((m_nodes[i].y + 0.5 * dy) * degrad_hp);
@@ -283,8 +281,8 @@ namespace meshkernel
 
             if (innerAndOuter)
             {
-                newPolygonPoints[i + GetNumNodes() + 1].x = m_nodes[i].x - dx;
-                newPolygonPoints[i + GetNumNodes() + 1].y = m_nodes[i].y - dy;
+                newPolygonPoints[i + numNodes + 1].x = m_nodes[i].x - dx;
+                newPolygonPoints[i + numNodes + 1].y = m_nodes[i].y - dy;
             }
         }
 
@@ -316,6 +314,11 @@ namespace meshkernel
     }
 
     size_t Polygons::PolygonIndex(Point point) const
+    {
+        return PolygonIndex(point, ComputeBoundingBoxes());
+    }
+
+    size_t Polygons::PolygonIndex(Point point, const std::vector<std::pair<Point, Point>>& boundingBoxes) const
     {
         // empty polygon means everything is included
         if (m_indices.empty())
@@ -323,32 +326,15 @@ namespace meshkernel
             return true;
         }
 
-        bool inPolygon = false;
         for (auto polygonIndex = 0; polygonIndex < GetNumPolygons(); ++polygonIndex)
         {
-            auto polygonStartIndex = m_indices[polygonIndex][0];
-            auto polygonEndIndex = m_indices[polygonIndex][1];
-
-            // Calculate the bounding box
-            double XMin = std::numeric_limits<double>::max();
-            double XMax = std::numeric_limits<double>::lowest();
-            double YMin = std::numeric_limits<double>::max();
-            double YMax = std::numeric_limits<double>::lowest();
-
-            for (auto n = polygonStartIndex; n <= polygonEndIndex; n++)
-            {
-                XMin = std::min(XMin, m_nodes[n].x);
-                XMax = std::max(XMax, m_nodes[n].x);
-                YMin = std::min(YMin, m_nodes[n].y);
-                YMax = std::max(YMax, m_nodes[n].y);
-            }
-
-            if ((point.x >= XMin && point.x <= XMax) && (point.y >= YMin && point.y <= YMax))
+            const auto& [lowerLeft, upperRight] = boundingBoxes[polygonIndex];
+            if (!IsValueInBoundingBox(point, lowerLeft, upperRight))
             {
-                inPolygon = IsPointInPolygonNodes(point, m_nodes, m_projection, Point(), polygonStartIndex, polygonEndIndex);
+                continue;
             }
 
-            if (inPolygon)
+            if (IsPointInPolygonNodes(point, m_nodes, m_projection, Point(), m_indices[polygonIndex][0], m_indices[polygonIndex][1]))
             {
                 return polygonIndex;
             }
@@ -357,12 +343,36 @@ namespace meshkernel
         return sizetMissingValue;
     }
 
+    std::vector<std::pair<Point, Point>> Polygons::ComputeBoundingBoxes() const
+    {
+        std::vector<std::pair<Point, Point>> result;
+        result.reserve(GetNumPolygons());
+        for (const auto& indices : m_indices)
+        {
+            Point lowerLeft{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+            Point upperRight{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+            for (auto n = indices[0]; n <= indices[1]; n++)
+            {
+                lowerLeft.x = std::min(lowerLeft.x, m_nodes[n].x);
+                lowerLeft.y = std::min(lowerLeft.y, m_nodes[n].y);
+                upperRight.x = std::max(upperRight.x, m_nodes[n].x);
+                upperRight.y = std::max(upperRight.y, m_nodes[n].y);
+            }
+            result.emplace_back(lowerLeft, upperRight);
+        }
+        return result;
+    }
+
     std::vector<size_t> Polygons::PolygonIndices(const std::vector<Point>& points) const
     {
+        MESHKERNEL_TIME_SCOPE("Polygons::PolygonIndices");
+
+        const auto boundingBoxes = ComputeBoundingBoxes();
         std::vector<size_t> result(points.size(), sizetMissingValue);
-        for (auto i = 0; i < points.size(); ++i)
+#pragma omp parallel for
+        for (int i = 0; i < static_cast<int>(points.size()); ++i)
         {
-            result[i] = PolygonIndex(points[i]);
+            result[i] = PolygonIndex(points[i], boundingBoxes);
         }
         return result;
     }
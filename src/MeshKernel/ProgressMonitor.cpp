@@ -0,0 +1,127 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
+
+thread_local meshkernel::ProgressMonitor* meshkernel::ProgressMonitor::m_current = nullptr;
+
+meshkernel::ProgressMonitor::ProgressMonitor(Callback callback) : m_callback(std::move(callback))
+{
+}
+
+void meshkernel::ProgressMonitor::RequestCancellation()
+{
+    m_isCancellationRequested = true;
+}
+
+bool meshkernel::ProgressMonitor::IsCancellationRequested() const
+{
+    return m_isCancellationRequested || (m_outer != nullptr && m_outer->IsCancellationRequested());
+}
+
+double meshkernel::ProgressMonitor::GetProgress() const
+{
+    return m_progress;
+}
+
+void meshkernel::ProgressMonitor::EnableMemoryUsageSampling()
+{
+    m_isMemoryUsageSampled = true;
+}
+
+size_t meshkernel::ProgressMonitor::GetLargestMemoryUsage() const
+{
+    return m_largestMemoryUsage;
+}
+
+void meshkernel::ProgressMonitor::Report(double progress)
+{
+    if (!TryReport(progress))
+    {
+        throw OperationCancelledError("ProgressMonitor::Report: The operation has been cancelled.");
+    }
+}
+
+bool meshkernel::ProgressMonitor::TryReport(double progress)
+{
+    if (m_current == nullptr)
+    {
+        return true;
+    }
+
+    if (m_current->IsCancellationRequested())
+    {
+        return false;
+    }
+
+    // the progress of a nested monitor is the progress of the monitors it is nested in
+    for (auto monitor = m_current; monitor != nullptr; monitor = monitor->m_outer)
+    {
+        monitor->m_progress = std::clamp(progress, 0.0, 1.0);
+        if (monitor->m_callback)
+        {
+            monitor->m_callback(monitor->m_progress);
+        }
+    }
+    return true;
+}
+
+void meshkernel::ProgressMonitor::CheckCancellation()
+{
+    if (m_current != nullptr && m_current->IsCancellationRequested())
+    {
+        throw OperationCancelledError("ProgressMonitor::CheckCancellation: The operation has been cancelled.");
+    }
+}
+
+void meshkernel::ProgressMonitor::SampleMemoryUsage(const MemoryUsageAccumulator& accumulate)
+{
+    if (m_current == nullptr || !m_current->m_isMemoryUsageSampled)
+    {
+        return;
+    }
+
+    MemoryUsage memoryUsage;
+    accumulate(memoryUsage);
+    m_current->m_largestMemoryUsage = std::max(m_current->m_largestMemoryUsage, memoryUsage.GetTotal());
+}
+
+meshkernel::ProgressMonitorScope::ProgressMonitorScope(ProgressMonitor& progressMonitor) : m_progressMonitor(progressMonitor),
+                                                                                          m_previous(ProgressMonitor::m_current)
+{
+    m_progressMonitor.m_outer = m_previous;
+    ProgressMonitor::m_current = &m_progressMonitor;
+}
+
+meshkernel::ProgressMonitorScope::~ProgressMonitorScope()
+{
+    ProgressMonitor::m_current = m_previous;
+    m_progressMonitor.m_outer = nullptr;
+}
@@ -25,10 +25,14 @@
 //
 //------------------------------------------------------------------------------
 
+#include <MeshKernel/Instrumentation.hpp>
+#include <MeshKernel/MemoryUsage.hpp>
 #include <MeshKernel/RTree.hpp>
 
 void meshkernel::RTree::NearestNeighborsOnSquaredDistance(Point node, double searchRadiusSquared)
 {
+    MESHKERNEL_COUNT("RTree::NearestNeighborsOnSquaredDistance queries", 1);
+
     const auto searchRadius = std::sqrt(searchRadiusSquared);
 
     const Box2D box(Point2D(node.x - searchRadius, node.y - searchRadius), Point2D(node.x + searchRadius, node.y + searchRadius));
@@ -51,6 +55,7 @@ void meshkernel::RTree::NearestNeighborsOnSquaredDistance(Point node, double sea
 
 void meshkernel::RTree::NearestNeighbors(Point node)
 {
+    MESHKERNEL_COUNT("RTree::NearestNeighbors queries", 1);
 
     m_queryCache.reserve(m_queryVectorCapacity);
     m_queryCache.clear();
@@ -79,3 +84,19 @@ void meshkernel::RTree::InsertNode(const Point& node)
     m_points.emplace_back(Point2D{node.x, node.y}, m_points.size());
     m_rtree2D.insert(m_points.end() - 1, m_points.end());
 }
+
+void meshkernel::RTree::Clear()
+{
+    m_rtree2D = RTree2D();
+    m_points = std::vector<std::pair<Point2D, size_t>>();
+    m_queryCache = std::vector<value2D>();
+    m_queryIndices = std::vector<size_t>();
+}
+
+size_t meshkernel::RTree::GetMemoryUsage() const
+{
+    return m_rtree2D.size() * sizeof(value2D) +
+           GetVectorMemoryUsage(m_points) +
+           GetVectorMemoryUsage(m_queryCache) +
+           GetVectorMemoryUsage(m_queryIndices);
+}
@@ -0,0 +1,226 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <MeshKernel/Constants.hpp>
+#include <MeshKernel/Instrumentation.hpp>
+#include <MeshKernel/SampleBins.hpp>
+
+namespace
+{
+    /// @brief Spreads the bits of a grid index, below 2^32, to the even bits of a key
+    std::uint64_t SpreadBits(std::uint64_t index)
+    {
+        index &= 0xFFFFFFFF;
+        index = (index | index << 16) & 0x0000FFFF0000FFFF;
+        index = (index | index << 8) & 0x00FF00FF00FF00FF;
+        index = (index | index << 4) & 0x0F0F0F0F0F0F0F0F;
+        index = (index | index << 2) & 0x3333333333333333;
+        index = (index | index << 1) & 0x5555555555555555;
+        return index;
+    }
+
+    /// @brief Collects the even bits of a key into a grid index
+    std::uint64_t CompactBits(std::uint64_t key)
+    {
+        key &= 0x5555555555555555;
+        key = (key | key >> 1) & 0x3333333333333333;
+        key = (key | key >> 2) & 0x0F0F0F0F0F0F0F0F;
+        key = (key | key >> 4) & 0x00FF00FF00FF00FF;
+        key = (key | key >> 8) & 0x0000FFFF0000FFFF;
+        key = (key | key >> 16) & 0x00000000FFFFFFFF;
+        return key;
+    }
+
+    /// @brief Computes the Z-order key of a grid cell
+    std::uint64_t CellKey(std::uint64_t column, std::uint64_t row)
+    {
+        return SpreadBits(column) | SpreadBits(row) << 1;
+    }
+
+    /// @brief Computes the key of the cell containing a grid cell on the next coarser level
+    std::uint64_t ParentCellKey(std::uint64_t key)
+    {
+        return key >> 2;
+    }
+
+    /// @brief Checks if a sample has valid coordinates and value
+    bool IsValidSample(const meshkernel::Sample& sample)
+    {
+        return sample.IsValid() && sample.value > meshkernel::doubleMissingValue;
+    }
+
+    /// @brief Adds the samples of a bin to another bin
+    void MergeBin(meshkernel::SampleBin& bin, const meshkernel::SampleBin& other)
+    {
+        const auto count = static_cast<double>(bin.count + other.count);
+        bin.x = (bin.x * static_cast<double>(bin.count) + other.x * static_cast<double>(other.count)) / count;
+        bin.y = (bin.y * static_cast<double>(bin.count) + other.y * static_cast<double>(other.count)) / count;
+        bin.min = std::min(bin.min, other.min);
+        bin.max = std::max(bin.max, other.max);
+        bin.sum += other.sum;
+        bin.minAbs = std::min(bin.minAbs, other.minAbs);
+        bin.count += other.count;
+    }
+} // namespace
+
+meshkernel::SampleBins::SampleBins(const std::vector<Sample>& samples, double finestBinSize)
+{
+    MESHKERNEL_TIME_SCOPE("SampleBins::SampleBins");
+
+    // the bounding box of the valid samples
+    Point lowerLeft{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+    Point upperRight{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+    size_t numValidSamples = 0;
+    for (const auto& sample : samples)
+    {
+        if (IsValidSample(sample))
+        {
+            lowerLeft.x = std::min(lowerLeft.x, sample.x);
+            lowerLeft.y = std::min(lowerLeft.y, sample.y);
+            upperRight.x = std::max(upperRight.x, sample.x);
+            upperRight.y = std::max(upperRight.y, sample.y);
+            numValidSamples++;
+        }
+    }
+    if (numValidSamples == 0)
+    {
+        return;
+    }
+    m_origin = lowerLeft;
+
+    // by default, about one sample per bin on the finest level
+    const auto width = upperRight.x - lowerLeft.x;
+    const auto height = upperRight.y - lowerLeft.y;
+    m_finestBinSize = finestBinSize;
+    if (m_finestBinSize <= 0.0)
+    {
+        const auto numSamples = static_cast<double>(numValidSamples);
+        m_finestBinSize = width > 0.0 && height > 0.0 ? std::sqrt(width * height / numSamples) : std::max(width, height) / numSamples;
+        if (m_finestBinSize <= 0.0)
+        {
+            m_finestBinSize = 1.0;
+        }
+    }
+
+    // the grid indices must fit in the 32 bits per axis of the cell keys
+    m_finestBinSize = std::max(m_finestBinSize, std::max(width, height) / m_maximumNumberOfCellsPerAxis);
+
+    // sort the samples by grid cell, along the Z-order curve
+    std::vector<std::pair<std::uint64_t, size_t>> sampleKeys;
+    sampleKeys.reserve(numValidSamples);
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        if (IsValidSample(samples[i]))
+        {
+            const auto column = static_cast<std::uint64_t>((samples[i].x - m_origin.x) / m_finestBinSize);
+            const auto row = static_cast<std::uint64_t>((samples[i].y - m_origin.y) / m_finestBinSize);
+            sampleKeys.emplace_back(CellKey(column, row), i);
+        }
+    }
+    std::sort(sampleKeys.begin(), sampleKeys.end());
+
+    // aggregate the samples of each cell
+    m_sampleIndices.reserve(sampleKeys.size());
+    auto& bins = m_levels.emplace_back();
+    auto& keys = m_binKeys.emplace_back();
+    for (const auto& [key, index] : sampleKeys)
+    {
+        const auto& sample = samples[index];
+        const SampleBin sampleBin{sample.x, sample.y, sample.value, sample.value, sample.value, std::abs(sample.value), 1, m_sampleIndices.size()};
+        m_sampleIndices.emplace_back(index);
+        if (keys.empty() || keys.back() != key)
+        {
+            bins.emplace_back(sampleBin);
+            keys.emplace_back(key);
+            continue;
+        }
+        MergeBin(bins.back(), sampleBin);
+    }
+
+    while (m_levels.size() < m_maximumNumberOfLevels && m_levels.back().size() > 1)
+    {
+        AddCoarserLevel();
+    }
+}
+
+void meshkernel::SampleBins::AddCoarserLevel()
+{
+    const auto& fineBins = m_levels.back();
+    const auto& fineKeys = m_binKeys.back();
+
+    // on the Z-order curve, the children of a cell are consecutive
+    std::vector<SampleBin> bins;
+    std::vector<std::uint64_t> keys;
+    for (size_t i = 0; i < fineBins.size(); ++i)
+    {
+        const auto key = ParentCellKey(fineKeys[i]);
+        if (keys.empty() || keys.back() != key)
+        {
+            bins.emplace_back(fineBins[i]);
+            keys.emplace_back(key);
+            continue;
+        }
+        MergeBin(bins.back(), fineBins[i]);
+    }
+
+    m_levels.emplace_back(std::move(bins));
+    m_binKeys.emplace_back(std::move(keys));
+}
+
+double meshkernel::SampleBins::GetBinSize(size_t level) const
+{
+    return std::ldexp(m_finestBinSize, static_cast<int>(level));
+}
+
+std::tuple<meshkernel::Point, meshkernel::Point> meshkernel::SampleBins::GetBinCell(size_t level, size_t bin) const
+{
+    const auto key = m_binKeys[level][bin];
+    const auto binSize = GetBinSize(level);
+    const Point lowerLeft{m_origin.x + static_cast<double>(CompactBits(key)) * binSize,
+                          m_origin.y + static_cast<double>(CompactBits(key >> 1)) * binSize};
+    return {lowerLeft, {lowerLeft.x + binSize, lowerLeft.y + binSize}};
+}
+
+size_t meshkernel::SampleBins::SelectLevel(double searchSize) const
+{
+    size_t level = 0;
+    while (level + 1 < m_levels.size() && GetBinSize(level + 1) * m_minimumBinsAcrossSearch <= searchSize)
+    {
+        ++level;
+    }
+    return level;
+}
+
+void meshkernel::SampleBins::AccumulateMemoryUsage(MemoryUsage& memoryUsage) const
+{
+    memoryUsage.AddVectors("Sample bins", m_levels, m_binKeys, m_sampleIndices);
+}
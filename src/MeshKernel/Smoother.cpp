@@ -32,6 +32,7 @@
 #include <MeshKernel/Constants.hpp>
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/Smoother.hpp>
@@ -42,6 +43,8 @@ meshkernel::Smoother::Smoother(std::shared_ptr<Mesh2D> mesh) : m_mesh(mesh)
 
 void meshkernel::Smoother::Compute()
 {
+    MESHKERNEL_TIME_SCOPE("Smoother::Compute");
+
     // compute smoother topologies
     ComputeTopologies();
 
@@ -52,6 +55,35 @@ void meshkernel::Smoother::Compute()
     ComputeWeights();
 }
 
+void meshkernel::Smoother::AccumulateMemoryUsage(MemoryUsage& memoryUsage) const
+{
+    memoryUsage.AddVectors("Smoother operators", m_weights, m_Gxi, m_Geta, m_Divxi, m_Diveta, m_Az, m_Jxi, m_Jeta, m_ww2);
+    memoryUsage.AddVectors("Smoother topologies",
+                           m_nodeTopologyMapping,
+                           m_numTopologyNodes,
+                           m_numTopologyFaces,
+                           m_topologyXi,
+                           m_topologyEta,
+                           m_topologySharedFaces,
+                           m_topologyFaceNodeMapping,
+                           m_topologyConnectedNodes,
+                           m_numConnectedNodes,
+                           m_connectedNodes);
+    memoryUsage.AddVectors("Smoother caches",
+                           m_sharedFacesCache,
+                           m_connectedNodesCache,
+                           m_faceNodeMappingCache,
+                           m_xiCache,
+                           m_etaCache,
+                           m_boundaryEdgesCache,
+                           m_leftXFaceCenterCache,
+                           m_leftYFaceCenterCache,
+                           m_rightXFaceCenterCache,
+                           m_rightYFaceCenterCache,
+                           m_xisCache,
+                           m_etasCache);
+}
+
 void meshkernel::Smoother::ComputeTopologies()
 {
     Initialize();
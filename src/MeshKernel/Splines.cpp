@@ -54,6 +54,7 @@ void meshkernel::Splines::AddSpline(const std::vector<Point>& splines, size_t st
     m_splineDerivatives.emplace_back();
     SecondOrderDerivative(m_splineNodes.back(), size, m_splineDerivatives.back());
     m_splinesLength.emplace_back(GetSplineLength(GetNumSplines() - 1, 0.0, static_cast<double>(size - 1)));
+    m_arcLengthTables.resize(GetNumSplines());
 }
 
 void meshkernel::Splines::DeleteSpline(size_t splineIndex)
@@ -61,6 +62,10 @@ void meshkernel::Splines::DeleteSpline(size_t splineIndex)
     m_splineNodes.erase(m_splineNodes.begin() + splineIndex);
     m_splineDerivatives.erase(m_splineDerivatives.begin() + splineIndex);
     m_splinesLength.erase(m_splinesLength.begin() + splineIndex);
+    if (splineIndex < m_arcLengthTables.size())
+    {
+        m_arcLengthTables.erase(m_arcLengthTables.begin() + splineIndex);
+    }
 }
 
 void meshkernel::Splines::AddPointInExistingSpline(size_t splineIndex, const Point& point)
@@ -70,6 +75,15 @@ void meshkernel::Splines::AddPointInExistingSpline(size_t splineIndex, const Poi
         throw std::invalid_argument("Splines::AddPointInExistingSpline: Invalid spline index.");
     }
     m_splineNodes[splineIndex].emplace_back(point);
+    InvalidateArcLengthTable(splineIndex);
+}
+
+void meshkernel::Splines::InvalidateArcLengthTable(size_t splineIndex)
+{
+    if (splineIndex < m_arcLengthTables.size())
+    {
+        m_arcLengthTables[splineIndex] = ArcLengthTable();
+    }
 }
 
 bool meshkernel::Splines::GetSplinesIntersection(size_t first,
@@ -267,6 +281,85 @@ bool meshkernel::Splines::GetSplinesIntersection(size_t first,
     return false;
 }
 
+std::vector<std::vector<size_t>> meshkernel::Splines::FindCrossingCandidates() const
+{
+    const auto numSplines = GetNumSplines();
+    std::vector<std::vector<size_t>> crossingCandidates(numSplines);
+
+    if (m_projection != Projection::cartesian)
+    {
+        for (size_t s = 0; s < numSplines; ++s)
+        {
+            for (size_t other = 0; other < numSplines; ++other)
+            {
+                if (other != s)
+                {
+                    crossingCandidates[s].emplace_back(other);
+                }
+            }
+        }
+        return crossingCandidates;
+    }
+
+    struct SegmentBox
+    {
+        double lowerLeftX;
+        double lowerLeftY;
+        double upperRightX;
+        double upperRightY;
+        size_t spline;
+    };
+
+    // The boxes are slightly enlarged, so segments touching within round-off are still reported
+    std::vector<SegmentBox> segmentBoxes;
+    for (size_t s = 0; s < numSplines; ++s)
+    {
+        for (size_t n = 0; n + 1 < m_splineNodes[s].size(); ++n)
+        {
+            const auto& firstNode = m_splineNodes[s][n];
+            const auto& secondNode = m_splineNodes[s][n + 1];
+            const auto margin = 1e-6 * std::max({std::abs(secondNode.x - firstNode.x), std::abs(secondNode.y - firstNode.y), 1.0});
+            segmentBoxes.push_back({std::min(firstNode.x, secondNode.x) - margin,
+                                    std::min(firstNode.y, secondNode.y) - margin,
+                                    std::max(firstNode.x, secondNode.x) + margin,
+                                    std::max(firstNode.y, secondNode.y) + margin,
+                                    s});
+        }
+    }
+
+    // Sweep along x, keeping the boxes overlapping the sweep position active
+    std::sort(segmentBoxes.begin(), segmentBoxes.end(), [](const SegmentBox& first, const SegmentBox& second) { return first.lowerLeftX < second.lowerLeftX; });
+
+    std::vector<std::pair<size_t, size_t>> crossingPairs;
+    std::vector<SegmentBox> activeBoxes;
+    for (const auto& box : segmentBoxes)
+    {
+        activeBoxes.erase(std::remove_if(activeBoxes.begin(), activeBoxes.end(), [&box](const SegmentBox& active) { return active.upperRightX < box.lowerLeftX; }),
+                          activeBoxes.end());
+
+        for (const auto& active : activeBoxes)
+        {
+            if (active.spline != box.spline && active.lowerLeftY <= box.upperRightY && box.lowerLeftY <= active.upperRightY)
+            {
+                crossingPairs.emplace_back(std::min(active.spline, box.spline), std::max(active.spline, box.spline));
+            }
+        }
+        activeBoxes.emplace_back(box);
+    }
+
+    std::sort(crossingPairs.begin(), crossingPairs.end());
+    crossingPairs.erase(std::unique(crossingPairs.begin(), crossingPairs.end()), crossingPairs.end());
+
+    // The pairs are sorted, so the candidates of each spline are sorted as well
+    for (const auto& [first, second] : crossingPairs)
+    {
+        crossingCandidates[first].emplace_back(second);
+        crossingCandidates[second].emplace_back(first);
+    }
+
+    return crossingCandidates;
+}
+
 double meshkernel::Splines::GetSplineLength(size_t index,
                                             double startIndex,
                                             double endIndex,
@@ -316,20 +409,126 @@ double meshkernel::Splines::GetSplineLength(size_t index,
             throw AlgorithmError("Splines::GetSplineLength: Could not interpolate spline points.");
         }
 
-        double curvatureFactor = 0.0;
-        if (accountForCurvature)
-        {
-            Point normalVector;
-            Point tangentialVector;
-            ComputeCurvatureOnSplinePoint(index, 0.5 * (rightPointCoordinateOnSpline + leftPointCoordinateOnSpline), curvatureFactor, normalVector, tangentialVector);
-        }
-        splineLength = splineLength + ComputeDistance(leftPoint, rightPoint, m_projection) * (1.0 + curvatureFactor * height);
+        splineLength = splineLength + ComputeSegmentLength(index, leftPointCoordinateOnSpline, rightPointCoordinateOnSpline, leftPoint, rightPoint, accountForCurvature, height);
         leftPoint = rightPoint;
     }
 
     return splineLength;
 }
 
+double meshkernel::Splines::ComputeSegmentLength(size_t index,
+                                                 double leftCoordinate,
+                                                 double rightCoordinate,
+                                                 const Point& leftPoint,
+                                                 const Point& rightPoint,
+                                                 bool accountForCurvature,
+                                                 double height)
+{
+    double curvatureFactor = 0.0;
+    if (accountForCurvature)
+    {
+        Point normalVector;
+        Point tangentialVector;
+        ComputeCurvatureOnSplinePoint(index, 0.5 * (rightCoordinate + leftCoordinate), curvatureFactor, normalVector, tangentialVector);
+    }
+    return ComputeDistance(leftPoint, rightPoint, m_projection) * (1.0 + curvatureFactor * height);
+}
+
+const meshkernel::Splines::ArcLengthTable& meshkernel::Splines::GetArcLengthTable(size_t index, bool accountForCurvature, double height)
+{
+    if (m_arcLengthTables.size() < GetNumSplines())
+    {
+        m_arcLengthTables.resize(GetNumSplines());
+    }
+
+    // The table is cleared when the spline nodes change, see InvalidateArcLengthTable
+    auto& table = m_arcLengthTables[index];
+    if (!table.lengths.empty() &&
+        table.accountForCurvature == accountForCurvature &&
+        (!accountForCurvature || table.height == height) &&
+        table.projection == m_projection)
+    {
+        return table;
+    }
+
+    table.projection = m_projection;
+    table.accountForCurvature = accountForCurvature;
+    table.height = height;
+
+    // The samples are accumulated as in GetSplineLength, so the lengths are the same
+    const auto lastCoordinate = static_cast<double>(m_splineNodes[index].size()) - 1.0;
+    const auto numSamples = static_cast<size_t>(lastCoordinate / arcLengthTableDelta) + 1;
+    table.coordinates.resize(numSamples);
+    table.points.resize(numSamples);
+    table.lengths.resize(numSamples);
+
+    table.coordinates[0] = 0.0;
+    table.lengths[0] = 0.0;
+    bool successful = InterpolateSplinePoint(m_splineNodes[index], m_splineDerivatives[index], 0.0, table.points[0]);
+    if (!successful)
+    {
+        throw AlgorithmError("Splines::GetArcLengthTable: Could not interpolate spline points.");
+    }
+
+    double coordinate = 0.0;
+    for (size_t s = 1; s < numSamples; ++s)
+    {
+        coordinate += arcLengthTableDelta;
+        table.coordinates[s] = std::min(coordinate, lastCoordinate);
+
+        successful = InterpolateSplinePoint(m_splineNodes[index], m_splineDerivatives[index], table.coordinates[s], table.points[s]);
+        if (!successful)
+        {
+            throw AlgorithmError("Splines::GetArcLengthTable: Could not interpolate spline points.");
+        }
+
+        table.lengths[s] = table.lengths[s - 1] + ComputeSegmentLength(index,
+                                                                       table.coordinates[s - 1],
+                                                                       table.coordinates[s],
+                                                                       table.points[s - 1],
+                                                                       table.points[s],
+                                                                       accountForCurvature,
+                                                                       height);
+    }
+
+    return table;
+}
+
+double meshkernel::Splines::GetSplineLengthFromStart(size_t index,
+                                                     double endIndex,
+                                                     bool accountForCurvature,
+                                                     double height)
+{
+    if (m_splineNodes[index].empty())
+    {
+        return 0.0;
+    }
+
+    const auto& table = GetArcLengthTable(index, accountForCurvature, height);
+
+    // The last sample before endIndex, only the remaining interval needs to be integrated
+    auto sample = std::min(static_cast<size_t>(std::max(endIndex, 0.0) / arcLengthTableDelta), table.lengths.size() - 1);
+    while (sample > 0 && table.coordinates[sample] > endIndex)
+    {
+        sample--;
+    }
+
+    Point endPoint{doubleMissingValue, doubleMissingValue};
+    const auto successful = InterpolateSplinePoint(m_splineNodes[index], m_splineDerivatives[index], endIndex, endPoint);
+    if (!successful)
+    {
+        throw AlgorithmError("Splines::GetSplineLengthFromStart: Could not interpolate spline points.");
+    }
+
+    return table.lengths[sample] + ComputeSegmentLength(index,
+                                                        table.coordinates[sample],
+                                                        endIndex,
+                                                        table.points[sample],
+                                                        endPoint,
+                                                        accountForCurvature,
+                                                        height);
+}
+
 void meshkernel::Splines::ComputeCurvatureOnSplinePoint(size_t splineIndex,
                                                         double adimensionalPointCoordinate,
                                                         double& curvatureFactor,
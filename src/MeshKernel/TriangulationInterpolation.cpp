@@ -24,6 +24,7 @@
 // Stichting Deltares. All rights reserved.
 //
 //------------------------------------------------------------------------------
+#include <numeric>
 #include <tuple>
 
 #include <MeshKernel/Entities.hpp>
@@ -31,13 +32,16 @@
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/RTree.hpp>
 #include <MeshKernel/TriangulationInterpolation.hpp>
+#include <MeshKernel/TriangulationTiles.hpp>
 #include <MeshKernel/TriangulationWrapper.hpp>
 
 meshkernel::TriangulationInterpolation::TriangulationInterpolation(const std::vector<Point>& m_locations,
                                                                    const std::vector<Sample>& samples,
-                                                                   Projection projection) : m_locations(m_locations),
-                                                                                            m_samples(samples),
-                                                                                            m_projection(projection){};
+                                                                   Projection projection,
+                                                                   size_t maximumSamplesPerTile) : m_locations(m_locations),
+                                                                                                   m_samples(samples),
+                                                                                                   m_projection(projection),
+                                                                                                   m_maximumSamplesPerTile(maximumSamplesPerTile){};
 
 void meshkernel::TriangulationInterpolation::Compute()
 {
@@ -50,17 +54,114 @@ void meshkernel::TriangulationInterpolation::Compute()
         throw AlgorithmError("TriangulationInterpolation::Compute: No samples available.");
     }
 
+    if (m_maximumSamplesPerTile > 0 && m_samples.size() > m_maximumSamplesPerTile)
+    {
+        ComputeInTiles();
+        return;
+    }
+
+    std::vector<size_t> locationIndices(m_locations.size());
+    std::iota(locationIndices.begin(), locationIndices.end(), 0);
+
+    // no triangles formed, return
+    if (Interpolate(m_samples, locationIndices, [](const std::vector<Point>&) { return true; }) < 1)
+    {
+        throw AlgorithmError("TriangulationInterpolation::Compute: Triangulation of samples produced no triangles.");
+    }
+}
+
+void meshkernel::TriangulationInterpolation::ComputeInTiles()
+{
+    std::vector<size_t> locationIndices(m_locations.size());
+    std::iota(locationIndices.begin(), locationIndices.end(), 0);
+
+    std::vector<bool> isTileSelected;
+    std::vector<Point> convexHull;
+    auto overlap = triangulationTileOverlap;
+    while (!locationIndices.empty())
+    {
+        const TriangulationTiles tiles(m_samples, m_maximumSamplesPerTile, overlap, isTileSelected);
+
+        // each location is interpolated in the tile whose core contains it
+        std::vector<std::vector<size_t>> tileLocations(tiles.GetNumTiles());
+        for (const auto n : locationIndices)
+        {
+            tileLocations[tiles.GetTile(m_locations[n])].emplace_back(n);
+        }
+
+        const auto numTiles = static_cast<int>(tiles.GetNumTiles());
+        int numTriangulatedTiles = 0;
+        int numTilesWithTriangles = 0;
+#pragma omp parallel for schedule(dynamic) reduction(+ : numTriangulatedTiles, numTilesWithTriangles)
+        for (int t = 0; t < numTiles; ++t)
+        {
+            if (tileLocations[t].empty())
+            {
+                continue;
+            }
+
+            const auto& tilePoints = tiles.GetTilePoints(t);
+            std::vector<Sample> tileSamples(tilePoints.size());
+            for (size_t i = 0; i < tilePoints.size(); ++i)
+            {
+                tileSamples[i] = m_samples[tilePoints[i]];
+            }
+
+            numTriangulatedTiles++;
+            const auto isTriangleAccepted = [&tiles, t](const std::vector<Point>& triangle) { return tiles.IsTriangleInTile(t, triangle[0], triangle[1], triangle[2]); };
+            if (Interpolate(tileSamples, tileLocations[t], isTriangleAccepted) > 0)
+            {
+                numTilesWithTriangles++;
+            }
+        }
+
+        if (overlap == triangulationTileOverlap && numTriangulatedTiles > 0 && numTilesWithTriangles == 0)
+        {
+            throw AlgorithmError("TriangulationInterpolation::Compute: Triangulation of samples produced no triangles.");
+        }
+
+        if (tiles.IsOverlapCoveringAllPoints())
+        {
+            break;
+        }
+
+        // the locations outside the convex hull of the samples are not interpolated by a single triangulation either
+        if (overlap == triangulationTileOverlap)
+        {
+            convexHull = ConvexHull(m_samples);
+        }
+        std::vector<size_t> remainingLocationIndices;
+        for (const auto n : locationIndices)
+        {
+            if (IsEqual(m_results[n], doubleMissingValue) && (convexHull.empty() || IsPointInPolygonNodes(m_locations[n], convexHull, Projection::cartesian)))
+            {
+                remainingLocationIndices.emplace_back(n);
+            }
+        }
+        locationIndices = std::move(remainingLocationIndices);
+
+        isTileSelected.assign(tiles.GetNumTiles(), false);
+        for (const auto n : locationIndices)
+        {
+            isTileSelected[tiles.GetTile(m_locations[n])] = true;
+        }
+        overlap *= 4.0;
+    }
+}
+
+size_t meshkernel::TriangulationInterpolation::Interpolate(const std::vector<Sample>& samples,
+                                                           const std::vector<size_t>& locationIndices,
+                                                           const std::function<bool(const std::vector<Point>&)>& isTriangleAccepted)
+{
     // triangulate samples
     TriangulationWrapper triangulationWrapper;
-    triangulationWrapper.Compute(m_samples,
+    triangulationWrapper.Compute(samples,
                                  TriangulationWrapper::TriangulationOptions::TriangulatePointsAndGenerateFaces,
-                                 0.0,
-                                 0);
+                                 0.0);
 
-    // no triangles formed, return
     if (triangulationWrapper.m_numFaces < 1)
     {
-        throw AlgorithmError("TriangulationInterpolation::Compute: Triangulation of samples produced no triangles.");
+        return 0;
     }
 
     // for each triangle compute the bounding circumcenter, bounding closed polygon, and the values at the nodes of each triangle
@@ -73,9 +174,9 @@ void meshkernel::TriangulationInterpolation::Compute()
         // compute triangle polygons
         for (auto n = 0; n < numNodesInTriangle; ++n)
         {
-            auto const node = triangulationWrapper.m_faceNodes[f][n];
-            triangles[f][n] = {m_samples[node].x, m_samples[node].y};
-            values[f][n] = m_samples[node].value;
+            auto const node = triangulationWrapper.GetFaceNode(f, n);
+            triangles[f][n] = {samples[node].x, samples[node].y};
+            values[f][n] = samples[node].value;
         }
         triangles[f][3] = triangles[f][0];
         values[f][3] = values[f][0];
@@ -87,10 +188,10 @@ void meshkernel::TriangulationInterpolation::Compute()
     samplesRtree.BuildTree(trianglesCircumcenters);
 
     // compute the sample bounding box
-    const auto [lowerLeft, upperRight] = GetBoundingBox(m_samples);
+    const auto [lowerLeft, upperRight] = GetBoundingBox(samples);
 
     // loop over locations
-    for (auto n = 0; n < m_locations.size(); ++n)
+    for (const auto n : locationIndices)
     {
         if (!IsValueInBoundingBox(m_locations[n], lowerLeft, upperRight) ||
             !IsEqual(m_results[n], doubleMissingValue))
@@ -124,24 +225,24 @@ void meshkernel::TriangulationInterpolation::Compute()
             numFacesSearched++;
             for (auto i = 0; i < numNodesInTriangle; ++i)
             {
-                const auto edge = triangulationWrapper.m_faceEdges[triangle][i];
-                if (triangulationWrapper.m_edgesFaces[edge][1] == 0)
+                const auto edge = triangulationWrapper.GetFaceEdge(triangle, i);
+                if (triangulationWrapper.GetEdgeFace(edge, 1) == 0)
                 {
                     continue;
                 }
 
                 // there is no valid other triangle
-                const auto otherTriangle = triangle == triangulationWrapper.m_edgesFaces[edge][0] ? triangulationWrapper.m_edgesFaces[edge][1] : triangulationWrapper.m_edgesFaces[edge][0];
-                const auto k1 = triangulationWrapper.m_edgeNodes[edge][0];
-                const auto k2 = triangulationWrapper.m_edgeNodes[edge][1];
+                const auto otherTriangle = triangle == triangulationWrapper.GetEdgeFace(edge, 0) ? triangulationWrapper.GetEdgeFace(edge, 1) : triangulationWrapper.GetEdgeFace(edge, 0);
+                const auto k1 = triangulationWrapper.GetEdgeNode(edge, 0);
+                const auto k2 = triangulationWrapper.GetEdgeNode(edge, 1);
                 Point intersection;
                 double crossProduct;
                 double firstRatio;
                 double secondRatio;
                 const auto areCrossing = AreSegmentsCrossing(trianglesCircumcenters[triangle],
                                                              m_locations[n],
-                                                             {m_samples[k1].x, m_samples[k1].y},
-                                                             {m_samples[k2].x, m_samples[k2].y},
+                                                             {samples[k1].x, samples[k1].y},
+                                                             {samples[k2].x, samples[k2].y},
                                                              false,
                                                              m_projection,
                                                              intersection,
@@ -157,10 +258,12 @@ void meshkernel::TriangulationInterpolation::Compute()
             }
         }
 
-        if (isInTriangle && triangle != sizetMissingValue && triangle < triangulationWrapper.m_numFaces)
+        if (isInTriangle && triangle != sizetMissingValue && triangle < triangulationWrapper.m_numFaces && isTriangleAccepted(triangles[triangle]))
         {
             // Perform linear interpolation
             m_results[n] = LinearInterpolationInTriangle(m_locations[n], triangles[triangle], values[triangle], m_projection);
         }
     }
+
+    return triangulationWrapper.m_numFaces;
 }
@@ -0,0 +1,204 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+
+#include <MeshKernel/TriangulationTiles.hpp>
+
+namespace
+{
+    /// @brief Computes the index of the tile containing a coordinate along one direction
+    /// @param[in] coordinate The coordinate
+    /// @param[in] origin The start of the tile grid
+    /// @param[in] tileSize The size of a tile
+    /// @param[in] numTiles The number of tiles
+    /// @returns The tile index, clamped to the tile grid
+    size_t TileIndex(double coordinate, double origin, double tileSize, size_t numTiles)
+    {
+        if (tileSize <= 0.0)
+        {
+            return 0;
+        }
+        const auto index = std::floor((coordinate - origin) / tileSize);
+        if (index <= 0.0)
+        {
+            return 0;
+        }
+        return std::min(static_cast<size_t>(index), numTiles - 1);
+    }
+} // namespace
+
+void meshkernel::TriangulationTiles::SetTiles(const Point& lowerLeft,
+                                              const Point& upperRight,
+                                              size_t numPoints,
+                                              size_t maximumPointsPerTile,
+                                              double overlap,
+                                              const std::vector<bool>& isTileSelected)
+{
+    m_lowerLeft = lowerLeft;
+    m_upperRight = upperRight;
+    const auto width = std::max(upperRight.x - lowerLeft.x, 0.0);
+    const auto height = std::max(upperRight.y - lowerLeft.y, 0.0);
+
+    size_t numTiles = 1;
+    if (maximumPointsPerTile > 0 && numPoints > maximumPointsPerTile)
+    {
+        numTiles = (numPoints + maximumPointsPerTile - 1) / maximumPointsPerTile;
+    }
+
+    // distribute the tiles according to the aspect ratio of the bounding box
+    if (width > 0.0 && height > 0.0)
+    {
+        const auto numTilesX = std::round(std::sqrt(static_cast<double>(numTiles) * width / height));
+        m_numTilesX = std::clamp(static_cast<size_t>(numTilesX), static_cast<size_t>(1), numTiles);
+        m_numTilesY = (numTiles + m_numTilesX - 1) / m_numTilesX;
+    }
+    else if (width > 0.0)
+    {
+        m_numTilesX = numTiles;
+        m_numTilesY = 1;
+    }
+    else if (height > 0.0)
+    {
+        m_numTilesX = 1;
+        m_numTilesY = numTiles;
+    }
+    else
+    {
+        m_numTilesX = 1;
+        m_numTilesY = 1;
+    }
+
+    m_tileWidth = width / static_cast<double>(m_numTilesX);
+    m_tileHeight = height / static_cast<double>(m_numTilesY);
+    m_marginX = overlap * m_tileWidth;
+    m_marginY = overlap * m_tileHeight;
+
+    m_tilePoints.assign(m_numTilesX * m_numTilesY, std::vector<size_t>());
+    m_isTileSelected = isTileSelected;
+    m_isTileSelected.resize(m_tilePoints.size(), isTileSelected.empty());
+
+    const auto numTilePoints = std::min(static_cast<size_t>(static_cast<double>(numPoints) * (1.0 + 2.0 * overlap) * (1.0 + 2.0 * overlap)) / m_tilePoints.size(), numPoints);
+    m_selectedTiles.clear();
+    for (size_t t = 0; t < m_tilePoints.size(); ++t)
+    {
+        if (m_isTileSelected[t])
+        {
+            m_selectedTiles.emplace_back(t);
+            m_tilePoints[t].reserve(numTilePoints);
+        }
+    }
+}
+
+void meshkernel::TriangulationTiles::AssignPoint(size_t index, double x, double y)
+{
+    const auto firstTileX = TileIndex(x - m_marginX, m_lowerLeft.x, m_tileWidth, m_numTilesX);
+    const auto lastTileX = TileIndex(x + m_marginX, m_lowerLeft.x, m_tileWidth, m_numTilesX);
+    const auto firstTileY = TileIndex(y - m_marginY, m_lowerLeft.y, m_tileHeight, m_numTilesY);
+    const auto lastTileY = TileIndex(y + m_marginY, m_lowerLeft.y, m_tileHeight, m_numTilesY);
+
+    // with a large overlap a point is in many tiles, then only the selected ones are checked
+    if ((lastTileX - firstTileX + 1) * (lastTileY - firstTileY + 1) > m_selectedTiles.size())
+    {
+        for (const auto tile : m_selectedTiles)
+        {
+            const auto tileX = tile % m_numTilesX;
+            const auto tileY = tile / m_numTilesX;
+            if (tileX >= firstTileX && tileX <= lastTileX && tileY >= firstTileY && tileY <= lastTileY)
+            {
+                m_tilePoints[tile].emplace_back(index);
+            }
+        }
+        return;
+    }
+
+    for (auto tileY = firstTileY; tileY <= lastTileY; ++tileY)
+    {
+        for (auto tileX = firstTileX; tileX <= lastTileX; ++tileX)
+        {
+            const auto tile = tileY * m_numTilesX + tileX;
+            if (m_isTileSelected[tile])
+            {
+                m_tilePoints[tile].emplace_back(index);
+            }
+        }
+    }
+}
+
+size_t meshkernel::TriangulationTiles::GetTile(const Point& location) const
+{
+    const auto tileX = TileIndex(location.x, m_lowerLeft.x, m_tileWidth, m_numTilesX);
+    const auto tileY = TileIndex(location.y, m_lowerLeft.y, m_tileHeight, m_numTilesY);
+    return tileY * m_numTilesX + tileX;
+}
+
+bool meshkernel::TriangulationTiles::IsTriangleInTile(size_t tile, const Point& firstNode, const Point& secondNode, const Point& thirdNode) const
+{
+    // the triangulation is planar, also for spherical coordinates
+    const auto crossProduct = (secondNode.x - firstNode.x) * (thirdNode.y - firstNode.y) - (secondNode.y - firstNode.y) * (thirdNode.x - firstNode.x);
+    if (std::abs(crossProduct) <= 0.0)
+    {
+        return false;
+    }
+    const auto center = CircumcenterOfTriangle(firstNode, secondNode, thirdNode, Projection::cartesian);
+    const auto radius = std::hypot(center.x - firstNode.x, center.y - firstNode.y);
+
+    // only the part of the circumcircle covering points matters
+    const auto lowerX = std::max(center.x - radius, m_lowerLeft.x);
+    const auto upperX = std::min(center.x + radius, m_upperRight.x);
+    const auto lowerY = std::max(center.y - radius, m_lowerLeft.y);
+    const auto upperY = std::min(center.y + radius, m_upperRight.y);
+
+    // the outer tiles extend to infinity, the tolerance accounts for the rounding of the point assignment
+    const auto tileX = tile % m_numTilesX;
+    const auto tileY = tile / m_numTilesX;
+    const auto tolerance = 1e-9 * (m_tileWidth + m_tileHeight + m_marginX + m_marginY);
+    if (tileX > 0 && lowerX <= m_lowerLeft.x + static_cast<double>(tileX) * m_tileWidth - m_marginX + tolerance)
+    {
+        return false;
+    }
+    if (tileX + 1 < m_numTilesX && upperX >= m_lowerLeft.x + static_cast<double>(tileX + 1) * m_tileWidth + m_marginX - tolerance)
+    {
+        return false;
+    }
+    if (tileY > 0 && lowerY <= m_lowerLeft.y + static_cast<double>(tileY) * m_tileHeight - m_marginY + tolerance)
+    {
+        return false;
+    }
+    if (tileY + 1 < m_numTilesY && upperY >= m_lowerLeft.y + static_cast<double>(tileY + 1) * m_tileHeight + m_marginY - tolerance)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool meshkernel::TriangulationTiles::IsOverlapCoveringAllPoints() const
+{
+    return (m_numTilesX == 1 || m_marginX > m_upperRight.x - m_lowerLeft.x) &&
+           (m_numTilesY == 1 || m_marginY > m_upperRight.y - m_lowerLeft.y);
+}
@@ -0,0 +1,184 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <vector>
+
+#include <MeshKernel/Constants.hpp>
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Instrumentation.hpp>
+#include <MeshKernel/TriangulationWrapper.hpp>
+
+namespace
+{
+    /// @brief Owns the buffers allocated by Triangle and releases them on destruction
+    struct TriangulationBuffers
+    {
+        ~TriangulationBuffers()
+        {
+            meshkernel::FreeTriangulation(m_triangles, m_edges, m_neighbors, m_points);
+        }
+
+        int* m_triangles = nullptr; ///< The triangle nodes
+        int* m_edges = nullptr;     ///< The edge nodes
+        int* m_neighbors = nullptr; ///< The triangle neighbors
+        double* m_points = nullptr; ///< The interleaved point coordinates
+    };
+} // namespace
+
+void meshkernel::TriangulationWrapper::ComputeFromCoordinates(std::vector<double>& coordinates,
+                                                              size_t numInputNodes,
+                                                              TriangulationOptions triangulationOption,
+                                                              double averageTriangleArea)
+{
+    MESHKERNEL_TIME_SCOPE("TriangulationWrapper::Compute");
+
+    m_nodes.clear();
+    m_faceNodes.clear();
+    m_faceEdges.clear();
+    m_edgeNodes.clear();
+    m_edgesFaces.clear();
+    m_numFaces = 0;
+    m_numEdges = 0;
+    m_numNodes = 0;
+
+    // Triangle terminates the process with fewer than three vertices
+    if (numInputNodes < numNodesInTriangle)
+    {
+        return;
+    }
+
+    TriangulationBuffers buffers;
+    int numFaces = 0;
+    int numEdges = 0;
+    int numNodes = 0;
+    TriangulateOnce(static_cast<int>(triangulationOption),
+                    coordinates.data(),
+                    static_cast<int>(numInputNodes),
+                    averageTriangleArea,
+                    &numFaces,
+                    &buffers.m_triangles,
+                    &numEdges,
+                    &buffers.m_edges,
+                    &buffers.m_neighbors,
+                    &numNodes,
+                    &buffers.m_points);
+
+    m_numFaces = numFaces <= 0 ? static_cast<size_t>(0) : static_cast<size_t>(numFaces);
+    m_numEdges = numEdges <= 0 ? static_cast<size_t>(0) : static_cast<size_t>(numEdges);
+    m_numNodes = numNodes <= 0 ? static_cast<size_t>(0) : static_cast<size_t>(numNodes);
+
+    // Create nodes
+    m_nodes.resize(m_numNodes);
+    for (size_t i = 0; i < m_numNodes; ++i)
+    {
+        m_nodes[i] = {buffers.m_points[2 * i], buffers.m_points[2 * i + 1]};
+    }
+
+    // Create face nodes
+    m_faceNodes.assign(buffers.m_triangles, buffers.m_triangles + 3 * m_numFaces);
+
+    // Create edges
+    if (m_numEdges == 0)
+    {
+        return;
+    }
+
+    m_edgeNodes.assign(buffers.m_edges, buffers.m_edges + 2 * m_numEdges);
+
+    // For each node, the edges connected to it (compressed storage)
+    std::vector<size_t> nodeEdgesOffsets(numInputNodes + 1, 0);
+    for (const auto& node : m_edgeNodes)
+    {
+        nodeEdgesOffsets[node + 1]++;
+    }
+    for (size_t n = 0; n < numInputNodes; ++n)
+    {
+        nodeEdgesOffsets[n + 1] += nodeEdgesOffsets[n];
+    }
+    std::vector<size_t> nodeEdges(nodeEdgesOffsets.back());
+    std::vector<size_t> nodeEdgesPosition(nodeEdgesOffsets.begin(), nodeEdgesOffsets.end() - 1);
+    for (size_t e = 0; e < m_numEdges; ++e)
+    {
+        nodeEdges[nodeEdgesPosition[m_edgeNodes[2 * e]]++] = e;
+        nodeEdges[nodeEdgesPosition[m_edgeNodes[2 * e + 1]]++] = e;
+    }
+
+    // Assign the edges to the face sides. Side k is opposite to node k and is shared with the neighbor k,
+    // so each edge is searched once and copied to the neighboring face
+    m_faceEdges.assign(3 * m_numFaces, sizetMissingValue);
+    m_edgesFaces.assign(2 * m_numEdges, sizetMissingValue);
+    for (size_t f = 0; f < m_numFaces; ++f)
+    {
+        for (size_t k = 0; k < numNodesInTriangle; ++k)
+        {
+            if (m_faceEdges[3 * f + k] != sizetMissingValue)
+            {
+                continue;
+            }
+
+            const auto firstNode = m_faceNodes[3 * f + (k + 1) % numNodesInTriangle];
+            const auto secondNode = m_faceNodes[3 * f + (k + 2) % numNodesInTriangle];
+            auto edge = sizetMissingValue;
+            for (auto i = nodeEdgesOffsets[firstNode]; i < nodeEdgesOffsets[firstNode + 1]; ++i)
+            {
+                const auto candidate = nodeEdges[i];
+                if (m_edgeNodes[2 * candidate] == secondNode || m_edgeNodes[2 * candidate + 1] == secondNode)
+                {
+                    edge = candidate;
+                    break;
+                }
+            }
+            if (edge == sizetMissingValue)
+            {
+                continue;
+            }
+
+            m_faceEdges[3 * f + k] = edge;
+            m_edgesFaces[2 * edge] = f;
+
+            const auto neighbor = buffers.m_neighbors[3 * f + k];
+            if (neighbor < 0)
+            {
+                continue;
+            }
+            const auto neighborFace = static_cast<size_t>(neighbor);
+            m_edgesFaces[2 * edge + 1] = neighborFace;
+            for (size_t j = 0; j < numNodesInTriangle; ++j)
+            {
+                if (buffers.m_neighbors[3 * neighborFace + j] == static_cast<int>(f))
+                {
+                    m_faceEdges[3 * neighborFace + j] = edge;
+                    break;
+                }
+            }
+        }
+
+        // keep the face edges in ascending order
+        std::sort(m_faceEdges.begin() + 3 * f, m_faceEdges.begin() + 3 * (f + 1));
+    }
+}
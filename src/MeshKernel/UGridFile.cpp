@@ -0,0 +1,538 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <netcdf.h>
+
+#include <MeshKernel/Constants.hpp>
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Mesh1D.hpp>
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/UGridFile.hpp>
+
+namespace
+{
+    /// The maximum number of rows read or written with a single hyperslab access
+    constexpr size_t maxChunkRows = 1 << 20;
+
+    /// @brief The functions of the NetCDF C library, resolved from the shared library at run time
+    struct NetCDFLibrary
+    {
+        decltype(&nc_open) open = nullptr;
+        decltype(&nc_create) create = nullptr;
+        decltype(&nc_close) close = nullptr;
+        decltype(&nc_redef) redef = nullptr;
+        decltype(&nc_enddef) enddef = nullptr;
+        decltype(&nc_strerror) strerror = nullptr;
+        decltype(&nc_inq_nvars) inq_nvars = nullptr;
+        decltype(&nc_inq_varid) inq_varid = nullptr;
+        decltype(&nc_inq_vardimid) inq_vardimid = nullptr;
+        decltype(&nc_inq_dimid) inq_dimid = nullptr;
+        decltype(&nc_inq_dimlen) inq_dimlen = nullptr;
+        decltype(&nc_inq_attlen) inq_attlen = nullptr;
+        decltype(&nc_get_att_text) get_att_text = nullptr;
+        decltype(&nc_get_att_int) get_att_int = nullptr;
+        decltype(&nc_get_att_longlong) get_att_longlong = nullptr;
+        decltype(&nc_put_att_text) put_att_text = nullptr;
+        decltype(&nc_put_att_int) put_att_int = nullptr;
+        decltype(&nc_def_dim) def_dim = nullptr;
+        decltype(&nc_def_var) def_var = nullptr;
+        decltype(&nc_get_vara_double) get_vara_double = nullptr;
+        decltype(&nc_put_vara_double) put_vara_double = nullptr;
+        decltype(&nc_get_vara_longlong) get_vara_longlong = nullptr;
+        decltype(&nc_put_vara_int) put_vara_int = nullptr;
+
+        /// @brief Loads the library on first use
+        /// @returns The loaded library
+        static const NetCDFLibrary& Instance()
+        {
+            static const NetCDFLibrary library;
+            return library;
+        }
+
+    private:
+        NetCDFLibrary()
+        {
+#if defined(_WIN32)
+            m_handle = LoadLibraryA("netcdf.dll");
+#else
+            for (const auto& name : {"libnetcdf.so", "libnetcdf.so.22", "libnetcdf.so.19", "libnetcdf.so.18", "libnetcdf.so.15", "libnetcdf.so.13", "libnetcdf.so.11", "libnetcdf.dylib"})
+            {
+                m_handle = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+                if (m_handle != nullptr)
+                {
+                    break;
+                }
+            }
+#endif
+            if (m_handle == nullptr)
+            {
+                throw std::runtime_error("UGridFile: Could not load the NetCDF library.");
+            }
+
+            Resolve(open, "nc_open");
+            Resolve(create, "nc_create");
+            Resolve(close, "nc_close");
+            Resolve(redef, "nc_redef");
+            Resolve(enddef, "nc_enddef");
+            Resolve(strerror, "nc_strerror");
+            Resolve(inq_nvars, "nc_inq_nvars");
+            Resolve(inq_varid, "nc_inq_varid");
+            Resolve(inq_vardimid, "nc_inq_vardimid");
+            Resolve(inq_dimid, "nc_inq_dimid");
+            Resolve(inq_dimlen, "nc_inq_dimlen");
+            Resolve(inq_attlen, "nc_inq_attlen");
+            Resolve(get_att_text, "nc_get_att_text");
+            Resolve(get_att_int, "nc_get_att_int");
+            Resolve(get_att_longlong, "nc_get_att_longlong");
+            Resolve(put_att_text, "nc_put_att_text");
+            Resolve(put_att_int, "nc_put_att_int");
+            Resolve(def_dim, "nc_def_dim");
+            Resolve(def_var, "nc_def_var");
+            Resolve(get_vara_double, "nc_get_vara_double");
+            Resolve(put_vara_double, "nc_put_vara_double");
+            Resolve(get_vara_longlong, "nc_get_vara_longlong");
+            Resolve(put_vara_int, "nc_put_vara_int");
+        }
+
+        /// @brief Resolves a function of the library
+        template <typename T>
+        void Resolve(T& function, const char* name)
+        {
+#if defined(_WIN32)
+            function = reinterpret_cast<T>(GetProcAddress(static_cast<HMODULE>(m_handle), name));
+#else
+            function = reinterpret_cast<T>(dlsym(m_handle, name));
+#endif
+            if (function == nullptr)
+            {
+                throw std::runtime_error("UGridFile: Could not find " + std::string(name) + " in the NetCDF library.");
+            }
+        }
+
+        void* m_handle = nullptr; ///< The handle of the shared library, kept open for the lifetime of the program
+    };
+
+    /// @brief Throws if a NetCDF call did not succeed
+    void CheckStatus(int status, const std::string& message)
+    {
+        if (status != NC_NOERR)
+        {
+            throw std::invalid_argument("UGridFile: " + message + " (" + NetCDFLibrary::Instance().strerror(status) + ").");
+        }
+    }
+
+    /// @brief Defines a dimension, or returns the existing dimension with the same name and length
+    int DefineDimension(int ncId, const std::string& name, size_t length)
+    {
+        const auto& netcdf = NetCDFLibrary::Instance();
+        int dimId;
+        if (netcdf.inq_dimid(ncId, name.c_str(), &dimId) == NC_NOERR)
+        {
+            size_t existingLength = 0;
+            CheckStatus(netcdf.inq_dimlen(ncId, dimId, &existingLength), "Could not inquire the length of the dimension " + name);
+            if (existingLength != length)
+            {
+                throw std::invalid_argument("UGridFile: The dimension " + name + " already exists with length " + std::to_string(existingLength) + " instead of " + std::to_string(length) + ".");
+            }
+            return dimId;
+        }
+        CheckStatus(netcdf.def_dim(ncId, name.c_str(), length, &dimId), "Could not define the dimension " + name);
+        return dimId;
+    }
+
+    /// @brief Defines a variable and its standard attributes
+    int DefineVariable(int ncId, const std::string& name, nc_type type, const std::vector<int>& dimIds, const std::string& cfRole, const std::string& longName)
+    {
+        const auto& netcdf = NetCDFLibrary::Instance();
+        int varId;
+        CheckStatus(netcdf.def_var(ncId, name.c_str(), type, static_cast<int>(dimIds.size()), dimIds.data(), &varId), "Could not define the variable " + name);
+        if (!cfRole.empty())
+        {
+            CheckStatus(netcdf.put_att_text(ncId, varId, "cf_role", cfRole.size(), cfRole.c_str()), "Could not write the cf_role of " + name);
+        }
+        CheckStatus(netcdf.put_att_text(ncId, varId, "long_name", longName.size(), longName.c_str()), "Could not write the long_name of " + name);
+        return varId;
+    }
+
+    /// @brief Throws if a count or index does not fit in a NetCDF integer
+    void CheckIntRange(size_t value, const std::string& name)
+    {
+        if (value > static_cast<size_t>(std::numeric_limits<int>::max()))
+        {
+            throw std::invalid_argument("UGridFile::WriteTopology: The " + name + " " + std::to_string(value) + " does not fit in a NetCDF integer.");
+        }
+    }
+
+    /// @brief Writes a text attribute
+    void PutTextAttribute(int ncId, int varId, const std::string& name, const std::string& value)
+    {
+        CheckStatus(NetCDFLibrary::Instance().put_att_text(ncId, varId, name.c_str(), value.size(), value.c_str()), "Could not write the attribute " + name);
+    }
+
+    /// @brief Writes an integer attribute
+    void PutIntAttribute(int ncId, int varId, const std::string& name, int value)
+    {
+        CheckStatus(NetCDFLibrary::Instance().put_att_int(ncId, varId, name.c_str(), NC_INT, 1, &value), "Could not write the attribute " + name);
+    }
+} // namespace
+
+meshkernel::UGridFile::UGridFile(const std::string& filePath, AccessMode accessMode) : m_isWritable(accessMode == AccessMode::Write)
+{
+    const auto& netcdf = NetCDFLibrary::Instance();
+    if (m_isWritable)
+    {
+        CheckStatus(netcdf.create(filePath.c_str(), NC_CLOBBER | NC_NETCDF4, &m_ncId), "Could not create " + filePath);
+        PutTextAttribute(m_ncId, NC_GLOBAL, "Conventions", "CF-1.8 UGRID-1.0");
+        CheckStatus(netcdf.enddef(m_ncId), "Could not leave define mode");
+        return;
+    }
+
+    CheckStatus(netcdf.open(filePath.c_str(), NC_NOWRITE, &m_ncId), "Could not open " + filePath);
+}
+
+meshkernel::UGridFile::~UGridFile()
+{
+    if (m_ncId >= 0)
+    {
+        NetCDFLibrary::Instance().close(m_ncId);
+    }
+}
+
+int meshkernel::UGridFile::FindTopologyVariable(int topologyDimension) const
+{
+    const auto& netcdf = NetCDFLibrary::Instance();
+
+    int numVariables = 0;
+    CheckStatus(netcdf.inq_nvars(m_ncId, &numVariables), "Could not inquire the number of variables");
+
+    for (auto varId = 0; varId < numVariables; ++varId)
+    {
+        size_t length = 0;
+        if (netcdf.inq_attlen(m_ncId, varId, "cf_role", &length) != NC_NOERR)
+        {
+            continue;
+        }
+        if (GetTextAttribute(varId, "cf_role") != "mesh_topology")
+        {
+            continue;
+        }
+
+        int dimension = 0;
+        if (netcdf.get_att_int(m_ncId, varId, "topology_dimension", &dimension) == NC_NOERR && dimension == topologyDimension)
+        {
+            return varId;
+        }
+    }
+
+    return -1;
+}
+
+size_t meshkernel::UGridFile::GetFirstDimensionLength(int varId) const
+{
+    const auto& netcdf = NetCDFLibrary::Instance();
+
+    std::array<int, NC_MAX_VAR_DIMS> dimIds{};
+    CheckStatus(netcdf.inq_vardimid(m_ncId, varId, dimIds.data()), "Could not inquire the dimensions of a variable");
+
+    size_t length = 0;
+    CheckStatus(netcdf.inq_dimlen(m_ncId, dimIds[0], &length), "Could not inquire the length of a dimension");
+    return length;
+}
+
+std::string meshkernel::UGridFile::GetTextAttribute(int varId, const std::string& attributeName) const
+{
+    const auto& netcdf = NetCDFLibrary::Instance();
+
+    size_t length = 0;
+    CheckStatus(netcdf.inq_attlen(m_ncId, varId, attributeName.c_str(), &length), "Could not find the attribute " + attributeName);
+
+    std::string value(length, '\0');
+    CheckStatus(netcdf.get_att_text(m_ncId, varId, attributeName.c_str(), value.data()), "Could not read the attribute " + attributeName);
+
+    // Text attributes can be null terminated
+    value.erase(std::find(value.begin(), value.end(), '\0'), value.end());
+    return value;
+}
+
+void meshkernel::UGridFile::ReadNodes(int xVarId, int yVarId, NodeCoordinates& nodes) const
+{
+    const auto& netcdf = NetCDFLibrary::Instance();
+
+    const auto numNodes = GetFirstDimensionLength(xVarId);
+    nodes.resize(numNodes);
+
+    // x and y are stored in separate variables, like the coordinate arrays: read them per chunk in place
+    for (size_t start = 0; start < numNodes; start += maxChunkRows)
+    {
+        const size_t count = std::min(maxChunkRows, numNodes - start);
+        CheckStatus(netcdf.get_vara_double(m_ncId, xVarId, &start, &count, nodes.GetXData() + start), "Could not read the node x coordinates");
+        CheckStatus(netcdf.get_vara_double(m_ncId, yVarId, &start, &count, nodes.GetYData() + start), "Could not read the node y coordinates");
+    }
+}
+
+void meshkernel::UGridFile::ReadEdges(int varId, size_t startIndex, std::vector<Edge>& edges) const
+{
+    const auto& netcdf = NetCDFLibrary::Instance();
+
+    const auto numEdges = GetFirstDimensionLength(varId);
+    edges.resize(numEdges);
+
+    // the fill value and the indices before the start index are missing nodes (the default fill values are negative)
+    long long fillValue = -1;
+    netcdf.get_att_longlong(m_ncId, varId, "_FillValue", &fillValue);
+    const auto toNode = [fillValue, startIndex](long long node) {
+        return node == fillValue || node < static_cast<long long>(startIndex) ? sizetMissingValue : static_cast<size_t>(node) - startIndex;
+    };
+
+    // the edge nodes are read in chunks and converted to zero-based pairs
+    std::vector<long long> edgesChunk(2 * std::min(maxChunkRows, numEdges));
+    for (size_t start = 0; start < numEdges; start += maxChunkRows)
+    {
+        const std::array<size_t, 2> starts{start, 0};
+        const std::array<size_t, 2> counts{std::min(maxChunkRows, numEdges - start), 2};
+        CheckStatus(netcdf.get_vara_longlong(m_ncId, varId, starts.data(), counts.data(), edgesChunk.data()), "Could not read the edge nodes");
+        for (size_t i = 0; i < counts[0]; ++i)
+        {
+            edges[start + i] = {toNode(edgesChunk[2 * i]), toNode(edgesChunk[2 * i + 1])};
+        }
+    }
+}
+
+void meshkernel::UGridFile::ReadNodesAndEdges(int topologyDimension, NodeCoordinates& nodes, std::vector<Edge>& edges) const
+{
+    const auto& netcdf = NetCDFLibrary::Instance();
+
+    const auto topologyVarId = FindTopologyVariable(topologyDimension);
+    if (topologyVarId < 0)
+    {
+        if (topologyDimension != 2)
+        {
+            throw std::invalid_argument("UGridFile::ReadNodesAndEdges: The file does not contain a mesh topology of the requested dimension.");
+        }
+
+        // legacy net file, with 1-based edge nodes
+        int xVarId;
+        int yVarId;
+        int edgesVarId;
+        CheckStatus(netcdf.inq_varid(m_ncId, "NetNode_x", &xVarId), "Could not find a mesh2d topology or the variable NetNode_x");
+        CheckStatus(netcdf.inq_varid(m_ncId, "NetNode_y", &yVarId), "Could not find the variable NetNode_y");
+        CheckStatus(netcdf.inq_varid(m_ncId, "NetLink", &edgesVarId), "Could not find the variable NetLink");
+
+        ReadNodes(xVarId, yVarId, nodes);
+        ReadEdges(edgesVarId, 1, edges);
+        return;
+    }
+
+    std::istringstream nodeCoordinates(GetTextAttribute(topologyVarId, "node_coordinates"));
+    std::string xName;
+    std::string yName;
+    nodeCoordinates >> xName >> yName;
+
+    int xVarId;
+    int yVarId;
+    CheckStatus(netcdf.inq_varid(m_ncId, xName.c_str(), &xVarId), "Could not find the variable " + xName);
+    CheckStatus(netcdf.inq_varid(m_ncId, yName.c_str(), &yVarId), "Could not find the variable " + yName);
+    ReadNodes(xVarId, yVarId, nodes);
+
+    const auto edgesName = GetTextAttribute(topologyVarId, "edge_node_connectivity");
+    int edgesVarId;
+    CheckStatus(netcdf.inq_varid(m_ncId, edgesName.c_str(), &edgesVarId), "Could not find the variable " + edgesName);
+
+    int startIndex = 0;
+    netcdf.get_att_int(m_ncId, edgesVarId, "start_index", &startIndex);
+    ReadEdges(edgesVarId, static_cast<size_t>(startIndex), edges);
+}
+
+std::shared_ptr<meshkernel::Mesh2D> meshkernel::UGridFile::ReadMesh2D(Projection projection) const
+{
+    NodeCoordinates nodes;
+    std::vector<Edge> edges;
+    ReadNodesAndEdges(2, nodes, edges);
+    return std::make_shared<Mesh2D>(std::move(edges), std::move(nodes), projection);
+}
+
+std::shared_ptr<meshkernel::Mesh1D> meshkernel::UGridFile::ReadMesh1D(Projection projection) const
+{
+    NodeCoordinates nodes;
+    std::vector<Edge> edges;
+    ReadNodesAndEdges(1, nodes, edges);
+    return std::make_shared<Mesh1D>(std::move(edges), std::move(nodes), projection);
+}
+
+void meshkernel::UGridFile::WriteTopology(const std::string& meshName,
+                                          int topologyDimension,
+                                          const NodeCoordinates& nodes,
+                                          const std::vector<Edge>& edges,
+                                          const std::vector<std::vector<size_t>>& faceNodes)
+{
+    if (!m_isWritable)
+    {
+        throw std::invalid_argument("UGridFile::WriteTopology: The file has not been opened for writing.");
+    }
+    if (nodes.empty())
+    {
+        throw std::invalid_argument("UGridFile::WriteTopology: The mesh has no nodes.");
+    }
+
+    // the connectivity is written as NC_INT, so check the range before anything is defined
+    CheckIntRange(nodes.size(), "number of nodes");
+    CheckIntRange(edges.size(), "number of edges");
+    CheckIntRange(faceNodes.size(), "number of faces");
+    for (const auto& [first, second] : edges)
+    {
+        CheckIntRange(std::max(first, second), "edge node index");
+    }
+    for (const auto& face : faceNodes)
+    {
+        for (const auto node : face)
+        {
+            CheckIntRange(node, "face node index");
+        }
+    }
+
+    const auto& netcdf = NetCDFLibrary::Instance();
+    CheckStatus(netcdf.redef(m_ncId), "Could not enter define mode");
+
+    // a dimension of length 0 would be unlimited, so empty entities are not written
+    const auto writeEdges = !edges.empty();
+    const auto writeFaces = topologyDimension == 2 && !faceNodes.empty();
+
+    size_t maxNumFaceNodes = 0;
+    for (const auto& face : faceNodes)
+    {
+        maxNumFaceNodes = std::max(maxNumFaceNodes, face.size());
+    }
+
+    const auto nodeDimId = DefineDimension(m_ncId, meshName + "_nNodes", nodes.size());
+    const auto twoDimId = DefineDimension(m_ncId, "Two", 2);
+
+    const auto topologyVarId = DefineVariable(m_ncId, meshName, NC_INT, {}, "mesh_topology", "Topology data of " + std::to_string(topologyDimension) + "D mesh");
+    PutIntAttribute(m_ncId, topologyVarId, "topology_dimension", topologyDimension);
+    PutTextAttribute(m_ncId, topologyVarId, "node_coordinates", meshName + "_node_x " + meshName + "_node_y");
+    PutTextAttribute(m_ncId, topologyVarId, "node_dimension", meshName + "_nNodes");
+
+    const auto xVarId = DefineVariable(m_ncId, meshName + "_node_x", NC_DOUBLE, {nodeDimId}, "", "x-coordinate of mesh nodes");
+    const auto yVarId = DefineVariable(m_ncId, meshName + "_node_y", NC_DOUBLE, {nodeDimId}, "", "y-coordinate of mesh nodes");
+    PutTextAttribute(m_ncId, xVarId, "mesh", meshName);
+    PutTextAttribute(m_ncId, xVarId, "location", "node");
+    PutTextAttribute(m_ncId, yVarId, "mesh", meshName);
+    PutTextAttribute(m_ncId, yVarId, "location", "node");
+
+    int edgesVarId = -1;
+    if (writeEdges)
+    {
+        const auto edgeDimId = DefineDimension(m_ncId, meshName + "_nEdges", edges.size());
+        PutTextAttribute(m_ncId, topologyVarId, "edge_node_connectivity", meshName + "_edge_nodes");
+        PutTextAttribute(m_ncId, topologyVarId, "edge_dimension", meshName + "_nEdges");
+        edgesVarId = DefineVariable(m_ncId, meshName + "_edge_nodes", NC_INT, {edgeDimId, twoDimId}, "edge_node_connectivity", "Start and end nodes of mesh edges");
+        PutIntAttribute(m_ncId, edgesVarId, "start_index", 0);
+    }
+
+    int facesVarId = -1;
+    if (writeFaces)
+    {
+        const auto faceDimId = DefineDimension(m_ncId, meshName + "_nFaces", faceNodes.size());
+        const auto maxFaceNodesDimId = DefineDimension(m_ncId, meshName + "_nMax_face_nodes", maxNumFaceNodes);
+        PutTextAttribute(m_ncId, topologyVarId, "face_node_connectivity", meshName + "_face_nodes");
+        PutTextAttribute(m_ncId, topologyVarId, "face_dimension", meshName + "_nFaces");
+        PutTextAttribute(m_ncId, topologyVarId, "max_face_nodes_dimension", meshName + "_nMax_face_nodes");
+        facesVarId = DefineVariable(m_ncId, meshName + "_face_nodes", NC_INT, {faceDimId, maxFaceNodesDimId}, "face_node_connectivity", "Vertex nodes of mesh faces (counterclockwise)");
+        PutIntAttribute(m_ncId, facesVarId, "start_index", 0);
+        PutIntAttribute(m_ncId, facesVarId, "_FillValue", intMissingValue);
+    }
+
+    CheckStatus(netcdf.enddef(m_ncId), "Could not leave define mode");
+
+    // node coordinates, written per chunk straight from the coordinate arrays
+    for (size_t start = 0; start < nodes.size(); start += maxChunkRows)
+    {
+        const size_t count = std::min(maxChunkRows, nodes.size() - start);
+        CheckStatus(netcdf.put_vara_double(m_ncId, xVarId, &start, &count, nodes.GetX().data() + start), "Could not write the node x coordinates");
+        CheckStatus(netcdf.put_vara_double(m_ncId, yVarId, &start, &count, nodes.GetY().data() + start), "Could not write the node y coordinates");
+    }
+
+    // edge nodes, copied per chunk
+    const auto edgeRows = writeEdges ? std::min(edges.size(), maxChunkRows) : 0;
+    std::vector<int> edgesChunk(2 * edgeRows);
+    for (size_t start = 0; writeEdges && start < edges.size(); start += maxChunkRows)
+    {
+        const std::array<size_t, 2> starts{start, 0};
+        const std::array<size_t, 2> counts{std::min(maxChunkRows, edges.size() - start), 2};
+        for (size_t i = 0; i < counts[0]; ++i)
+        {
+            edgesChunk[2 * i] = static_cast<int>(edges[start + i].first);
+            edgesChunk[2 * i + 1] = static_cast<int>(edges[start + i].second);
+        }
+        CheckStatus(netcdf.put_vara_int(m_ncId, edgesVarId, starts.data(), counts.data(), edgesChunk.data()), "Could not write the edge nodes");
+    }
+
+    // face nodes, padded with missing values per chunk
+    const auto faceRows = writeFaces ? std::min(faceNodes.size(), maxChunkRows) : 0;
+    std::vector<int> facesChunk(faceRows * maxNumFaceNodes);
+    for (size_t start = 0; writeFaces && start < faceNodes.size(); start += maxChunkRows)
+    {
+        const std::array<size_t, 2> starts{start, 0};
+        const std::array<size_t, 2> counts{std::min(maxChunkRows, faceNodes.size() - start), maxNumFaceNodes};
+        std::fill(facesChunk.begin(), facesChunk.end(), intMissingValue);
+        for (size_t f = 0; f < counts[0]; ++f)
+        {
+            const auto& face = faceNodes[start + f];
+            for (size_t n = 0; n < face.size(); ++n)
+            {
+                facesChunk[f * maxNumFaceNodes + n] = static_cast<int>(face[n]);
+            }
+        }
+        CheckStatus(netcdf.put_vara_int(m_ncId, facesVarId, starts.data(), counts.data(), facesChunk.data()), "Could not write the face nodes");
+    }
+}
+
+void meshkernel::UGridFile::WriteMesh2D(const Mesh2D& mesh)
+{
+    WriteTopology("mesh2d", 2, mesh.m_nodes, mesh.m_edges, mesh.m_facesNodes);
+}
+
+void meshkernel::UGridFile::WriteMesh1D(const Mesh1D& mesh)
+{
+    WriteTopology("mesh1d", 1, mesh.m_nodes, mesh.m_edges, {});
+}
@@ -0,0 +1,197 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2021.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <stdexcept>
+
+#include <MeshKernelApi/JobPool.hpp>
+
+meshkernelapi::JobPool::JobPool(size_t numWorkers)
+{
+    for (size_t w = 0; w < numWorkers; ++w)
+    {
+        m_workers.emplace_back(&JobPool::Work, this);
+    }
+}
+
+meshkernelapi::JobPool::~JobPool()
+{
+    {
+        const std::scoped_lock lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_queueChanged.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+int meshkernelapi::JobPool::Submit(int strand, Operation operation)
+{
+    int jobId;
+    {
+        const std::scoped_lock lock(m_mutex);
+        jobId = m_nextJobId++;
+
+        const auto job = std::make_shared<Job>();
+        job->m_operation = std::move(operation);
+        job->m_strand = strand;
+        m_jobs.emplace(jobId, job);
+        m_queue.emplace_back(jobId);
+    }
+    m_queueChanged.notify_one();
+    return jobId;
+}
+
+meshkernelapi::JobPool::Status meshkernelapi::JobPool::GetStatus(int jobId) const
+{
+    const std::scoped_lock lock(m_mutex);
+    return FindJob(jobId)->m_status;
+}
+
+double meshkernelapi::JobPool::GetProgress(int jobId) const
+{
+    const std::scoped_lock lock(m_mutex);
+    const auto job = FindJob(jobId);
+    if (job->m_status == Status::Completed)
+    {
+        return 1.0;
+    }
+    return job->m_progressMonitor.GetProgress();
+}
+
+bool meshkernelapi::JobPool::Cancel(int jobId)
+{
+    {
+        const std::scoped_lock lock(m_mutex);
+        const auto job = FindJob(jobId);
+        if (job->m_status == Status::Running)
+        {
+            // the operation stops at its next progress report
+            job->m_progressMonitor.RequestCancellation();
+            return true;
+        }
+        if (job->m_status != Status::Queued)
+        {
+            return false;
+        }
+
+        // the worker picking up the id skips the cancelled job
+        job->m_status = Status::Cancelled;
+        job->m_operation = nullptr;
+    }
+    m_jobFinished.notify_all();
+    return true;
+}
+
+meshkernelapi::JobResult meshkernelapi::JobPool::Wait(int jobId, Status& status)
+{
+    std::unique_lock lock(m_mutex);
+    const auto job = FindJob(jobId);
+    m_jobFinished.wait(lock, [&job] { return job->m_status == Status::Completed || job->m_status == Status::Cancelled; });
+
+    m_jobs.erase(jobId);
+    status = job->m_status;
+    return job->m_result;
+}
+
+void meshkernelapi::JobPool::Work()
+{
+    while (true)
+    {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock lock(m_mutex);
+            auto next = m_queue.end();
+            m_queueChanged.wait(lock, [this, &next] {
+                next = FindNextJob();
+                return next != m_queue.end() || (m_isStopping && m_queue.empty());
+            });
+            if (next == m_queue.end())
+            {
+                return;
+            }
+
+            job = m_jobs.at(*next);
+            m_queue.erase(next);
+            job->m_status = Status::Running;
+            m_runningStrands.insert(job->m_strand);
+        }
+
+        // the operations report their failures in the result
+        JobResult result;
+        {
+            const meshkernel::ProgressMonitorScope progressMonitorScope(job->m_progressMonitor);
+            result = job->m_operation();
+        }
+
+        {
+            const std::scoped_lock lock(m_mutex);
+            // an operation failing after a cancellation request has been stopped by it
+            const auto isCancelled = job->m_progressMonitor.IsCancellationRequested() && result.m_exitCode != 0;
+            job->m_result = std::move(result);
+            job->m_operation = nullptr;
+            job->m_status = isCancelled ? Status::Cancelled : Status::Completed;
+            m_runningStrands.erase(job->m_strand);
+        }
+        m_jobFinished.notify_all();
+
+        // the next job of the strand can start
+        m_queueChanged.notify_all();
+    }
+}
+
+std::deque<int>::iterator meshkernelapi::JobPool::FindNextJob()
+{
+    auto next = m_queue.begin();
+    while (next != m_queue.end())
+    {
+        const auto found = m_jobs.find(*next);
+        if (found == m_jobs.end() || found->second->m_status != Status::Queued)
+        {
+            next = m_queue.erase(next);
+            continue;
+        }
+        if (m_runningStrands.count(found->second->m_strand) == 0)
+        {
+            return next;
+        }
+        ++next;
+    }
+    return next;
+}
+
+std::shared_ptr<meshkernelapi::JobPool::Job> meshkernelapi::JobPool::FindJob(int jobId) const
+{
+    const auto job = m_jobs.find(jobId);
+    if (job == m_jobs.end())
+    {
+        throw std::invalid_argument("JobPool::FindJob: The selected job does not exist.");
+    }
+    return job->second;
+}
@@ -25,8 +25,14 @@
 //
 //------------------------------------------------------------------------------
 
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <MeshKernel/AveragingInterpolation.hpp>
@@ -38,32 +44,267 @@
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Exceptions.hpp>
 #include <MeshKernel/FlipEdges.hpp>
+#include <MeshKernel/Instrumentation.hpp>
 #include <MeshKernel/LandBoundaries.hpp>
 #include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/MeshQuality.hpp>
 #include <MeshKernel/MeshRefinement.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/OrthogonalizationAndSmoothing.hpp>
 #include <MeshKernel/Orthogonalizer.hpp>
 #include <MeshKernel/Polygons.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 #include <MeshKernel/Smoother.hpp>
 #include <MeshKernel/Splines.hpp>
 #include <MeshKernel/TriangulationInterpolation.hpp>
+#include <MeshKernelApi/CachedResults.hpp>
 #include <MeshKernelApi/CurvilinearParameters.hpp>
+#include <MeshKernelApi/JobPool.hpp>
 #include <MeshKernelApi/MeshKernel.hpp>
 #include <MeshKernelApi/SplinesToCurvilinearParameters.hpp>
 #include <MeshKernelApi/Utils.hpp>
 
 namespace meshkernelapi
 {
-    // The vector containing the mesh instances
-    static std::vector<std::shared_ptr<meshkernel::Mesh2D>> meshInstances;
+    /// @brief The state of a mesh kernel instance
+    struct MeshKernelState
+    {
+        std::shared_ptr<meshkernel::Mesh2D> m_mesh = std::make_shared<meshkernel::Mesh2D>();  ///< The mesh
+        std::shared_ptr<meshkernel::OrthogonalizationAndSmoothing> m_orthogonalization;       ///< The interactive orthogonalization
+        std::shared_ptr<meshkernel::CurvilinearGridFromSplines> m_curvilinearGridFromSplines; ///< The interactive curvilinear grid from splines
+        size_t m_largestSampledMemoryUsage = 0;                                               ///< The largest total memory usage sampled at the end of or during an operation, not a true peak
+        size_t m_meshVersion = 0;                                                             ///< Incremented by every call that may modify the mesh
+        size_t m_flatCopiesVersion = std::numeric_limits<size_t>::max();                      ///< The mesh version of the flat copies exchanged with the client
+        meshkernel::Mesh2D::AdministrationOptions m_flatCopiesOption{};                       ///< The administration of the flat copies exchanged with the client
+        NodeSelection m_nodeSelection;                                                        ///< The last node selection, released when fetched
+        PolygonOperation m_polygonOperation;                                                  ///< The last polygon offset or refinement, released when fetched
+        std::mutex m_mutex;                                                                   ///< Serializes the calls on this instance
+    };
+
+    // The mesh kernel instances by id. The registry lock is only held for looking up, adding or removing instances,
+    // calls on different instances run concurrently
+    static std::map<int, std::shared_ptr<MeshKernelState>> meshKernelStates;
+    static std::mutex meshKernelStatesMutex;
+
+    // The errors are reported to the thread making the call
+    static thread_local char exceptionMessage[512] = "";
+    static thread_local meshkernel::MeshGeometryError meshGeometryError = meshkernel::MeshGeometryError();
+
+    // The last timings and memory usage reports of the calling thread
+    static thread_local std::string timingsReport;
+    static thread_local std::string memoryUsageReport;
+    static thread_local std::string meshQualityReport;
+
+    /// @brief Gets the state of a mesh kernel instance
+    /// @param[in] meshKernelId The id of the mesh kernel instance
+    /// @returns The state, kept alive for the caller even if the instance is deallocated concurrently
+    static std::shared_ptr<MeshKernelState> GetState(int meshKernelId)
+    {
+        const std::scoped_lock lock(meshKernelStatesMutex);
+        const auto state = meshKernelStates.find(meshKernelId);
+        if (state == meshKernelStates.end())
+        {
+            throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
+        }
+        return state->second;
+    }
+
+    /// @brief Locks the state of a mesh kernel instance for the duration of a call
+    ///
+    /// Unless the call is declared read-only, the mesh version is incremented when the lock is released,
+    /// invalidating the results cached for the previous version of the mesh
+    class StateLock
+    {
+    public:
+        /// @brief Locks the state
+        /// @param[in] state The state of the mesh kernel instance
+        /// @param[in] isReadOnly Whether the call leaves the mesh unmodified
+        explicit StateLock(MeshKernelState& state, bool isReadOnly = false) : m_state(state), m_lock(state.m_mutex), m_isReadOnly(isReadOnly) {}
+
+        /// @brief Unlocks the state, incrementing the mesh version if the call may have modified the mesh
+        ~StateLock()
+        {
+            if (!m_isReadOnly)
+            {
+                m_state.m_meshVersion++;
+            }
+        }
+
+        StateLock(const StateLock&) = delete;
+        StateLock& operator=(const StateLock&) = delete;
+
+    private:
+        MeshKernelState& m_state;                  ///< The locked state
+        const std::scoped_lock<std::mutex> m_lock; ///< The lock on the state
+        bool m_isReadOnly;                         ///< Whether the call leaves the mesh unmodified
+    };
+
+    /// @brief Sets the flat copies of the mesh exchanged with the client, unless they are up to date
+    ///
+    /// While the mesh is not modified, repeated exchanges return the same buffers without administrating or copying the mesh again
+    /// @param[in,out] state The state of the mesh kernel instance
+    /// @param[in] administrationOption The administration required by the exchange
+    static void SetFlatCopies(MeshKernelState& state, meshkernel::Mesh2D::AdministrationOptions administrationOption)
+    {
+        if (state.m_flatCopiesVersion == state.m_meshVersion && state.m_flatCopiesOption == administrationOption)
+        {
+            return;
+        }
+
+        state.m_mesh->SetFlatCopies(administrationOption);
+
+        // the administration can renumber the nodes and the edges
+        state.m_meshVersion++;
+        state.m_flatCopiesVersion = state.m_meshVersion;
+        state.m_flatCopiesOption = administrationOption;
+    }
+
+    /// @brief Administrates the faces of the mesh if a modification left them out of date
+    ///
+    /// The quality inquiries read the faces of the edges. They lock the state read-only, so the administration records a renumbering itself
+    /// @param[in,out] state The state of the mesh kernel instance
+    static void AdministrateOutOfDateFaces(MeshKernelState& state)
+    {
+        if (state.m_mesh->HasUpToDateFaceAdministration())
+        {
+            return;
+        }
+
+        const auto numNodes = state.m_mesh->m_nodes.size();
+        const auto numEdges = state.m_mesh->m_edges.size();
+        state.m_mesh->Administrate(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+
+        // the administration renumbers the nodes and the edges only if it removes invalid ones
+        if (state.m_mesh->m_nodes.size() != numNodes || state.m_mesh->m_edges.size() != numEdges)
+        {
+            state.m_meshVersion++;
+        }
+    }
+
+    /// @brief Selects the mesh nodes in polygons, reusing the last selection if neither the polygon nor the mesh changed
+    /// @param[in,out] state The state of the mesh kernel instance
+    /// @param[in] geometryList The selection polygon
+    /// @param[in] inside Whether the nodes inside (1) or outside the polygon are selected
+    /// @returns The indices of the selected nodes
+    static const std::vector<int>& SelectNodesInPolygons(MeshKernelState& state, const GeometryList& geometryList, int inside)
+    {
+        const bool selectInside = inside == 1 ? true : false;
+        return state.m_nodeSelection.Compute(ConvertGeometryListToPointVector(geometryList),
+                                             selectInside,
+                                             state.m_meshVersion,
+                                             [&state](const std::vector<meshkernel::Point>& polygonPoints, bool selectInside) {
+                                                 const meshkernel::Polygons polygon(polygonPoints, state.m_mesh->m_projection);
+                                                 state.m_mesh->MaskNodesInPolygons(polygon, selectInside);
+
+                                                 std::vector<int> selectedNodes;
+                                                 for (auto i = 0; i < state.m_mesh->GetNumNodes(); ++i)
+                                                 {
+                                                     if (state.m_mesh->m_nodeMask[i] > 0)
+                                                     {
+                                                         selectedNodes.emplace_back(i);
+                                                     }
+                                                 }
+                                                 return selectedNodes;
+                                             });
+    }
+
+    /// @brief Computes a polygon operation, reusing the last result if neither the polygon nor the parameters changed
+    /// @param[in,out] state The state of the mesh kernel instance
+    /// @param[in] geometryList The input polygon
+    /// @param[in] parameters The operation and its parameters
+    /// @param[in] operation The operation, computing the resulting polygon from the input polygon
+    /// @returns The resulting polygon
+    template <typename Operation>
+    static const std::vector<meshkernel::Point>& ComputePolygonOperation(MeshKernelState& state,
+                                                                         const GeometryList& geometryList,
+                                                                         const PolygonOperationParameters& parameters,
+                                                                         Operation operation)
+    {
+        return state.m_polygonOperation.Compute(ConvertGeometryListToPointVector(geometryList), parameters, operation);
+    }
+
+    /// @brief Gets the parameters identifying a polygon refinement, see \ref ComputePolygonOperation
+    static PolygonOperationParameters RefinePolygonParameters(const MeshKernelState& state, int firstIndex, int secondIndex, double distance)
+    {
+        PolygonOperationParameters parameters;
+        parameters.m_type = PolygonOperationParameters::Type::Refinement;
+        parameters.m_projection = state.m_mesh->m_projection;
+        parameters.m_firstIndex = firstIndex;
+        parameters.m_secondIndex = secondIndex;
+        parameters.m_distance = distance;
+        return parameters;
+    }
+
+    /// @brief Gets the parameters identifying a polygon offset, see \ref ComputePolygonOperation
+    static PolygonOperationParameters OffsetPolygonParameters(const MeshKernelState& state, bool innerPolygon, double distance)
+    {
+        PolygonOperationParameters parameters;
+        parameters.m_type = PolygonOperationParameters::Type::Offset;
+        parameters.m_projection = state.m_mesh->m_projection;
+        parameters.m_innerPolygon = innerPolygon;
+        parameters.m_distance = distance;
+        return parameters;
+    }
+
+    /// @brief Adds the bytes allocated by a mesh kernel instance besides its mesh
+    /// @param[in] state The state of the mesh kernel instance
+    /// @param[in,out] memoryUsage The memory usage of the interactive orthogonalization and of the cached selection and polygon results
+    static void AccumulateStateMemoryUsage(const MeshKernelState& state, meshkernel::MemoryUsage& memoryUsage)
+    {
+        if (state.m_orthogonalization != nullptr)
+        {
+            state.m_orthogonalization->AccumulateMemoryUsage(memoryUsage);
+        }
+        memoryUsage.AddVectors("Node selection", state.m_nodeSelection.m_polygon, state.m_nodeSelection.m_selectedNodes);
+        memoryUsage.AddVectors("Polygon operation", state.m_polygonOperation.m_polygon, state.m_polygonOperation.m_result);
+    }
+
+    /// @brief Gets the bytes allocated by a mesh kernel instance, by subsystem
+    /// @param[in] state The state of the mesh kernel instance
+    /// @returns The memory usage of the mesh, of the interactive orthogonalization and of the cached selection and polygon results
+    static meshkernel::MemoryUsage GetMemoryUsage(const MeshKernelState& state)
+    {
+        auto memoryUsage = state.m_mesh->GetMemoryUsage();
+        AccumulateStateMemoryUsage(state, memoryUsage);
+        return memoryUsage;
+    }
+
+    /// @brief Records the memory usage of a mesh kernel instance at the end of an operation, keeping the largest sampled total
+    /// @param[in,out] state The state of the mesh kernel instance
+    /// @param[in] memoryUsage The memory usage, including the algorithm state released at the end of the operation
+    static void RecordEndOfOperationMemoryUsage(MeshKernelState& state, const meshkernel::MemoryUsage& memoryUsage)
+    {
+        state.m_largestSampledMemoryUsage = std::max(state.m_largestSampledMemoryUsage, memoryUsage.GetTotal());
+    }
+
+    /// @brief Records the memory usage of a mesh kernel instance at the end of an operation, keeping the largest sampled total
+    /// @param[in,out] state The state of the mesh kernel instance
+    static void RecordEndOfOperationMemoryUsage(MeshKernelState& state)
+    {
+        RecordEndOfOperationMemoryUsage(state, GetMemoryUsage(state));
+    }
 
-    // For interactivity
-    static std::map<int, std::shared_ptr<meshkernel::OrthogonalizationAndSmoothing>> orthogonalizationInstances;
-    static std::map<int, std::shared_ptr<meshkernel::CurvilinearGridFromSplines>> curvilinearGridFromSplinesInstances;
+    /// @brief Runs an algorithm with its memory usage sampled by the algorithm, keeping the largest sampled total
+    ///
+    /// The algorithm samples the mesh and its own state, including the buffers it releases before returning.
+    /// The other allocations of the instance do not change meanwhile and are added to each sample.
+    /// The sampling monitor is nested in the monitor of an asynchronous job, which can still cancel the algorithm and receives its progress
+    /// @param[in,out] state The state of the mesh kernel instance, whose mesh the algorithm modifies
+    /// @param[in] compute The function running the algorithm
+    template <typename Compute>
+    static void ComputeSamplingMemoryUsage(MeshKernelState& state, Compute&& compute)
+    {
+        meshkernel::MemoryUsage stateMemoryUsage;
+        AccumulateStateMemoryUsage(state, stateMemoryUsage);
 
-    static char exceptionMessage[512] = "";
-    static meshkernel::MeshGeometryError meshGeometryError = meshkernel::MeshGeometryError();
+        meshkernel::ProgressMonitor progressMonitor;
+        progressMonitor.EnableMemoryUsageSampling();
+        {
+            const meshkernel::ProgressMonitorScope progressMonitorScope(progressMonitor);
+            compute();
+        }
+        state.m_largestSampledMemoryUsage = std::max(state.m_largestSampledMemoryUsage, stateMemoryUsage.GetTotal() + progressMonitor.GetLargestMemoryUsage());
+    }
 
     int HandleExceptions(const std::exception_ptr exceptionPtr)
     {
@@ -84,22 +325,73 @@ namespace meshkernelapi
         }
     }
 
+    /// @brief Gets the pool executing the asynchronous jobs, started on first use
+    /// @returns The job pool
+    static JobPool& GetJobPool()
+    {
+        static JobPool jobPool(std::max(std::thread::hardware_concurrency(), 1u));
+        return jobPool;
+    }
+
+    /// @brief Submits an API call as an asynchronous job
+    ///
+    /// The jobs on the same state run in the order they were submitted
+    /// @param[in] meshKernelId The id of the state the API call operates on
+    /// @param[in] operation The API call
+    /// @returns The job id
+    static int SubmitJob(int meshKernelId, std::function<int()> operation)
+    {
+        return GetJobPool().Submit(meshKernelId, [operation = std::move(operation)] {
+            // the errors are reported to the worker thread, keep them in the result
+            JobResult result;
+            result.m_exitCode = operation();
+            if (result.m_exitCode != Success)
+            {
+                result.m_errorMessage = exceptionMessage;
+                result.m_geometryError = meshGeometryError;
+            }
+            return result;
+        });
+    }
+
     MKERNEL_API int mkernel_new_mesh(int& meshKernelId)
     {
-        meshKernelId = int(meshInstances.size());
-        meshInstances.emplace_back(std::make_shared<meshkernel::Mesh2D>());
-        return Success;
+        int exitCode = Success;
+        try
+        {
+            const std::scoped_lock lock(meshKernelStatesMutex);
+
+            // the lowest free id, ids of the other instances are never changed
+            meshKernelId = 0;
+            while (meshKernelStates.find(meshKernelId) != meshKernelStates.end())
+            {
+                meshKernelId++;
+            }
+            meshKernelStates.emplace(meshKernelId, std::make_shared<MeshKernelState>());
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
     };
 
     MKERNEL_API int mkernel_deallocate_state(int meshKernelId)
     {
-        if (meshKernelId < 0 && meshKernelId >= meshInstances.size())
+        int exitCode = Success;
+        try
+        {
+            const std::scoped_lock lock(meshKernelStatesMutex);
+            if (meshKernelStates.erase(meshKernelId) == 0)
+            {
+                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
+            }
+        }
+        catch (...)
         {
-            return -1;
+            exitCode = HandleExceptions(std::current_exception());
         }
-
-        meshInstances.erase(meshInstances.begin() + meshKernelId);
-        return 0;
+        return exitCode;
     }
 
     MKERNEL_API int mkernel_delete_mesh(int meshKernelId, const GeometryList& geometryListIn, int deletionOption, bool invertDeletion)
@@ -107,19 +399,17 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
 
             auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
 
-            const meshkernel::Polygons polygon(polygonPoints, meshInstances[meshKernelId]->m_projection);
-            meshInstances[meshKernelId]->DeleteMesh(polygon, deletionOption, invertDeletion);
+            const meshkernel::Polygons polygon(polygonPoints, state->m_mesh->m_projection);
+            state->m_mesh->DeleteMesh(polygon, deletionOption, invertDeletion);
         }
         catch (...)
         {
@@ -133,23 +423,18 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-
-            const auto edges = meshkernel::ConvertToEdgeNodesVector(meshGeometryDimensions.numedge, meshGeometry.edge_nodes);
-            const auto nodes = meshkernel::ConvertToNodesVector(meshGeometryDimensions.numnode, meshGeometry.nodex, meshGeometry.nodey);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             // spherical or cartesian
-            if (isGeographic)
-            {
-                meshInstances[meshKernelId] = std::make_shared<meshkernel::Mesh2D>(edges, nodes, meshkernel::Projection::spherical);
-            }
-            else
-            {
-                meshInstances[meshKernelId] = std::make_shared<meshkernel::Mesh2D>(edges, nodes, meshkernel::Projection::cartesian);
-            }
+            const auto projection = isGeographic ? meshkernel::Projection::spherical : meshkernel::Projection::cartesian;
+
+            // the node coordinate arrays are copied once into the coordinate arrays of the mesh, the edges are converted once
+            state->m_mesh = std::make_shared<meshkernel::Mesh2D>(meshkernel::ConvertToEdgeNodesVector(meshGeometryDimensions.numedge, meshGeometry.edge_nodes),
+                                                                 meshkernel::ConvertToNodeCoordinates(meshGeometryDimensions.numnode, meshGeometry.nodex, meshGeometry.nodey),
+                                                                 projection);
+
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -163,14 +448,14 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
+
+            SetFlatCopies(*state, meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdges);
 
-            meshInstances[meshKernelId]->SetFlatCopies(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdges);
+            SetMeshGeometry(*state->m_mesh, meshGeometryDimensions, meshGeometry);
 
-            SetMeshGeometry(meshInstances, meshKernelId, meshGeometryDimensions, meshGeometry);
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -184,13 +469,14 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            meshInstances[meshKernelId]->SetFlatCopies(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
+
+            SetFlatCopies(*state, meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+
+            SetMeshGeometry(*state->m_mesh, meshGeometryDimensions, meshGeometry);
 
-            SetMeshGeometry(meshInstances, meshKernelId, meshGeometryDimensions, meshGeometry);
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -204,12 +490,10 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            const auto hangingEdges = meshInstances[meshKernelId]->GetHangingEdges();
+            const auto hangingEdges = state->m_mesh->GetHangingEdges();
             numHangingEdges = hangingEdges.size();
         }
         catch (...)
@@ -224,11 +508,9 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            const auto hangingEdges = meshInstances[meshKernelId]->GetHangingEdges();
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            const auto hangingEdges = state->m_mesh->GetHangingEdges();
             for (auto i = 0; i < hangingEdges.size(); ++i)
             {
                 *(hangingEdgesIndices)[i] = hangingEdges[i];
@@ -246,11 +528,9 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            meshInstances[meshKernelId]->DeleteHangingEdges();
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            state->m_mesh->DeleteHangingEdges();
         }
         catch (...)
         {
@@ -268,11 +548,9 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
@@ -285,7 +563,7 @@ namespace meshkernelapi
                 nodes[i].y = geometryListPolygon.yCoordinates[i];
             }
 
-            auto polygon = std::make_shared<meshkernel::Polygons>(nodes, meshInstances[meshKernelId]->m_projection);
+            auto polygon = std::make_shared<meshkernel::Polygons>(nodes, state->m_mesh->m_projection);
 
             // build land boundary
             std::vector<meshkernel::Point> landBoundaries(geometryListLandBoundaries.numberOfCoordinates);
@@ -295,11 +573,11 @@ namespace meshkernelapi
                 landBoundaries[i].y = geometryListLandBoundaries.yCoordinates[i];
             }
 
-            const auto orthogonalizer = std::make_shared<meshkernel::Orthogonalizer>(meshInstances[meshKernelId]);
-            const auto smoother = std::make_shared<meshkernel::Smoother>(meshInstances[meshKernelId]);
-            const auto landBoundary = std::make_shared<meshkernel::LandBoundaries>(landBoundaries, meshInstances[meshKernelId], polygon);
+            const auto orthogonalizer = std::make_shared<meshkernel::Orthogonalizer>(state->m_mesh);
+            const auto smoother = std::make_shared<meshkernel::Smoother>(state->m_mesh);
+            const auto landBoundary = std::make_shared<meshkernel::LandBoundaries>(landBoundaries, state->m_mesh, polygon);
 
-            meshkernel::OrthogonalizationAndSmoothing ortogonalization(meshInstances[meshKernelId],
+            meshkernel::OrthogonalizationAndSmoothing ortogonalization(state->m_mesh,
                                                                        smoother,
                                                                        orthogonalizer,
                                                                        polygon,
@@ -307,7 +585,12 @@ namespace meshkernelapi
                                                                        static_cast<meshkernel::LandBoundaries::ProjectToLandBoundaryOption>(projectToLandBoundaryOption),
                                                                        orthogonalizationParameters);
             ortogonalization.Initialize();
-            ortogonalization.Compute();
+            ComputeSamplingMemoryUsage(*state, [&ortogonalization] { ortogonalization.Compute(); });
+
+            // the linear system and the operators are released with the algorithm, account them while alive
+            auto memoryUsage = GetMemoryUsage(*state);
+            ortogonalization.AccumulateMemoryUsage(memoryUsage);
+            RecordEndOfOperationMemoryUsage(*state, memoryUsage);
         }
         catch (...)
         {
@@ -325,12 +608,10 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
@@ -351,12 +632,12 @@ namespace meshkernelapi
                 landBoundaries[i].y = geometryListLandBoundaries.yCoordinates[i];
             }
 
-            auto orthogonalizer = std::make_shared<meshkernel::Orthogonalizer>(meshInstances[meshKernelId]);
-            auto smoother = std::make_shared<meshkernel::Smoother>(meshInstances[meshKernelId]);
-            auto polygon = std::make_shared<meshkernel::Polygons>(nodes, meshInstances[meshKernelId]->m_projection);
-            auto landBoundary = std::make_shared<meshkernel::LandBoundaries>(landBoundaries, meshInstances[meshKernelId], polygon);
+            auto orthogonalizer = std::make_shared<meshkernel::Orthogonalizer>(state->m_mesh);
+            auto smoother = std::make_shared<meshkernel::Smoother>(state->m_mesh);
+            auto polygon = std::make_shared<meshkernel::Polygons>(nodes, state->m_mesh->m_projection);
+            auto landBoundary = std::make_shared<meshkernel::LandBoundaries>(landBoundaries, state->m_mesh, polygon);
 
-            auto orthogonalizationInstance = std::make_shared<meshkernel::OrthogonalizationAndSmoothing>(meshInstances[meshKernelId],
+            auto orthogonalizationInstance = std::make_shared<meshkernel::OrthogonalizationAndSmoothing>(state->m_mesh,
                                                                                                          smoother,
                                                                                                          orthogonalizer,
                                                                                                          polygon,
@@ -365,7 +646,7 @@ namespace meshkernelapi
                                                                                                          orthogonalizationParameters);
             orthogonalizationInstance->Initialize();
 
-            orthogonalizationInstances.insert({meshKernelId, orthogonalizationInstance});
+            state->m_orthogonalization = orthogonalizationInstance;
         }
         catch (...)
         {
@@ -379,17 +660,17 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
 
-            orthogonalizationInstances[meshKernelId]->PrepareOuterIteration();
+            state->m_orthogonalization->PrepareOuterIteration();
+
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -403,17 +684,15 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
 
-            orthogonalizationInstances[meshKernelId]->InnerIteration();
+            state->m_orthogonalization->InnerIteration();
         }
         catch (...)
         {
@@ -427,17 +706,15 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
 
-            orthogonalizationInstances[meshKernelId]->FinalizeOuterIteration();
+            state->m_orthogonalization->FinalizeOuterIteration();
         }
         catch (...)
         {
@@ -451,17 +728,15 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
 
-            orthogonalizationInstances.erase(meshKernelId);
+            state->m_orthogonalization.reset();
         }
         catch (...)
         {
@@ -475,17 +750,17 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
 
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
 
-            const auto result = meshInstances[meshKernelId]->GetOrthogonality();
+            AdministrateOutOfDateFaces(*state);
+
+            const auto result = state->m_mesh->GetOrthogonality();
 
             for (auto i = 0; i < geometryList.numberOfCoordinates; ++i)
             {
@@ -504,17 +779,17 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
 
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 return exitCode;
             }
 
-            const auto result = meshInstances[meshKernelId]->GetSmoothness();
+            AdministrateOutOfDateFaces(*state);
+
+            const auto result = state->m_mesh->GetSmoothness();
 
             for (auto i = 0; i < geometryList.numberOfCoordinates; ++i)
             {
@@ -597,19 +872,19 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             auto result = ConvertGeometryListToPointVector(geometryList);
 
-            const meshkernel::Polygons polygon(result, meshInstances[meshKernelId]->m_projection);
+            const meshkernel::Polygons polygon(result, state->m_mesh->m_projection);
 
             meshkernel::Mesh2D mesh;
             mesh.MakeMesh(makeGridParameters, polygon);
 
-            *meshInstances[meshKernelId] += mesh;
+            *state->m_mesh += mesh;
+
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -623,19 +898,21 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
             auto result = ConvertGeometryListToPointVector(disposableGeometryListIn);
 
-            const meshkernel::Polygons polygon(result, meshInstances[meshKernelId]->m_projection);
+            const meshkernel::Polygons polygon(result, state->m_mesh->m_projection);
 
-            // generate samples in all polygons
-            const auto generatedPoints = polygon.ComputePointsInPolygons();
+            // generate samples in all polygons, then mesh each polygon moving its samples into the mesh
+            auto generatedPoints = polygon.ComputePointsInPolygons();
+            for (auto& polygonPoints : generatedPoints)
+            {
+                const meshkernel::Mesh2D mesh(std::move(polygonPoints), polygon, state->m_mesh->m_projection);
+                *state->m_mesh += mesh;
+            }
 
-            const meshkernel::Mesh2D mesh(generatedPoints[0], polygon, meshInstances[meshKernelId]->m_projection);
-            *meshInstances[meshKernelId] += mesh;
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -649,15 +926,15 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
             auto samplePoints = ConvertGeometryListToPointVector(geometryList);
 
             meshkernel::Polygons polygon;
-            const meshkernel::Mesh2D mesh(samplePoints, polygon, meshInstances[meshKernelId]->m_projection);
-            *meshInstances[meshKernelId] += mesh;
+            const meshkernel::Mesh2D mesh(samplePoints, polygon, state->m_mesh->m_projection);
+            *state->m_mesh += mesh;
+
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -671,13 +948,11 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             const std::vector<meshkernel::Point> polygonNodes;
-            const auto meshBoundaryPolygon = meshInstances[meshKernelId]->MeshBoundaryToPolygon(polygonNodes);
+            const auto meshBoundaryPolygon = state->m_mesh->MeshBoundaryToPolygon(polygonNodes);
 
             ConvertPointVectorToGeometryList(meshBoundaryPolygon, geometryList);
         }
@@ -693,13 +968,11 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             const std::vector<meshkernel::Point> polygonNodes;
-            const auto meshBoundaryPolygon = meshInstances[meshKernelId]->MeshBoundaryToPolygon(polygonNodes);
+            const auto meshBoundaryPolygon = state->m_mesh->MeshBoundaryToPolygon(polygonNodes);
             numberOfPolygonNodes = static_cast<int>(meshBoundaryPolygon.size() - 1); // last value is a separator
         }
         catch (...)
@@ -714,16 +987,17 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
-
-            const meshkernel::Polygons polygon(polygonPoints, meshInstances[meshKernelId]->m_projection);
-            const auto refinedPolygon = polygon.RefineFirstPolygon(firstIndex, secondIndex, distance);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
+            const auto& refinedPolygon = ComputePolygonOperation(*state,
+                                                                 geometryListIn,
+                                                                 RefinePolygonParameters(*state, firstIndex, secondIndex, distance),
+                                                                 [&](const meshkernel::Polygons& polygon) { return polygon.RefineFirstPolygon(firstIndex, secondIndex, distance); });
             ConvertPointVectorToGeometryList(refinedPolygon, geometryListOut);
+
+            // the result is fetched, release it
+            state->m_polygonOperation = PolygonOperation();
         }
         catch (...)
         {
@@ -737,17 +1011,14 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-
-            auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
-
-            const meshkernel::Polygons polygon(polygonPoints, meshInstances[meshKernelId]->m_projection);
-
-            const auto refinedPolygon = polygon.RefineFirstPolygon(firstIndex, secondIndex, distance);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
+            // the result is kept for the following mkernel_refine_polygon call
+            const auto& refinedPolygon = ComputePolygonOperation(*state,
+                                                                 geometryListIn,
+                                                                 RefinePolygonParameters(*state, firstIndex, secondIndex, distance),
+                                                                 [&](const meshkernel::Polygons& polygon) { return polygon.RefineFirstPolygon(firstIndex, secondIndex, distance); });
             numberOfPolygonNodes = int(refinedPolygon.size());
         }
         catch (...)
@@ -762,16 +1033,14 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
 
-            const meshkernel::Polygons polygon(polygonPoints, meshInstances[meshKernelId]->m_projection);
+            const meshkernel::Polygons polygon(polygonPoints, state->m_mesh->m_projection);
 
-            meshInstances[meshKernelId]->MergeNodesInPolygon(polygon);
+            state->m_mesh->MergeNodesInPolygon(polygon);
         }
         catch (...)
         {
@@ -785,11 +1054,9 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            meshInstances[meshKernelId]->MergeTwoNodes(startNode, endNode);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            state->m_mesh->MergeTwoNodes(startNode, endNode);
         }
         catch (...)
         {
@@ -798,32 +1065,19 @@ namespace meshkernelapi
         return exitCode;
     }
 
-    MKERNEL_API int mkernel_nodes_in_polygons(int meshKernelId, GeometryList& geometryListIn, int inside, int numberOfMeshNodes, int** selectedNodes)
+    MKERNEL_API int mkernel_nodes_in_polygons(int meshKernelId, const GeometryList& geometryListIn, int inside, int** selectedNodes)
     {
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-
-            auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
-
-            const meshkernel::Polygons polygon(polygonPoints, meshInstances[meshKernelId]->m_projection);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
 
-            const bool selectInside = inside == 1 ? true : false;
-            meshInstances[meshKernelId]->MaskNodesInPolygons(polygon, selectInside);
+            const auto& selection = SelectNodesInPolygons(*state, geometryListIn, inside);
+            std::copy(selection.begin(), selection.end(), *selectedNodes);
 
-            int index = 0;
-            for (auto i = 0; i < meshInstances[meshKernelId]->GetNumNodes(); ++i)
-            {
-                if (meshInstances[meshKernelId]->m_nodeMask[i] > 0)
-                {
-                    (*selectedNodes)[index] = i;
-                    index++;
-                }
-            }
+            // the selection is fetched, release it
+            state->m_nodeSelection = NodeSelection();
         }
         catch (...)
         {
@@ -832,30 +1086,16 @@ namespace meshkernelapi
         return exitCode;
     }
 
-    MKERNEL_API int mkernel_count_nodes_in_polygons(int meshKernelId, GeometryList& geometryListIn, int inside, int& numberOfMeshNodes)
+    MKERNEL_API int mkernel_count_nodes_in_polygons(int meshKernelId, const GeometryList& geometryListIn, int inside, int& numberOfMeshNodes)
     {
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
 
-            const meshkernel::Polygons polygon(polygonPoints, meshInstances[meshKernelId]->m_projection);
-
-            const bool selectInside = inside == 1 ? true : false;
-            meshInstances[meshKernelId]->MaskNodesInPolygons(polygon, selectInside);
-
-            numberOfMeshNodes = 0;
-            for (auto i = 0; i < meshInstances[meshKernelId]->GetNumNodes(); ++i)
-            {
-                if (meshInstances[meshKernelId]->m_nodeMask[i] > 0)
-                {
-                    numberOfMeshNodes++;
-                }
-            }
+            // the selection is kept for the following mkernel_nodes_in_polygons call
+            numberOfMeshNodes = static_cast<int>(SelectNodesInPolygons(*state, geometryListIn, inside).size());
         }
         catch (...)
         {
@@ -869,12 +1109,10 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            new_edge_index = meshInstances[meshKernelId]->ConnectNodes(startNode, endNode);
+            new_edge_index = state->m_mesh->ConnectNodes(startNode, endNode);
         }
         catch (...)
         {
@@ -888,15 +1126,11 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                //create a valid instance, by default cartesian
-                *meshInstances[meshKernelId] = meshkernel::Mesh2D();
-                meshInstances[meshKernelId]->m_projection = meshkernel::Projection::cartesian;
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             const meshkernel::Point newNode{xCoordinate, yCoordinate};
-            nodeIndex = meshInstances[meshKernelId]->InsertNode(newNode);
+            nodeIndex = state->m_mesh->InsertNode(newNode);
         }
         catch (...)
         {
@@ -910,12 +1144,10 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            meshInstances[meshKernelId]->DeleteNode(nodeIndex);
+            state->m_mesh->DeleteNode(nodeIndex);
         }
         catch (...)
         {
@@ -929,14 +1161,12 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             auto newPoint = ConvertGeometryListToPointVector(geometryListIn);
 
-            meshInstances[meshKernelId]->MoveNode(newPoint[0], nodeIndex);
+            state->m_mesh->MoveNode(newPoint[0], nodeIndex);
         }
         catch (...)
         {
@@ -950,16 +1180,14 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             auto newPoint = ConvertGeometryListToPointVector(geometryListIn);
 
-            const auto edgeIndex = meshInstances[meshKernelId]->FindEdgeCloseToAPoint(newPoint[0]);
+            const auto edgeIndex = state->m_mesh->FindEdgeCloseToAPoint(newPoint[0]);
 
-            meshInstances[meshKernelId]->DeleteEdge(edgeIndex);
+            state->m_mesh->DeleteEdge(edgeIndex);
         }
         catch (...)
         {
@@ -973,14 +1201,12 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
 
             auto newPoint = ConvertGeometryListToPointVector(geometryListIn);
 
-            edgeIndex = static_cast<int>(meshInstances[meshKernelId]->FindEdgeCloseToAPoint(newPoint[0]));
+            edgeIndex = static_cast<int>(state->m_mesh->FindEdgeCloseToAPoint(newPoint[0]));
         }
         catch (...)
         {
@@ -994,18 +1220,17 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
+            const auto& newPolygon = ComputePolygonOperation(*state,
+                                                             geometryListIn,
+                                                             OffsetPolygonParameters(*state, innerPolygon, distance),
+                                                             [&](const meshkernel::Polygons& polygon) { return polygon.OffsetCopy(distance, innerPolygon).m_nodes; });
+            ConvertPointVectorToGeometryList(newPolygon, geometryListOut);
 
-            const meshkernel::Polygons polygon(polygonPoints, meshInstances[meshKernelId]->m_projection);
-
-            const auto newPolygon = polygon.OffsetCopy(distance, innerPolygon);
-
-            ConvertPointVectorToGeometryList(newPolygon.m_nodes, geometryListOut);
+            // the result is fetched, release it
+            state->m_polygonOperation = PolygonOperation();
         }
         catch (...)
         {
@@ -1019,16 +1244,15 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
-
-            const meshkernel::Polygons polygon(polygonPoints, meshInstances[meshKernelId]->m_projection);
-            const auto newPolygon = polygon.OffsetCopy(distance, innerPolygon);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            numberOfPolygonNodes = newPolygon.GetNumNodes();
+            // the result is kept for the following mkernel_offsetted_polygon call
+            const auto& newPolygon = ComputePolygonOperation(*state,
+                                                             geometryListIn,
+                                                             OffsetPolygonParameters(*state, innerPolygon, distance),
+                                                             [&](const meshkernel::Polygons& polygon) { return polygon.OffsetCopy(distance, innerPolygon).m_nodes; });
+            numberOfPolygonNodes = static_cast<int>(newPolygon.size());
         }
         catch (...)
         {
@@ -1045,11 +1269,9 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 throw std::invalid_argument("MeshKernel: The selected mesh has no nodes.");
             }
@@ -1070,7 +1292,7 @@ namespace meshkernelapi
             const bool refineOutsideFace = sampleRefineParameters.AccountForSamplesOutside == 1 ? true : false;
             const bool transformSamples = sampleRefineParameters.RefinementType == 3 ? true : false;
 
-            const auto averaging = std::make_shared<meshkernel::AveragingInterpolation>(meshInstances[meshKernelId],
+            const auto averaging = std::make_shared<meshkernel::AveragingInterpolation>(state->m_mesh,
                                                                                         samples,
                                                                                         averagingMethod,
                                                                                         meshkernel::MeshLocations::Faces,
@@ -1078,8 +1300,12 @@ namespace meshkernelapi
                                                                                         refineOutsideFace,
                                                                                         transformSamples);
 
-            meshkernel::MeshRefinement meshRefinement(meshInstances[meshKernelId], averaging, sampleRefineParameters, interpolationParameters);
-            meshRefinement.Compute();
+            meshkernel::MeshRefinement meshRefinement(state->m_mesh, averaging, sampleRefineParameters, interpolationParameters);
+            ComputeSamplingMemoryUsage(*state, [&meshRefinement] { meshRefinement.Compute(); });
+
+            auto memoryUsage = GetMemoryUsage(*state);
+            meshRefinement.AccumulateMemoryUsage(memoryUsage);
+            RecordEndOfOperationMemoryUsage(*state, memoryUsage);
         }
         catch (...)
         {
@@ -1093,21 +1319,23 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 throw std::invalid_argument("MeshKernel: The selected mesh has no nodes.");
             }
 
             auto points = ConvertGeometryListToPointVector(geometryList);
 
-            const meshkernel::Polygons polygon(points, meshInstances[meshKernelId]->m_projection);
+            const meshkernel::Polygons polygon(points, state->m_mesh->m_projection);
+
+            meshkernel::MeshRefinement meshRefinement(state->m_mesh, polygon, interpolationParameters);
+            ComputeSamplingMemoryUsage(*state, [&meshRefinement] { meshRefinement.Compute(); });
 
-            meshkernel::MeshRefinement meshRefinement(meshInstances[meshKernelId], polygon, interpolationParameters);
-            meshRefinement.Compute();
+            auto memoryUsage = GetMemoryUsage(*state);
+            meshRefinement.AccumulateMemoryUsage(memoryUsage);
+            RecordEndOfOperationMemoryUsage(*state, memoryUsage);
         }
         catch (...)
         {
@@ -1121,18 +1349,16 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 throw std::invalid_argument("MeshKernel: The selected mesh has no nodes.");
             }
 
             auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
 
-            nodeIndex = static_cast<int>(meshInstances[meshKernelId]->FindNodeCloseToAPoint(polygonPoints[0], searchRadius));
+            nodeIndex = static_cast<int>(state->m_mesh->FindNodeCloseToAPoint(polygonPoints[0], searchRadius));
         }
         catch (...)
         {
@@ -1146,11 +1372,9 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            if (meshInstances[meshKernelId]->GetNumNodes() <= 0)
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
+            if (state->m_mesh->GetNumNodes() <= 0)
             {
                 throw std::invalid_argument("MeshKernel: The selected mesh has no nodes.");
             }
@@ -1162,10 +1386,10 @@ namespace meshkernelapi
 
             auto polygonPoints = ConvertGeometryListToPointVector(geometryListIn);
 
-            const auto nodeIndex = meshInstances[meshKernelId]->FindNodeCloseToAPoint(polygonPoints[0], searchRadius);
+            const auto nodeIndex = state->m_mesh->FindNodeCloseToAPoint(polygonPoints[0], searchRadius);
 
             // Set the node coordinate
-            const auto node = meshInstances[meshKernelId]->m_nodes[nodeIndex];
+            const meshkernel::Point node = state->m_mesh->m_nodes[nodeIndex];
             std::vector<meshkernel::Point> pointVector;
             pointVector.emplace_back(node);
             ConvertPointVectorToGeometryList(pointVector, geometryListOut);
@@ -1185,20 +1409,18 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             // use the default constructor, no instance present
-            const auto spline = std::make_shared<meshkernel::Splines>(meshInstances[meshKernelId]->m_projection);
+            const auto spline = std::make_shared<meshkernel::Splines>(state->m_mesh->m_projection);
             SetSplines(geometryListIn, *spline);
 
             meshkernel::CurvilinearGridFromSplines curvilinearGridFromSplines(spline, curvilinearParameters, splinesToCurvilinearParameters);
 
             meshkernel::CurvilinearGrid curvilinearGrid;
             curvilinearGridFromSplines.Compute(curvilinearGrid);
-            *meshInstances[meshKernelId] += meshkernel::Mesh2D(curvilinearGrid, meshInstances[meshKernelId]->m_projection);
+            *state->m_mesh += meshkernel::Mesh2D(curvilinearGrid, state->m_mesh->m_projection);
         }
         catch (...)
         {
@@ -1212,19 +1434,17 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            auto spline = std::make_shared<meshkernel::Splines>(meshInstances[meshKernelId]->m_projection);
+            auto spline = std::make_shared<meshkernel::Splines>(state->m_mesh->m_projection);
             SetSplines(geometryList, *spline);
 
             auto curvilinearGridFromSplines = std::make_shared<meshkernel::CurvilinearGridFromSplines>(spline, curvilinearParameters, splinesToCurvilinearParameters);
 
-            curvilinearGridFromSplinesInstances.insert({meshKernelId, curvilinearGridFromSplines});
+            state->m_curvilinearGridFromSplines = curvilinearGridFromSplines;
 
-            curvilinearGridFromSplinesInstances[meshKernelId]->Initialize();
+            state->m_curvilinearGridFromSplines->Initialize();
         }
         catch (...)
         {
@@ -1238,12 +1458,10 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            curvilinearGridFromSplinesInstances[meshKernelId]->Iterate(layer);
+            state->m_curvilinearGridFromSplines->Iterate(layer);
         }
         catch (...)
         {
@@ -1257,15 +1475,13 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             meshkernel::CurvilinearGrid curvilinearGrid;
-            curvilinearGridFromSplinesInstances[meshKernelId]->ComputeCurvilinearGrid(curvilinearGrid);
+            state->m_curvilinearGridFromSplines->ComputeCurvilinearGrid(curvilinearGrid);
 
-            *meshInstances[meshKernelId] += meshkernel::Mesh2D(curvilinearGrid, meshInstances[meshKernelId]->m_projection);
+            *state->m_mesh += meshkernel::Mesh2D(curvilinearGrid, state->m_mesh->m_projection);
         }
         catch (...)
         {
@@ -1279,11 +1495,9 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            curvilinearGridFromSplinesInstances.erase(meshKernelId);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            state->m_curvilinearGridFromSplines.reset();
         }
         catch (...)
         {
@@ -1297,16 +1511,15 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
             auto polygonNodes = ConvertGeometryListToPointVector(polygon);
 
             auto points = ConvertGeometryListToPointVector(pointsNative);
-            const meshkernel::Polygons localPolygon(polygonNodes, meshInstances[meshKernelId]->m_projection);
+            const meshkernel::Polygons localPolygon(polygonNodes, state->m_mesh->m_projection);
 
-            for (auto i = 0; i < points.size(); i++)
+#pragma omp parallel for
+            for (int i = 0; i < static_cast<int>(points.size()); i++)
             {
                 selectedPointsNative.zCoordinates[i] = localPolygon.IsPointInPolygon(points[i], 0) ? 1.0 : 0.0;
             }
@@ -1325,22 +1538,22 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             //set landboundaries
             auto polygon = std::make_shared<meshkernel::Polygons>();
 
             std::vector<meshkernel::Point> landBoundary;
-            const auto landBoundaries = std::make_shared<meshkernel::LandBoundaries>(landBoundary, meshInstances[meshKernelId], polygon);
+            const auto landBoundaries = std::make_shared<meshkernel::LandBoundaries>(landBoundary, state->m_mesh, polygon);
 
             const bool triangulateFaces = isTriangulationRequired == 0 ? false : true;
             const bool projectToLandBoundary = projectToLandBoundaryRequired == 0 ? false : true;
-            const meshkernel::FlipEdges flipEdges(meshInstances[meshKernelId], landBoundaries, triangulateFaces, projectToLandBoundary);
+            const meshkernel::FlipEdges flipEdges(state->m_mesh, landBoundaries, triangulateFaces, projectToLandBoundary);
 
             flipEdges.Compute();
+
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -1356,13 +1569,11 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             // Use the default constructor, no instance present
-            const auto spline = std::make_shared<meshkernel::Splines>(meshInstances[meshKernelId]->m_projection);
+            const auto spline = std::make_shared<meshkernel::Splines>(state->m_mesh->m_projection);
             SetSplines(geometryListIn, *spline);
 
             // Create algorithm and set the splines
@@ -1373,7 +1584,9 @@ namespace meshkernelapi
             curvilinearGridFromSplinesTransfinite.Compute(curvilinearGrid);
 
             // Transform and set mesh pointer
-            *meshInstances[meshKernelId] += meshkernel::Mesh2D(curvilinearGrid, meshInstances[meshKernelId]->m_projection);
+            *state->m_mesh += meshkernel::Mesh2D(curvilinearGrid, state->m_mesh->m_projection);
+
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -1392,21 +1605,21 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             auto polygonPoints = ConvertGeometryListToPointVector(polygon);
 
-            const auto localPolygon = std::make_shared<meshkernel::Polygons>(polygonPoints, meshInstances[meshKernelId]->m_projection);
+            const auto localPolygon = std::make_shared<meshkernel::Polygons>(polygonPoints, state->m_mesh->m_projection);
 
             meshkernel::CurvilinearGrid curvilinearGrid;
             const meshkernel::CurvilinearGridFromPolygon curvilinearGridFromPolygon(localPolygon);
             curvilinearGridFromPolygon.Compute(firstNode, secondNode, thirdNode, useFourthSide, curvilinearGrid);
 
             // convert to curvilinear grid and add it to the current mesh
-            *meshInstances[meshKernelId] += meshkernel::Mesh2D(curvilinearGrid, meshInstances[meshKernelId]->m_projection);
+            *state->m_mesh += meshkernel::Mesh2D(curvilinearGrid, state->m_mesh->m_projection);
+
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -1424,21 +1637,21 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
             auto polygonPoints = ConvertGeometryListToPointVector(polygon);
 
-            const auto localPolygon = std::make_shared<meshkernel::Polygons>(polygonPoints, meshInstances[meshKernelId]->m_projection);
+            const auto localPolygon = std::make_shared<meshkernel::Polygons>(polygonPoints, state->m_mesh->m_projection);
 
             meshkernel::CurvilinearGrid curvilinearGrid;
             const meshkernel::CurvilinearGridFromPolygon curvilinearGridFromPolygon(localPolygon);
             curvilinearGridFromPolygon.Compute(firstNode, secondNode, thirdNode, curvilinearGrid);
 
             // convert to curvilinear grid and add it to the current mesh
-            *meshInstances[meshKernelId] += meshkernel::Mesh2D(curvilinearGrid, meshInstances[meshKernelId]->m_projection);
+            *state->m_mesh += meshkernel::Mesh2D(curvilinearGrid, state->m_mesh->m_projection);
+
+            RecordEndOfOperationMemoryUsage(*state);
         }
         catch (...)
         {
@@ -1452,12 +1665,10 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
-            const auto edgesCrossingSmallFlowEdges = meshInstances[meshKernelId]->GetEdgesCrossingSmallFlowEdges(smallFlowEdgesThreshold);
-            const auto smallFlowEdgeCenters = meshInstances[meshKernelId]->GetFlowEdgesCenters(edgesCrossingSmallFlowEdges);
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+            const auto edgesCrossingSmallFlowEdges = state->m_mesh->GetEdgesCrossingSmallFlowEdges(smallFlowEdgesThreshold);
+            const auto smallFlowEdgeCenters = state->m_mesh->GetFlowEdgesCenters(edgesCrossingSmallFlowEdges);
 
             numSmallFlowEdges = static_cast<int>(smallFlowEdgeCenters.size());
         }
@@ -1473,15 +1684,102 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+
+            const auto edgesCrossingSmallFlowEdges = state->m_mesh->GetEdgesCrossingSmallFlowEdges(smallFlowEdgesThreshold);
+            const auto smallFlowEdgeCenters = state->m_mesh->GetFlowEdgesCenters(edgesCrossingSmallFlowEdges);
+
+            ConvertPointVectorToGeometryList(smallFlowEdgeCenters, result);
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_get_quality_report(int meshKernelId, int numHistogramBins, const char*& qualityReport)
+    {
+        int exitCode = Success;
+        try
+        {
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
+
+            if (numHistogramBins <= 0)
             {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
+                throw std::invalid_argument("MeshKernel: The number of histogram bins must be positive.");
             }
 
-            const auto edgesCrossingSmallFlowEdges = meshInstances[meshKernelId]->GetEdgesCrossingSmallFlowEdges(smallFlowEdgesThreshold);
-            const auto smallFlowEdgeCenters = meshInstances[meshKernelId]->GetFlowEdgesCenters(edgesCrossingSmallFlowEdges);
+            AdministrateOutOfDateFaces(*state);
 
-            ConvertPointVectorToGeometryList(smallFlowEdgeCenters, result);
+            meshkernel::MeshQuality meshQuality(state->m_mesh, static_cast<size_t>(numHistogramBins));
+            meshQuality.Compute();
+
+            std::ostringstream report;
+            for (size_t m = 0; m < meshkernel::MeshQuality::NumMetrics; ++m)
+            {
+                const auto metric = static_cast<meshkernel::MeshQuality::Metric>(m);
+                const auto& statistics = meshQuality.GetStatistics(metric);
+                report << meshkernel::MeshQuality::GetMetricName(metric) << '\t' << statistics.m_numValues << '\t'
+                       << statistics.m_minimum << '\t' << statistics.m_maximum << '\t' << statistics.m_mean;
+                for (const auto& count : statistics.m_histogram)
+                {
+                    report << '\t' << count;
+                }
+                report << '\n';
+            }
+            report << "ObtuseTriangles" << '\t' << meshQuality.GetObtuseTriangles().size() << '\n';
+            meshQualityReport = report.str();
+            qualityReport = meshQualityReport.c_str();
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_get_memory_usage(int meshKernelId, const char*& memoryUsage)
+    {
+        int exitCode = Success;
+        try
+        {
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state, true);
+
+            const auto currentMemoryUsage = GetMemoryUsage(*state);
+            RecordEndOfOperationMemoryUsage(*state, currentMemoryUsage);
+
+            std::ostringstream report;
+            for (const auto& [subsystem, bytes] : currentMemoryUsage.GetSubsystems())
+            {
+                report << subsystem << '\t' << bytes << '\n';
+            }
+            report << "Total" << '\t' << currentMemoryUsage.GetTotal() << '\n';
+            report << "Largest sampled total" << '\t' << state->m_largestSampledMemoryUsage << '\n';
+            memoryUsageReport = report.str();
+            memoryUsage = memoryUsageReport.c_str();
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_shrink_mesh(int meshKernelId)
+    {
+        int exitCode = Success;
+        try
+        {
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+
+            state->m_mesh->Shrink();
+            state->m_nodeSelection = NodeSelection();
+            state->m_polygonOperation = PolygonOperation();
         }
         catch (...)
         {
@@ -1496,6 +1794,32 @@ namespace meshkernelapi
         return Success;
     }
 
+    MKERNEL_API int mkernel_get_timings(const char*& timings)
+    {
+        int exitCode = Success;
+        try
+        {
+            std::ostringstream report;
+            for (const auto& entry : meshkernel::Instrumentation::GetReport())
+            {
+                report << entry.m_name << '\t' << entry.m_count << '\t' << entry.m_totalSeconds << '\t' << entry.m_maxSeconds << '\n';
+            }
+            timingsReport = report.str();
+            timings = timingsReport.c_str();
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_reset_timings()
+    {
+        meshkernel::Instrumentation::Reset();
+        return Success;
+    }
+
     MKERNEL_API int mkernel_get_geometry_error(int& invalidIndex, int& type)
     {
         invalidIndex = meshGeometryError.m_invalidIndex;
@@ -1508,12 +1832,10 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            const auto obtuseTriangles = meshInstances[meshKernelId]->GetObtuseTrianglesCenters();
+            const auto obtuseTriangles = state->m_mesh->GetObtuseTrianglesCenters();
 
             numObtuseTriangles = static_cast<int>(obtuseTriangles.size());
         }
@@ -1529,12 +1851,10 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
-            {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
-            }
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
 
-            const auto obtuseTriangles = meshInstances[meshKernelId]->GetObtuseTrianglesCenters();
+            const auto obtuseTriangles = state->m_mesh->GetObtuseTrianglesCenters();
 
             ConvertPointVectorToGeometryList(obtuseTriangles, result);
         }
@@ -1550,13 +1870,171 @@ namespace meshkernelapi
         int exitCode = Success;
         try
         {
-            if (meshKernelId >= meshInstances.size())
+            const auto state = GetState(meshKernelId);
+            const StateLock lock(*state);
+
+            state->m_mesh->DeleteSmallFlowEdgesAndSmallTrianglesAtBoundaries(smallFlowEdgesThreshold, minFractionalAreaTriangles);
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_orthogonalize_async(int meshKernelId,
+                                                int projectToLandBoundaryOption,
+                                                const OrthogonalizationParameters& orthogonalizationParameters,
+                                                const GeometryList& geometryListPolygon,
+                                                const GeometryList& geometryListLandBoundaries,
+                                                int& jobId)
+    {
+        int exitCode = Success;
+        try
+        {
+            GetState(meshKernelId);
+
+            const auto polygon = std::make_shared<GeometryListBuffer>(geometryListPolygon);
+            const auto landBoundaries = std::make_shared<GeometryListBuffer>(geometryListLandBoundaries);
+            jobId = SubmitJob(meshKernelId, [=] {
+                return mkernel_orthogonalize(meshKernelId, projectToLandBoundaryOption, orthogonalizationParameters, polygon->m_geometryList, landBoundaries->m_geometryList);
+            });
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_refine_mesh_based_on_samples_async(int meshKernelId,
+                                                               const GeometryList& geometryList,
+                                                               const InterpolationParameters& interpolationParameters,
+                                                               const SampleRefineParameters& sampleRefineParameters,
+                                                               int& jobId)
+    {
+        int exitCode = Success;
+        try
+        {
+            GetState(meshKernelId);
+
+            const auto samples = std::make_shared<GeometryListBuffer>(geometryList);
+            jobId = SubmitJob(meshKernelId, [=] {
+                return mkernel_refine_mesh_based_on_samples(meshKernelId, samples->m_geometryList, interpolationParameters, sampleRefineParameters);
+            });
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_flip_edges_async(int meshKernelId, int isTriangulationRequired, int projectToLandBoundaryOption, int& jobId)
+    {
+        int exitCode = Success;
+        try
+        {
+            GetState(meshKernelId);
+
+            jobId = SubmitJob(meshKernelId, [=] {
+                return mkernel_flip_edges(meshKernelId, isTriangulationRequired, projectToLandBoundaryOption);
+            });
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_curvilinear_mesh_from_splines_async(int meshKernelId,
+                                                                const GeometryList& geometryListIn,
+                                                                const CurvilinearParameters& curvilinearParameters,
+                                                                int& jobId)
+    {
+        int exitCode = Success;
+        try
+        {
+            GetState(meshKernelId);
+
+            const auto splines = std::make_shared<GeometryListBuffer>(geometryListIn);
+            jobId = SubmitJob(meshKernelId, [=] {
+                return mkernel_curvilinear_mesh_from_splines(meshKernelId, splines->m_geometryList, curvilinearParameters);
+            });
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_get_job_status(int jobId, int& status)
+    {
+        int exitCode = Success;
+        try
+        {
+            status = static_cast<int>(GetJobPool().GetStatus(jobId));
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_get_job_progress(int jobId, double& progress)
+    {
+        int exitCode = Success;
+        try
+        {
+            progress = GetJobPool().GetProgress(jobId);
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_cancel_job(int jobId)
+    {
+        int exitCode = Success;
+        try
+        {
+            if (!GetJobPool().Cancel(jobId))
             {
-                throw std::invalid_argument("MeshKernel: The selected mesh does not exist.");
+                throw std::invalid_argument("MeshKernel: The selected job has already finished.");
+            }
+        }
+        catch (...)
+        {
+            exitCode = HandleExceptions(std::current_exception());
+        }
+        return exitCode;
+    }
+
+    MKERNEL_API int mkernel_wait_job(int jobId, int& jobExitCode)
+    {
+        int exitCode = Success;
+        try
+        {
+            JobPool::Status status;
+            auto result = GetJobPool().Wait(jobId, status);
+            if (status == JobPool::Status::Cancelled)
+            {
+                result.m_exitCode = Exception;
+                result.m_errorMessage = "MeshKernel: The selected job was cancelled.";
             }
 
-            meshInstances[meshKernelId]->DeleteSmallFlowEdges(smallFlowEdgesThreshold);
-            meshInstances[meshKernelId]->DeleteSmallTrianglesAtBoundaries(minFractionalAreaTriangles);
+            // make the error of the job available to the caller
+            jobExitCode = result.m_exitCode;
+            if (jobExitCode != Success)
+            {
+                strcpy_s(exceptionMessage, sizeof exceptionMessage, result.m_errorMessage.c_str());
+                meshGeometryError = result.m_geometryError;
+            }
         }
         catch (...)
         {
@@ -1606,9 +2084,9 @@ namespace meshkernelapi
             }
 
             // Set the mesh
-            const auto edges = meshkernel::ConvertToEdgeNodesVector(meshGeometryDimensions.numedge, meshGeometry.edge_nodes);
-            const auto nodes = meshkernel::ConvertToNodesVector(meshGeometryDimensions.numnode, meshGeometry.nodex, meshGeometry.nodey);
-            const auto mesh = std::make_shared<meshkernel::Mesh2D>(edges, nodes, projection);
+            const auto mesh = std::make_shared<meshkernel::Mesh2D>(meshkernel::ConvertToEdgeNodesVector(meshGeometryDimensions.numedge, meshGeometry.edge_nodes),
+                                                                   meshkernel::ConvertToNodeCoordinates(meshGeometryDimensions.numnode, meshGeometry.nodex, meshGeometry.nodey),
+                                                                   projection);
 
             // Build the samples
             std::vector<meshkernel::Sample> samples(numSamples);
@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <chrono>
 #include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <MeshKernelApi/GeometryList.hpp>
 #include <MeshKernelApi/MakeMeshParameters.hpp>
@@ -32,6 +37,31 @@ public:
         DeleteRectangularMeshForApiTesting(std::get<0>(meshData));
     }
 
+    static meshkernelapi::GeometryList MakeGeometryList(std::vector<double>& xCoordinates,
+                                                        std::vector<double>& yCoordinates,
+                                                        std::vector<double>& zCoordinates)
+    {
+        // The geometry list refers to the coordinates, which must outlive it
+        meshkernelapi::GeometryList geometryList;
+        geometryList.geometrySeparator = meshkernel::doubleMissingValue;
+        geometryList.xCoordinates = xCoordinates.data();
+        geometryList.yCoordinates = yCoordinates.data();
+        geometryList.zCoordinates = zCoordinates.data();
+        geometryList.numberOfCoordinates = static_cast<int>(xCoordinates.size());
+        return geometryList;
+    }
+
+    static size_t GetInstrumentationCount(const std::string& name)
+    {
+        // The counters are recorded only if the library is built with instrumentation
+        const char* timings;
+        const auto errorCode = meshkernelapi::mkernel_get_timings(timings);
+        EXPECT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+        const std::string report(timings);
+        const auto position = report.find(name + '\t');
+        return position == std::string::npos ? 0 : std::stoul(report.substr(position + name.size() + 1));
+    }
+
 protected:
     void TearDown() override
     {
@@ -81,6 +111,337 @@ TEST_F(ApiTests, FlipEdgesThroughApi)
     ASSERT_EQ(23, meshGeometryDimensions.numedge);
 }
 
+TEST_F(ApiTests, FlipEdgesAsynchronouslyThroughApi)
+{
+    // Prepare
+    MakeMesh();
+
+    // Execute
+    const int isTriangulationRequired = 1;
+    const int projectToLandBoundaryOption = 1;
+    int jobId;
+    auto errorCode = meshkernelapi::mkernel_flip_edges_async(0, isTriangulationRequired, projectToLandBoundaryOption, jobId);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    int jobExitCode;
+    errorCode = meshkernelapi::mkernel_wait_job(jobId, jobExitCode);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, jobExitCode);
+
+    meshkernelapi::MeshGeometryDimensions meshGeometryDimensions{};
+    meshkernelapi::MeshGeometry meshGeometry{};
+    errorCode = mkernel_get_mesh(0, meshGeometryDimensions, meshGeometry);
+
+    // Assert
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(12, meshGeometryDimensions.numnode);
+    ASSERT_EQ(23, meshGeometryDimensions.numedge);
+
+    // The job is released after waiting
+    int status;
+    errorCode = meshkernelapi::mkernel_get_job_status(jobId, status);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Exception, errorCode);
+}
+
+TEST_F(ApiTests, CancelARunningOrthogonalizationThroughApi)
+{
+    // Prepare: enough iterations to keep the orthogonalization running until it is cancelled
+    MakeMesh(30, 30, 1.0);
+
+    meshkernelapi::OrthogonalizationParameters orthogonalizationParameters{};
+    orthogonalizationParameters.OuterIterations = 1000;
+    orthogonalizationParameters.BoundaryIterations = 25;
+    orthogonalizationParameters.InnerIterations = 25;
+    orthogonalizationParameters.OrthogonalizationToSmoothingFactor = 0.975;
+
+    meshkernelapi::GeometryList geometryList{};
+    meshkernelapi::GeometryList landBoundaries{};
+
+    int jobId;
+    auto errorCode = meshkernelapi::mkernel_orthogonalize_async(0, 0, orthogonalizationParameters, geometryList, landBoundaries, jobId);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    // Execute: cancel the job once it reports progress
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    double runningProgress = 0.0;
+    while (runningProgress <= 0.0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        errorCode = meshkernelapi::mkernel_get_job_progress(jobId, runningProgress);
+        ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    }
+    ASSERT_GT(runningProgress, 0.0);
+    ASSERT_LT(runningProgress, 1.0);
+
+    errorCode = meshkernelapi::mkernel_cancel_job(jobId);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    int status = 1;
+    while (status == 1 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        errorCode = meshkernelapi::mkernel_get_job_status(jobId, status);
+        ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    }
+
+    // Assert: the job stopped before completing, with the progress it reported while running
+    ASSERT_EQ(3, status);
+    double cancelledProgress;
+    errorCode = meshkernelapi::mkernel_get_job_progress(jobId, cancelledProgress);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_GE(cancelledProgress, runningProgress);
+    ASSERT_LT(cancelledProgress, 1.0);
+
+    int jobExitCode;
+    errorCode = meshkernelapi::mkernel_wait_job(jobId, jobExitCode);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Exception, jobExitCode);
+}
+
+TEST_F(ApiTests, GetMemoryUsageAndShrinkMeshThroughApi)
+{
+    // Prepare
+    MakeMesh();
+    meshkernelapi::MeshGeometryDimensions meshGeometryDimensions{};
+    meshkernelapi::MeshGeometry meshGeometry{};
+    auto errorCode = mkernel_get_mesh(0, meshGeometryDimensions, meshGeometry);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    // Execute
+    const char* memoryUsage;
+    errorCode = meshkernelapi::mkernel_get_memory_usage(0, memoryUsage);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    const std::string report(memoryUsage);
+
+    errorCode = meshkernelapi::mkernel_shrink_mesh(0);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    // Assert
+    ASSERT_NE(std::string::npos, report.find("Mesh nodes\t"));
+    ASSERT_NE(std::string::npos, report.find("Mesh flat copies\t"));
+    ASSERT_NE(std::string::npos, report.find("Total\t"));
+    ASSERT_NE(std::string::npos, report.find("Largest sampled total\t"));
+
+    // The flat copies are rebuilt on demand
+    errorCode = mkernel_get_mesh(0, meshGeometryDimensions, meshGeometry);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(12, meshGeometryDimensions.numnode);
+}
+
+TEST_F(ApiTests, SetStateCopiesTheNodeCoordinatesIntoTheMesh)
+{
+    // Prepare
+    int meshKernelId;
+    AllocateNewMesh(meshKernelId);
+    auto meshData = MakeRectangularMeshForApiTesting(4, 3, 1.0);
+    auto& clientGeometry = std::get<0>(meshData);
+    const auto& clientDimensions = std::get<1>(meshData);
+
+    // Execute
+    auto errorCode = mkernel_set_state(meshKernelId, clientDimensions, clientGeometry, false);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    meshkernelapi::MeshGeometryDimensions meshGeometryDimensions{};
+    meshkernelapi::MeshGeometry meshGeometry{};
+    errorCode = mkernel_get_mesh(meshKernelId, meshGeometryDimensions, meshGeometry);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    // Assert: the mesh exposes its own coordinate arrays, holding the client coordinates
+    ASSERT_EQ(clientDimensions.numnode, meshGeometryDimensions.numnode);
+    ASSERT_NE(clientGeometry.nodex, meshGeometry.nodex);
+    ASSERT_NE(clientGeometry.nodey, meshGeometry.nodey);
+    for (auto n = 0; n < meshGeometryDimensions.numnode; ++n)
+    {
+        ASSERT_EQ(clientGeometry.nodex[n], meshGeometry.nodex[n]);
+        ASSERT_EQ(clientGeometry.nodey[n], meshGeometry.nodey[n]);
+    }
+
+    // the client buffers are not retained
+    clientGeometry.nodex[0] = 123.0;
+    DeleteRectangularMeshForApiTesting(clientGeometry);
+    errorCode = mkernel_get_mesh(meshKernelId, meshGeometryDimensions, meshGeometry);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(0.0, meshGeometry.nodex[0]);
+}
+
+TEST_F(ApiTests, GetMeshTwiceReusesTheFlatCopiesUntilTheMeshIsModified)
+{
+    // Prepare
+    MakeMesh();
+    meshkernelapi::MeshGeometryDimensions meshGeometryDimensions{};
+    meshkernelapi::MeshGeometry meshGeometry{};
+    auto errorCode = mkernel_get_mesh(0, meshGeometryDimensions, meshGeometry);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    const auto firstNodex = meshGeometry.nodex;
+    const auto firstEdgeNodes = meshGeometry.edge_nodes;
+
+    // the flat copies are not refreshed while the mesh is unmodified, a marker in the buffer survives the second call
+    meshGeometry.edge_nodes[0] = 123;
+
+    // the quality inquiries only read the mesh
+    const char* qualityReport;
+    errorCode = meshkernelapi::mkernel_get_quality_report(0, 4, qualityReport);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    std::vector<double> xCoordinates(meshGeometryDimensions.numedge, 0.0);
+    std::vector<double> yCoordinates(meshGeometryDimensions.numedge, 0.0);
+    std::vector<double> zCoordinates(meshGeometryDimensions.numedge, 0.0);
+    auto geometryList = MakeGeometryList(xCoordinates, yCoordinates, zCoordinates);
+    errorCode = meshkernelapi::mkernel_get_orthogonality(0, geometryList);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    errorCode = meshkernelapi::mkernel_get_smoothness(0, geometryList);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    // Execute
+    errorCode = mkernel_get_mesh(0, meshGeometryDimensions, meshGeometry);
+
+    // Assert
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(firstNodex, meshGeometry.nodex);
+    ASSERT_EQ(firstEdgeNodes, meshGeometry.edge_nodes);
+    ASSERT_EQ(123, meshGeometry.edge_nodes[0]);
+
+    // a modification refreshes the flat copies
+    errorCode = meshkernelapi::mkernel_delete_node(0, 1);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    errorCode = mkernel_get_mesh(0, meshGeometryDimensions, meshGeometry);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(11, meshGeometryDimensions.numnode);
+    ASSERT_NE(123, meshGeometry.edge_nodes[0]);
+}
+
+TEST_F(ApiTests, GetQualityReportThroughApi)
+{
+    // Prepare
+    MakeMesh();
+
+    // Execute
+    const char* qualityReport;
+    auto errorCode = meshkernelapi::mkernel_get_quality_report(0, 4, qualityReport);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    const std::string report(qualityReport);
+
+    // Assert
+    ASSERT_NE(std::string::npos, report.find("Orthogonality\t"));
+    ASSERT_NE(std::string::npos, report.find("Smoothness\t"));
+    ASSERT_NE(std::string::npos, report.find("AspectRatio\t"));
+    ASSERT_NE(std::string::npos, report.find("FlowEdgeLengthRatio\t"));
+    ASSERT_NE(std::string::npos, report.find("ObtuseTriangles\t0\n"));
+
+    errorCode = meshkernelapi::mkernel_get_quality_report(0, 0, qualityReport);
+    ASSERT_NE(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+}
+
+TEST_F(ApiTests, GetQualityReportAfterInsertingAnEdgeThroughApi)
+{
+    // Prepare: the inserted diagonal leaves the faces out of date
+    MakeMesh();
+    int newEdgeIndex;
+    auto errorCode = meshkernelapi::mkernel_insert_edge(0, 0, 4, newEdgeIndex);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    // Execute
+    const char* qualityReport;
+    errorCode = meshkernelapi::mkernel_get_quality_report(0, 4, qualityReport);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    const std::string report(qualityReport);
+
+    // Assert: the diagonal splits a quad in two triangles, it is an internal edge of the administrated faces
+    ASSERT_NE(std::string::npos, report.find("Smoothness\t8\t"));
+    ASSERT_NE(std::string::npos, report.find("FlowEdgeLengthRatio\t8\t"));
+    ASSERT_NE(std::string::npos, report.find("AspectRatio\t18\t"));
+    ASSERT_NE(std::string::npos, report.find("ObtuseTriangles\t0\n"));
+
+    meshkernelapi::MeshGeometryDimensions meshGeometryDimensions{};
+    meshkernelapi::MeshGeometry meshGeometry{};
+    errorCode = mkernel_find_faces(0, meshGeometryDimensions, meshGeometry);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(7, meshGeometryDimensions.numface);
+}
+
+TEST_F(ApiTests, CountAndGetNodesInPolygonsThroughApi)
+{
+    // Prepare: the polygon contains the nodes of the first two columns
+    MakeMesh();
+    meshkernelapi::mkernel_reset_timings();
+    std::vector<double> xCoordinates{-0.5, 1.5, 1.5, -0.5, -0.5};
+    std::vector<double> yCoordinates{-0.5, -0.5, 2.5, 2.5, -0.5};
+    std::vector<double> zCoordinates(xCoordinates.size(), 0.0);
+    const auto geometryListIn = MakeGeometryList(xCoordinates, yCoordinates, zCoordinates);
+
+    // Execute
+    int numberOfMeshNodes;
+    auto errorCode = meshkernelapi::mkernel_count_nodes_in_polygons(0, geometryListIn, 1, numberOfMeshNodes);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(6, numberOfMeshNodes);
+
+    std::vector<int> selectedNodes(numberOfMeshNodes);
+    auto selectedNodesData = selectedNodes.data();
+    errorCode = meshkernelapi::mkernel_nodes_in_polygons(0, geometryListIn, 1, &selectedNodesData);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    // Assert, the get call reuses the selection of the count call
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5}), selectedNodes);
+#if defined(MESHKERNEL_INSTRUMENTATION)
+    ASSERT_EQ(1, GetInstrumentationCount("Node selection reuses"));
+#endif
+
+    // Execute, the nodes outside are selected without a preceding count
+    errorCode = meshkernelapi::mkernel_nodes_in_polygons(0, geometryListIn, 0, &selectedNodesData);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ((std::vector<int>{6, 7, 8, 9, 10, 11}), selectedNodes);
+
+    // Execute, the selection is recomputed after the mesh is modified
+    errorCode = meshkernelapi::mkernel_delete_node(0, 0);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    errorCode = meshkernelapi::mkernel_count_nodes_in_polygons(0, geometryListIn, 1, numberOfMeshNodes);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(5, numberOfMeshNodes);
+#if defined(MESHKERNEL_INSTRUMENTATION)
+    ASSERT_EQ(1, GetInstrumentationCount("Node selection reuses"));
+#endif
+}
+
+TEST_F(ApiTests, CountAndGetOffsettedPolygonThroughApi)
+{
+    // Prepare
+    MakeMesh();
+    meshkernelapi::mkernel_reset_timings();
+    std::vector<double> xCoordinates{0.0, 3.0, 3.0, 0.0, 0.0};
+    std::vector<double> yCoordinates{0.0, 0.0, 3.0, 3.0, 0.0};
+    std::vector<double> zCoordinates(xCoordinates.size(), 0.0);
+    auto geometryListIn = MakeGeometryList(xCoordinates, yCoordinates, zCoordinates);
+
+    // Execute, a refinement of the same polygon is not taken for the offset
+    int numberOfPolygonNodes;
+    auto errorCode = meshkernelapi::mkernel_refine_polygon_count(0, geometryListIn, 0, 2, 1.0, numberOfPolygonNodes);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(9, numberOfPolygonNodes);
+
+    errorCode = meshkernelapi::mkernel_offsetted_polygon_count(0, geometryListIn, false, 1.0, numberOfPolygonNodes);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+    ASSERT_EQ(5, numberOfPolygonNodes);
+
+    std::vector<double> xCoordinatesOut(numberOfPolygonNodes);
+    std::vector<double> yCoordinatesOut(numberOfPolygonNodes);
+    std::vector<double> zCoordinatesOut(numberOfPolygonNodes);
+    auto geometryListOut = MakeGeometryList(xCoordinatesOut, yCoordinatesOut, zCoordinatesOut);
+    errorCode = meshkernelapi::mkernel_offsetted_polygon(0, geometryListIn, false, 1.0, geometryListOut);
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCode);
+
+    // Assert, the offset polygon of the count call is reused
+#if defined(MESHKERNEL_INSTRUMENTATION)
+    ASSERT_EQ(1, GetInstrumentationCount("Polygon operation reuses"));
+#endif
+
+    // Assert, the square is enlarged by one. The first and the last nodes are offset along the normal of their single edge
+    const double tolerance = 1e-9;
+    ASSERT_NEAR(0.0, xCoordinatesOut[0], tolerance);
+    ASSERT_NEAR(-1.0, yCoordinatesOut[0], tolerance);
+    ASSERT_NEAR(4.0, xCoordinatesOut[2], tolerance);
+    ASSERT_NEAR(4.0, yCoordinatesOut[2], tolerance);
+    ASSERT_NEAR(-1.0, xCoordinatesOut[4], tolerance);
+    ASSERT_NEAR(0.0, yCoordinatesOut[4], tolerance);
+}
+
 TEST_F(ApiTests, InsertEdgeThroughApi)
 {
     // Prepare
@@ -1024,3 +1385,46 @@ TEST(ApiStatelessTests, OrthogonalizingAnInvaliMeshShouldThrowAMeshGeometryError
     ASSERT_EQ(static_cast<int>(meshkernel::MeshLocations::Nodes), type);
     ASSERT_EQ(478, invalidIndex);
 }
+
+TEST(ApiStatelessTests, ConcurrentCallsOnDifferentMeshesShouldNotInterfere)
+{
+    const int numThreads = 4;
+    std::vector<int> meshKernelIds(numThreads, -1);
+    std::vector<int> numNodes(numThreads, 0);
+    std::vector<int> errorCodes(numThreads, meshkernelapi::MeshKernelApiErrors::Success);
+
+    // Execute
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            auto& errorCode = errorCodes[t];
+            errorCode = meshkernelapi::mkernel_new_mesh(meshKernelIds[t]);
+
+            auto meshData = MakeRectangularMeshForApiTesting(10 + t, 10, 1.0);
+            errorCode = std::max(errorCode, mkernel_set_state(meshKernelIds[t], std::get<1>(meshData), std::get<0>(meshData), false));
+            DeleteRectangularMeshForApiTesting(std::get<0>(meshData));
+
+            meshkernelapi::MeshGeometryDimensions meshGeometryDimensions{};
+            meshkernelapi::MeshGeometry meshGeometry{};
+            errorCode = std::max(errorCode, meshkernelapi::mkernel_get_mesh(meshKernelIds[t], meshGeometryDimensions, meshGeometry));
+            numNodes[t] = meshGeometryDimensions.numnode;
+
+            errorCode = std::max(errorCode, meshkernelapi::mkernel_deallocate_state(meshKernelIds[t]));
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Assert
+    for (auto t = 0; t < numThreads; ++t)
+    {
+        ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Success, errorCodes[t]);
+        ASSERT_EQ((10 + t) * 10, numNodes[t]);
+    }
+
+    // The instances are gone
+    ASSERT_EQ(meshkernelapi::MeshKernelApiErrors::Exception, meshkernelapi::mkernel_deallocate_state(meshKernelIds[0]));
+}
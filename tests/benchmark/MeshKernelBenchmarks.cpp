@@ -0,0 +1,374 @@
+#include <benchmark/benchmark.h>
+
+#include <MeshKernel/AveragingInterpolation.hpp>
+#include <MeshKernel/Constants.hpp>
+#include <MeshKernel/Contacts.hpp>
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/FlipEdges.hpp>
+#include <MeshKernel/LandBoundaries.hpp>
+#include <MeshKernel/Mesh1D.hpp>
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/MeshRefinement.hpp>
+#include <MeshKernel/OrthogonalizationAndSmoothing.hpp>
+#include <MeshKernel/Orthogonalizer.hpp>
+#include <MeshKernel/Polygons.hpp>
+#include <MeshKernel/RTree.hpp>
+#include <MeshKernel/Smoother.hpp>
+#include <MeshKernel/TriangulationInterpolation.hpp>
+#include <MeshKernelApi/InterpolationParameters.hpp>
+#include <MeshKernelApi/OrthogonalizationParameters.hpp>
+#include <MeshKernelApi/SampleRefineParameters.hpp>
+#include <TestUtils/MakeMeshes.hpp>
+
+// The mesh scales are expressed as the number of nodes in one direction of a square mesh:
+// 100 -> 10k nodes, 316 -> 100k nodes, 1000 -> 1M nodes, 3162 -> 10M nodes.
+// Expensive algorithms are limited to the smaller scales, use --benchmark_filter to select a subset.
+
+namespace
+{
+    constexpr double meshDelta = 10.0;
+
+    /// @brief Generates the nodes and edges of a square mesh without building the mesh administration
+    void MakeSquareMeshNodesAndEdges(int n, std::vector<meshkernel::Point>& nodes, std::vector<meshkernel::Edge>& edges)
+    {
+        nodes.resize(n * n);
+        edges.resize(2 * (n - 1) * n);
+
+        size_t nodeIndex = 0;
+        for (auto i = 0; i < n; ++i)
+        {
+            for (auto j = 0; j < n; ++j)
+            {
+                nodes[nodeIndex] = {i * meshDelta, j * meshDelta};
+                nodeIndex++;
+            }
+        }
+
+        size_t edgeIndex = 0;
+        for (auto i = 0; i < n - 1; ++i)
+        {
+            for (auto j = 0; j < n; ++j)
+            {
+                edges[edgeIndex] = {i * n + j, (i + 1) * n + j};
+                edgeIndex++;
+            }
+        }
+        for (auto i = 0; i < n; ++i)
+        {
+            for (auto j = 0; j < n - 1; ++j)
+            {
+                edges[edgeIndex] = {i * n + j + 1, i * n + j};
+                edgeIndex++;
+            }
+        }
+    }
+
+    /// @brief Generates one sample per mesh node, slightly displaced, with a smoothly varying value
+    std::vector<meshkernel::Sample> MakeSamples(int n)
+    {
+        std::vector<meshkernel::Sample> samples(n * n);
+        size_t sampleIndex = 0;
+        for (auto i = 0; i < n; ++i)
+        {
+            for (auto j = 0; j < n; ++j)
+            {
+                const double x = (i + 0.25) * meshDelta;
+                const double y = (j + 0.25) * meshDelta;
+                samples[sampleIndex] = {x, y, std::sin(x * 0.01) + std::cos(y * 0.01)};
+                sampleIndex++;
+            }
+        }
+        return samples;
+    }
+
+    /// @brief Sets the number of processed items and a readable label
+    void SetCounters(benchmark::State& state, size_t numItems)
+    {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numItems));
+        state.counters["nodes"] = static_cast<double>(state.range(0) * state.range(0));
+    }
+} // namespace
+
+static void BM_Mesh2DAdministrate(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    std::vector<meshkernel::Point> nodes;
+    std::vector<meshkernel::Edge> edges;
+    MakeSquareMeshNodesAndEdges(n, nodes, edges);
+
+    for (auto _ : state)
+    {
+        meshkernel::Mesh2D mesh(edges, nodes, meshkernel::Projection::cartesian);
+        benchmark::DoNotOptimize(mesh.GetNumFaces());
+    }
+    SetCounters(state, nodes.size());
+}
+BENCHMARK(BM_Mesh2DAdministrate)->Arg(100)->Arg(316)->Arg(1000)->Arg(3162)->Unit(benchmark::kMillisecond);
+
+static void BM_Mesh2DReadministrate(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    const auto mesh = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+
+    for (auto _ : state)
+    {
+        mesh->Administrate(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+        benchmark::DoNotOptimize(mesh->GetNumFaces());
+    }
+    SetCounters(state, mesh->GetNumNodes());
+}
+BENCHMARK(BM_Mesh2DReadministrate)->Arg(100)->Arg(316)->Arg(1000)->Arg(3162)->Unit(benchmark::kMillisecond);
+
+static void BM_Mesh2DFromCurvilinearGrid(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    meshkernelapi::MakeMeshParameters makeMeshParameters{};
+    makeMeshParameters.GridType = 0;
+    makeMeshParameters.NumberOfColumns = n - 1;
+    makeMeshParameters.NumberOfRows = n - 1;
+    makeMeshParameters.GridAngle = 0.0;
+    makeMeshParameters.GridBlockSize = 0.0;
+    makeMeshParameters.OriginXCoordinate = 0.0;
+    makeMeshParameters.OriginYCoordinate = 0.0;
+    makeMeshParameters.OriginZCoordinate = 0.0;
+    makeMeshParameters.XGridBlockSize = meshDelta;
+    makeMeshParameters.YGridBlockSize = meshDelta;
+
+    const meshkernel::Polygons polygons;
+    for (auto _ : state)
+    {
+        meshkernel::Mesh2D mesh;
+        mesh.MakeMesh(makeMeshParameters, polygons);
+        benchmark::DoNotOptimize(mesh.GetNumFaces());
+    }
+    SetCounters(state, static_cast<size_t>(n) * n);
+}
+BENCHMARK(BM_Mesh2DFromCurvilinearGrid)->Arg(100)->Arg(316)->Arg(1000)->Arg(3162)->Unit(benchmark::kMillisecond);
+
+static void BM_ComputeEdgesLengthsAndCenters(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    const auto mesh = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+
+    for (auto _ : state)
+    {
+        mesh->ComputeEdgesLengths();
+        mesh->ComputeEdgesCenters();
+        benchmark::DoNotOptimize(mesh->m_edgeLengths.data());
+        benchmark::DoNotOptimize(mesh->m_edgesCenters.data());
+    }
+    SetCounters(state, mesh->GetNumEdges());
+}
+BENCHMARK(BM_ComputeEdgesLengthsAndCenters)->Arg(100)->Arg(316)->Arg(1000)->Arg(3162)->Unit(benchmark::kMillisecond);
+
+static void BM_RTreeBuildAndSearch(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    std::vector<meshkernel::Point> nodes;
+    std::vector<meshkernel::Edge> edges;
+    MakeSquareMeshNodesAndEdges(n, nodes, edges);
+
+    for (auto _ : state)
+    {
+        meshkernel::RTree rtree;
+        rtree.BuildTree(nodes);
+        for (const auto& node : nodes)
+        {
+            rtree.NearestNeighborsOnSquaredDistance(node, 1e-8);
+            benchmark::DoNotOptimize(rtree.GetQueryResultSize());
+        }
+    }
+    SetCounters(state, nodes.size());
+}
+BENCHMARK(BM_RTreeBuildAndSearch)->Arg(100)->Arg(316)->Arg(1000)->Arg(3162)->Unit(benchmark::kMillisecond);
+
+static void BM_Orthogonalization(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+
+    meshkernelapi::OrthogonalizationParameters orthogonalizationParameters{};
+    orthogonalizationParameters.OuterIterations = 1;
+    orthogonalizationParameters.BoundaryIterations = 1;
+    orthogonalizationParameters.InnerIterations = 1;
+    orthogonalizationParameters.OrthogonalizationToSmoothingFactor = 0.975;
+    orthogonalizationParameters.OrthogonalizationToSmoothingFactorBoundary = 1.0;
+    orthogonalizationParameters.SmoothAngleOrSmoothArea = 1.0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto mesh = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+        auto orthogonalizer = std::make_shared<meshkernel::Orthogonalizer>(mesh);
+        auto smoother = std::make_shared<meshkernel::Smoother>(mesh);
+        auto polygon = std::make_shared<meshkernel::Polygons>();
+        std::vector<meshkernel::Point> landBoundary{};
+        auto landBoundaries = std::make_shared<meshkernel::LandBoundaries>(landBoundary, mesh, polygon);
+        meshkernel::OrthogonalizationAndSmoothing orthogonalization(mesh,
+                                                                    smoother,
+                                                                    orthogonalizer,
+                                                                    polygon,
+                                                                    landBoundaries,
+                                                                    meshkernel::LandBoundaries::ProjectToLandBoundaryOption::DoNotProjectToLandBoundary,
+                                                                    orthogonalizationParameters);
+        state.ResumeTiming();
+
+        orthogonalization.Initialize();
+        orthogonalization.Compute();
+        benchmark::DoNotOptimize(mesh->m_nodes.GetXData());
+    }
+    SetCounters(state, static_cast<size_t>(n) * n);
+}
+BENCHMARK(BM_Orthogonalization)->Arg(100)->Arg(316)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_MeshRefinementInPolygon(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+
+    meshkernelapi::InterpolationParameters interpolationParameters{};
+    interpolationParameters.MaxNumberOfRefinementIterations = 1;
+    interpolationParameters.RefineIntersected = 0;
+    interpolationParameters.UseMassCenterWhenRefining = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto mesh = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+        const meshkernel::Polygons polygon;
+        meshkernel::MeshRefinement meshRefinement(mesh, polygon, interpolationParameters);
+        state.ResumeTiming();
+
+        meshRefinement.Compute();
+        benchmark::DoNotOptimize(mesh->GetNumNodes());
+    }
+    SetCounters(state, static_cast<size_t>(n) * n);
+}
+BENCHMARK(BM_MeshRefinementInPolygon)->Arg(100)->Arg(316)->Unit(benchmark::kMillisecond);
+
+static void BM_MeshRefinementBasedOnSamples(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    auto samples = MakeSamples(n);
+
+    meshkernelapi::SampleRefineParameters sampleRefineParameters{};
+    sampleRefineParameters.MaximumTimeStepInCourantGrid = 0.01;
+    sampleRefineParameters.MinimumCellSize = meshDelta * 0.5;
+    sampleRefineParameters.AccountForSamplesOutside = 0;
+    sampleRefineParameters.ConnectHangingNodes = 1;
+    sampleRefineParameters.RefinementType = 2;
+
+    meshkernelapi::InterpolationParameters interpolationParameters{};
+    interpolationParameters.MaxNumberOfRefinementIterations = 1;
+    interpolationParameters.RefineIntersected = 0;
+    interpolationParameters.UseMassCenterWhenRefining = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto mesh = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+        const auto averaging = std::make_shared<meshkernel::AveragingInterpolation>(mesh,
+                                                                                    samples,
+                                                                                    meshkernel::AveragingInterpolation::Method::MinAbsValue,
+                                                                                    meshkernel::MeshLocations::Faces,
+                                                                                    1.01,
+                                                                                    false,
+                                                                                    false);
+        meshkernel::MeshRefinement meshRefinement(mesh, averaging, sampleRefineParameters, interpolationParameters);
+        state.ResumeTiming();
+
+        meshRefinement.Compute();
+        benchmark::DoNotOptimize(mesh->GetNumNodes());
+    }
+    SetCounters(state, static_cast<size_t>(n) * n);
+}
+BENCHMARK(BM_MeshRefinementBasedOnSamples)->Arg(100)->Arg(316)->Unit(benchmark::kMillisecond);
+
+static void BM_FlipEdges(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto mesh = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+        auto polygon = std::make_shared<meshkernel::Polygons>();
+        std::vector<meshkernel::Point> landBoundary{};
+        auto landBoundaries = std::make_shared<meshkernel::LandBoundaries>(landBoundary, mesh, polygon);
+        meshkernel::FlipEdges flipEdges(mesh, landBoundaries, true, false);
+        state.ResumeTiming();
+
+        flipEdges.Compute();
+        benchmark::DoNotOptimize(mesh->GetNumEdges());
+    }
+    SetCounters(state, static_cast<size_t>(n) * n);
+}
+BENCHMARK(BM_FlipEdges)->Arg(100)->Arg(316)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_AveragingInterpolation(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    const auto mesh = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+    auto samples = MakeSamples(n);
+
+    for (auto _ : state)
+    {
+        meshkernel::AveragingInterpolation averaging(mesh,
+                                                     samples,
+                                                     meshkernel::AveragingInterpolation::Method::SimpleAveraging,
+                                                     meshkernel::MeshLocations::Nodes,
+                                                     1.01,
+                                                     false,
+                                                     false);
+        averaging.Compute();
+        benchmark::DoNotOptimize(averaging.GetResults().data());
+    }
+    SetCounters(state, static_cast<size_t>(n) * n);
+}
+BENCHMARK(BM_AveragingInterpolation)->Arg(100)->Arg(316)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_TriangulationInterpolation(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    const auto mesh = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+    const auto samples = MakeSamples(n);
+
+    const auto nodes = mesh->m_nodes.ToPoints();
+    for (auto _ : state)
+    {
+        meshkernel::TriangulationInterpolation triangulationInterpolation(nodes, samples, meshkernel::Projection::cartesian);
+        triangulationInterpolation.Compute();
+        benchmark::DoNotOptimize(triangulationInterpolation.GetResults().data());
+    }
+    SetCounters(state, samples.size());
+}
+BENCHMARK(BM_TriangulationInterpolation)->Arg(100)->Arg(316)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_ContactsMultipleConnections(benchmark::State& state)
+{
+    const auto n = static_cast<int>(state.range(0));
+    const auto mesh2d = MakeRectangularMeshForTesting(n, n, meshDelta, meshkernel::Projection::cartesian);
+
+    // A diagonal 1d network crossing the whole 2d mesh
+    std::vector<meshkernel::Point> nodes(n);
+    std::vector<meshkernel::Edge> edges(n - 1);
+    for (auto i = 0; i < n; ++i)
+    {
+        nodes[i] = {(i + 0.5) * meshDelta * (n - 1) / n, (i + 0.5) * meshDelta * (n - 1) / n};
+    }
+    for (auto i = 0; i < n - 1; ++i)
+    {
+        edges[i] = {static_cast<size_t>(i), static_cast<size_t>(i + 1)};
+    }
+    const auto mesh1d = std::make_shared<meshkernel::Mesh1D>(edges, nodes, meshkernel::Projection::cartesian);
+    const std::vector<bool> oneDNodeMask(nodes.size(), true);
+
+    for (auto _ : state)
+    {
+        meshkernel::Contacts contacts(mesh1d, mesh2d, oneDNodeMask);
+        contacts.ComputeMultipleConnections();
+        benchmark::DoNotOptimize(contacts.m_mesh1dIndices.data());
+    }
+    SetCounters(state, static_cast<size_t>(n) * n);
+}
+BENCHMARK(BM_ContactsMultipleConnections)->Arg(100)->Arg(316)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <limits>
 
 #include <MeshKernel/AveragingInterpolation.hpp>
+#include <MeshKernel/Operations.hpp>
+#include <MeshKernel/SampleBins.hpp>
 #include <TestUtils/MakeMeshes.hpp>
 #include <TestUtils/SampleFileReader.hpp>
 
@@ -562,3 +566,222 @@ TEST(Averaging, InterpolateOnFacesMinAbsValue)
     ASSERT_NEAR(5.2240896000000001, interpolationResults[8], tolerance);
     ASSERT_NEAR(6.1764706000000000, interpolationResults[9], tolerance);
 }
+
+TEST(Averaging, SampleBinsAggregateSamplesOnCoarserLevels)
+{
+    // Setup: four samples in different bins of the finest level, one with a missing value
+    std::vector<meshkernel::Sample> samples{{0.5, 0.5, 1.0}, {1.5, 0.5, -3.0}, {0.5, 1.5, 2.0}, {1.5, 1.5, 6.0}, {1.2, 1.2, meshkernel::doubleMissingValue}};
+
+    // Execute
+    meshkernel::SampleBins sampleBins(samples, 1.0);
+
+    // Assert
+    ASSERT_EQ(2, sampleBins.GetNumLevels());
+    ASSERT_EQ(4, sampleBins.GetBins(0).size());
+    ASSERT_DOUBLE_EQ(2.0, sampleBins.GetBinSize(1));
+
+    const auto& coarseBins = sampleBins.GetBins(1);
+    ASSERT_EQ(1, coarseBins.size());
+    ASSERT_EQ(4, coarseBins[0].count);
+    ASSERT_DOUBLE_EQ(1.0, coarseBins[0].x);
+    ASSERT_DOUBLE_EQ(1.0, coarseBins[0].y);
+    ASSERT_DOUBLE_EQ(-3.0, coarseBins[0].min);
+    ASSERT_DOUBLE_EQ(6.0, coarseBins[0].max);
+    ASSERT_DOUBLE_EQ(6.0, coarseBins[0].sum);
+    ASSERT_DOUBLE_EQ(1.0, coarseBins[0].minAbs);
+
+    // a search area of 16 bins across uses the coarsest level, a smaller one the finest
+    ASSERT_EQ(1, sampleBins.SelectLevel(16.0));
+    ASSERT_EQ(0, sampleBins.SelectLevel(4.0));
+}
+
+TEST(Averaging, SampleBinsKeepTheGridIndicesWithinTheCellKeys)
+{
+    // Setup: a bin size far too small for the extent of the samples
+    std::vector<meshkernel::Sample> samples{{0.0, 0.0, 1.0}, {1.0e12, 0.0, 2.0}, {0.0, 1.0e12, 3.0}};
+
+    // Execute
+    meshkernel::SampleBins sampleBins(samples, 1.0e-3);
+
+    // Assert: the bin size is enlarged, each sample keeps its own bin containing it
+    ASSERT_GE(sampleBins.GetBinSize(0) * 4294967295.0, 1.0e12);
+    const auto& bins = sampleBins.GetBins(0);
+    ASSERT_EQ(3, bins.size());
+    for (size_t b = 0; b < bins.size(); ++b)
+    {
+        ASSERT_EQ(1, bins[b].count);
+        const auto [lowerLeft, upperRight] = sampleBins.GetBinCell(0, b);
+        ASSERT_LE(lowerLeft.x, bins[b].x);
+        ASSERT_GE(upperRight.x, bins[b].x);
+        ASSERT_LE(lowerLeft.y, bins[b].y);
+        ASSERT_GE(upperRight.y, bins[b].y);
+    }
+}
+
+TEST(Averaging, InterpolateOnFacesWithDenseSamplesUsesBins)
+{
+    // Setup: many more samples than faces
+    const auto mesh = MakeRectangularMeshForTesting(6, 6, 10.0, meshkernel::Projection::cartesian);
+    const double spacing = 50.0 / 300.0;
+    std::vector<meshkernel::Sample> samples;
+    for (auto i = 0; i < 300; ++i)
+    {
+        for (auto j = 0; j < 300; ++j)
+        {
+            const double x = (i + 0.5) * spacing;
+            const double y = (j + 0.5) * spacing;
+            samples.push_back({x, y, x + 2.0 * y - 60.0});
+        }
+    }
+
+    const std::vector<std::pair<meshkernel::AveragingInterpolation::Method, double>> methods{{meshkernel::AveragingInterpolation::Method::SimpleAveraging, 1e-9},
+                                                                                            {meshkernel::AveragingInterpolation::Method::Max, 1e-9},
+                                                                                            {meshkernel::AveragingInterpolation::Method::Min, 1e-9},
+                                                                                            {meshkernel::AveragingInterpolation::Method::MinAbsValue, 1e-9}};
+    for (const auto& [method, tolerance] : methods)
+    {
+        // Execute
+        meshkernel::AveragingInterpolation averaging(mesh, samples, method, meshkernel::MeshLocations::Faces, 1.0, false, false);
+        averaging.Compute();
+
+        // Assert: the results on the aggregated samples are equal to the ones on all samples in each face
+        const auto& results = averaging.GetResults();
+        ASSERT_EQ(mesh->GetNumFaces(), results.size());
+        for (auto f = 0; f < mesh->GetNumFaces(); ++f)
+        {
+            const auto [lowerLeft, upperRight] = meshkernel::GetBoundingBox(std::vector<meshkernel::Point>{mesh->m_nodes[mesh->m_facesNodes[f][0]],
+                                                                                                            mesh->m_nodes[mesh->m_facesNodes[f][1]],
+                                                                                                            mesh->m_nodes[mesh->m_facesNodes[f][2]],
+                                                                                                            mesh->m_nodes[mesh->m_facesNodes[f][3]]});
+            double sum = 0.0;
+            double count = 0.0;
+            double max = std::numeric_limits<double>::lowest();
+            double min = std::numeric_limits<double>::max();
+            double minAbs = std::numeric_limits<double>::max();
+            for (const auto& sample : samples)
+            {
+                if (sample.x >= lowerLeft.x && sample.x <= upperRight.x && sample.y >= lowerLeft.y && sample.y <= upperRight.y)
+                {
+                    sum += sample.value;
+                    count += 1.0;
+                    max = std::max(max, sample.value);
+                    min = std::min(min, sample.value);
+                    minAbs = std::min(minAbs, std::abs(sample.value));
+                }
+            }
+
+            double expected = sum / count;
+            if (method == meshkernel::AveragingInterpolation::Method::Max)
+            {
+                expected = max;
+            }
+            if (method == meshkernel::AveragingInterpolation::Method::Min)
+            {
+                expected = min;
+            }
+            if (method == meshkernel::AveragingInterpolation::Method::MinAbsValue)
+            {
+                expected = minAbs;
+            }
+            ASSERT_NEAR(expected, results[f], tolerance);
+        }
+    }
+}
+
+TEST(Averaging, InterpolateOnFacesWithDenseSamplesUsesTheClosestSampleIfNoneAvailable)
+{
+    // Setup: dense samples on the two left columns of faces only
+    const auto mesh = MakeRectangularMeshForTesting(6, 6, 10.0, meshkernel::Projection::cartesian);
+    const double spacing = 20.0 / 120.0;
+    std::vector<meshkernel::Sample> samples;
+    for (auto i = 0; i < 120; ++i)
+    {
+        for (auto j = 0; j < 300; ++j)
+        {
+            const double x = (i + 0.5) * spacing;
+            const double y = (j + 0.25) * spacing;
+            samples.push_back({x, y, x + 2.0 * y});
+        }
+    }
+
+    // Execute
+    meshkernel::AveragingInterpolation averaging(mesh, samples, meshkernel::AveragingInterpolation::Method::Max, meshkernel::MeshLocations::Faces, 1.0, true, false);
+    averaging.Compute();
+
+    // Assert
+    const auto& results = averaging.GetResults();
+    ASSERT_EQ(mesh->GetNumFaces(), results.size());
+    for (auto f = 0; f < mesh->GetNumFaces(); ++f)
+    {
+        const auto& center = mesh->m_facesMassCenters[f];
+        double closestSquaredDistance = std::numeric_limits<double>::max();
+        double closestValue = meshkernel::doubleMissingValue;
+        for (const auto& sample : samples)
+        {
+            const double squaredDistance = (sample.x - center.x) * (sample.x - center.x) + (sample.y - center.y) * (sample.y - center.y);
+            if (squaredDistance < closestSquaredDistance)
+            {
+                closestSquaredDistance = squaredDistance;
+                closestValue = sample.value;
+            }
+        }
+
+        // faces containing samples use them, faces with samples within the search radius
+        // but not inside have no value, the other faces use the closest sample
+        if (center.x < 20.0)
+        {
+            ASSERT_NE(meshkernel::doubleMissingValue, results[f]);
+        }
+        else if (center.x < 30.0)
+        {
+            ASSERT_EQ(meshkernel::doubleMissingValue, results[f]);
+        }
+        else
+        {
+            ASSERT_DOUBLE_EQ(closestValue, results[f]);
+        }
+    }
+}
+
+TEST(Averaging, InterpolateOnFacesWithDenseSamplesExcludesExtremeSamplesOutsideFace)
+{
+    // Setup: dense samples, with extreme values just outside the left column of faces,
+    // in bins whose sample centroid is inside the left column
+    const auto mesh = MakeRectangularMeshForTesting(6, 6, 10.0, meshkernel::Projection::cartesian);
+    const double spacing = 50.0 / 300.0;
+    std::vector<meshkernel::Sample> samples;
+    for (auto i = 0; i < 300; ++i)
+    {
+        for (auto j = 0; j < 300; ++j)
+        {
+            samples.push_back({(i + 0.5) * spacing, (j + 0.5) * spacing, 1.0});
+        }
+    }
+    samples.push_back({10.01, 5.0, 500.0});
+    samples.push_back({10.01, 25.0, -500.0});
+
+    for (const auto method : {meshkernel::AveragingInterpolation::Method::Max, meshkernel::AveragingInterpolation::Method::Min})
+    {
+        // Execute
+        meshkernel::AveragingInterpolation averaging(mesh, samples, method, meshkernel::MeshLocations::Faces, 1.0, false, false);
+        averaging.Compute();
+
+        // Assert: the extreme values are found only in the faces containing them
+        const auto& results = averaging.GetResults();
+        ASSERT_EQ(mesh->GetNumFaces(), results.size());
+        for (auto f = 0; f < mesh->GetNumFaces(); ++f)
+        {
+            const auto& center = mesh->m_facesMassCenters[f];
+            double expected = 1.0;
+            if (method == meshkernel::AveragingInterpolation::Method::Max && center.x > 10.0 && center.x < 20.0 && center.y < 10.0)
+            {
+                expected = 500.0;
+            }
+            if (method == meshkernel::AveragingInterpolation::Method::Min && center.x > 10.0 && center.x < 20.0 && center.y > 20.0 && center.y < 30.0)
+            {
+                expected = -500.0;
+            }
+            ASSERT_DOUBLE_EQ(expected, results[f]);
+        }
+    }
+}
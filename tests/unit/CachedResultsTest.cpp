@@ -0,0 +1,74 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Polygons.hpp>
+#include <MeshKernelApi/CachedResults.hpp>
+
+TEST(CachedResults, PolygonOperationReusesTheResultOfTheSamePolygonAndParameters)
+{
+    // Setup: an operation counting its calls
+    const std::vector<meshkernel::Point> square{{0.0, 0.0}, {3.0, 0.0}, {3.0, 3.0}, {0.0, 3.0}, {0.0, 0.0}};
+    meshkernelapi::PolygonOperationParameters offset;
+    offset.m_type = meshkernelapi::PolygonOperationParameters::Type::Offset;
+    offset.m_distance = 1.0;
+    int numCalls = 0;
+    const auto operation = [&numCalls](const meshkernel::Polygons& polygon) {
+        numCalls++;
+        return polygon.m_nodes;
+    };
+    meshkernelapi::PolygonOperation polygonOperation;
+
+    // Execute: the count and the get calls of the same operation
+    const auto numNodes = polygonOperation.Compute(square, offset, operation).size();
+    const auto& result = polygonOperation.Compute(square, offset, operation);
+
+    // Assert
+    ASSERT_EQ(1, numCalls);
+    ASSERT_EQ(square.size(), numNodes);
+    ASSERT_EQ(square.size(), result.size());
+
+    // another distance, another polygon or another operation is computed again
+    auto otherOffset = offset;
+    otherOffset.m_distance = 2.0;
+    polygonOperation.Compute(square, otherOffset, operation);
+    ASSERT_EQ(2, numCalls);
+
+    auto movedSquare = square;
+    movedSquare[2].x += 1.0;
+    polygonOperation.Compute(movedSquare, otherOffset, operation);
+    ASSERT_EQ(3, numCalls);
+
+    auto refinement = otherOffset;
+    refinement.m_type = meshkernelapi::PolygonOperationParameters::Type::Refinement;
+    polygonOperation.Compute(movedSquare, refinement, operation);
+    ASSERT_EQ(4, numCalls);
+}
+
+TEST(CachedResults, NodeSelectionReusesTheSelectionOfTheSamePolygonAndMeshVersion)
+{
+    // Setup: a selection counting its calls
+    const std::vector<meshkernel::Point> square{{0.0, 0.0}, {3.0, 0.0}, {3.0, 3.0}, {0.0, 3.0}, {0.0, 0.0}};
+    int numCalls = 0;
+    const auto select = [&numCalls](const std::vector<meshkernel::Point>&, bool inside) {
+        numCalls++;
+        return inside ? std::vector<int>{0, 1} : std::vector<int>{2};
+    };
+    meshkernelapi::NodeSelection nodeSelection;
+
+    // Execute: the count and the get calls of the same selection
+    const auto numSelectedNodes = nodeSelection.Compute(square, true, 0, select).size();
+    const auto& selectedNodes = nodeSelection.Compute(square, true, 0, select);
+
+    // Assert
+    ASSERT_EQ(1, numCalls);
+    ASSERT_EQ(2, numSelectedNodes);
+    ASSERT_EQ((std::vector<int>{0, 1}), selectedNodes);
+
+    // the other side or a modified mesh is selected again
+    ASSERT_EQ((std::vector<int>{2}), nodeSelection.Compute(square, false, 0, select));
+    ASSERT_EQ(2, numCalls);
+    nodeSelection.Compute(square, false, 1, select);
+    ASSERT_EQ(3, numCalls);
+}
@@ -32,21 +32,21 @@ TEST(CurvilinearGridFromPolygon, ComputeGridInPolygonWithFourthSide)
     // check the values
     constexpr double tolerance = 1e-6;
 
-    ASSERT_NEAR(273.50231900000000, curvilinearGrid.m_grid[0][0].x, tolerance);
-    ASSERT_NEAR(305.00253300000003, curvilinearGrid.m_grid[0][1].x, tolerance);
-    ASSERT_NEAR(507.50378400000000, curvilinearGrid.m_grid[0][2].x, tolerance);
+    ASSERT_NEAR(273.50231900000000, curvilinearGrid.Node(0, 0).x, tolerance);
+    ASSERT_NEAR(305.00253300000003, curvilinearGrid.Node(0, 1).x, tolerance);
+    ASSERT_NEAR(507.50378400000000, curvilinearGrid.Node(0, 2).x, tolerance);
 
-    ASSERT_NEAR(478.88043199999998, curvilinearGrid.m_grid[0][0].y, tolerance);
-    ASSERT_NEAR(493.13061499999998, curvilinearGrid.m_grid[0][1].y, tolerance);
-    ASSERT_NEAR(494.63061499999998, curvilinearGrid.m_grid[0][2].y, tolerance);
+    ASSERT_NEAR(478.88043199999998, curvilinearGrid.Node(0, 0).y, tolerance);
+    ASSERT_NEAR(493.13061499999998, curvilinearGrid.Node(0, 1).y, tolerance);
+    ASSERT_NEAR(494.63061499999998, curvilinearGrid.Node(0, 2).y, tolerance);
 
-    ASSERT_NEAR(274.25231900000000, curvilinearGrid.m_grid[1][0].x, tolerance);
-    ASSERT_NEAR(410.51616175207897, curvilinearGrid.m_grid[1][1].x, tolerance);
-    ASSERT_NEAR(741.50524900000005, curvilinearGrid.m_grid[1][2].x, tolerance);
+    ASSERT_NEAR(274.25231900000000, curvilinearGrid.Node(1, 0).x, tolerance);
+    ASSERT_NEAR(410.51616175207897, curvilinearGrid.Node(1, 1).x, tolerance);
+    ASSERT_NEAR(741.50524900000005, curvilinearGrid.Node(1, 2).x, tolerance);
 
-    ASSERT_NEAR(325.12890599999997, curvilinearGrid.m_grid[1][0].y, tolerance);
-    ASSERT_NEAR(314.33420290273324, curvilinearGrid.m_grid[1][1].y, tolerance);
-    ASSERT_NEAR(328.12893700000001, curvilinearGrid.m_grid[1][2].y, tolerance);
+    ASSERT_NEAR(325.12890599999997, curvilinearGrid.Node(1, 0).y, tolerance);
+    ASSERT_NEAR(314.33420290273324, curvilinearGrid.Node(1, 1).y, tolerance);
+    ASSERT_NEAR(328.12893700000001, curvilinearGrid.Node(1, 2).y, tolerance);
 }
 
 TEST(CurvilinearGridFromPolygon, ComputeGridInPolygonWithoutFourthSide)
@@ -75,21 +75,21 @@ TEST(CurvilinearGridFromPolygon, ComputeGridInPolygonWithoutFourthSide)
     // check the values
     constexpr double tolerance = 1e-6;
 
-    ASSERT_NEAR(273.50231900000000, curvilinearGrid.m_grid[0][0].x, tolerance);
-    ASSERT_NEAR(492.12869250000006, curvilinearGrid.m_grid[0][1].x, tolerance);
-    ASSERT_NEAR(710.75506600000006, curvilinearGrid.m_grid[0][2].x, tolerance);
+    ASSERT_NEAR(273.50231900000000, curvilinearGrid.Node(0, 0).x, tolerance);
+    ASSERT_NEAR(492.12869250000006, curvilinearGrid.Node(0, 1).x, tolerance);
+    ASSERT_NEAR(710.75506600000006, curvilinearGrid.Node(0, 2).x, tolerance);
 
-    ASSERT_NEAR(478.88043199999998, curvilinearGrid.m_grid[0][0].y, tolerance);
-    ASSERT_NEAR(484.88049300000000, curvilinearGrid.m_grid[0][1].y, tolerance);
-    ASSERT_NEAR(490.88055400000002, curvilinearGrid.m_grid[0][2].y, tolerance);
+    ASSERT_NEAR(478.88043199999998, curvilinearGrid.Node(0, 0).y, tolerance);
+    ASSERT_NEAR(484.88049300000000, curvilinearGrid.Node(0, 1).y, tolerance);
+    ASSERT_NEAR(490.88055400000002, curvilinearGrid.Node(0, 2).y, tolerance);
 
-    ASSERT_NEAR(274.25231900000000, curvilinearGrid.m_grid[1][0].x, tolerance);
-    ASSERT_NEAR(481.37408996173241, curvilinearGrid.m_grid[1][1].x, tolerance);
-    ASSERT_NEAR(741.50524900000005, curvilinearGrid.m_grid[1][2].x, tolerance);
+    ASSERT_NEAR(274.25231900000000, curvilinearGrid.Node(1, 0).x, tolerance);
+    ASSERT_NEAR(481.37408996173241, curvilinearGrid.Node(1, 1).x, tolerance);
+    ASSERT_NEAR(741.50524900000005, curvilinearGrid.Node(1, 2).x, tolerance);
 
-    ASSERT_NEAR(325.12890599999997, curvilinearGrid.m_grid[1][0].y, tolerance);
-    ASSERT_NEAR(322.93773596204318, curvilinearGrid.m_grid[1][1].y, tolerance);
-    ASSERT_NEAR(328.12893700000001, curvilinearGrid.m_grid[1][2].y, tolerance);
+    ASSERT_NEAR(325.12890599999997, curvilinearGrid.Node(1, 0).y, tolerance);
+    ASSERT_NEAR(322.93773596204318, curvilinearGrid.Node(1, 1).y, tolerance);
+    ASSERT_NEAR(328.12893700000001, curvilinearGrid.Node(1, 2).y, tolerance);
 }
 
 TEST(CurvilinearGridFromPolygon, ComputeGridTriangle)
@@ -118,31 +118,31 @@ TEST(CurvilinearGridFromPolygon, ComputeGridTriangle)
     // check the values
     constexpr double tolerance = 1e-6;
 
-    ASSERT_NEAR(444.50479100000001, curvilinearGrid.m_grid[0][0].x, tolerance);
-    ASSERT_NEAR(444.09570300000001, curvilinearGrid.m_grid[0][1].x, tolerance);
-    ASSERT_NEAR(526.73339799999997, curvilinearGrid.m_grid[0][2].x, tolerance);
-    ASSERT_NEAR(558.64300500000002, curvilinearGrid.m_grid[0][3].x, tolerance);
-    ASSERT_NEAR(593.41625999999997, curvilinearGrid.m_grid[0][4].x, tolerance);
-    ASSERT_NEAR(-999.0000000000000, curvilinearGrid.m_grid[0][5].x, tolerance);
-
-    ASSERT_NEAR(437.15594499999997, curvilinearGrid.m_grid[0][0].y, tolerance);
-    ASSERT_NEAR(436.74685699999998, curvilinearGrid.m_grid[0][1].y, tolerance);
-    ASSERT_NEAR(377.83657799999997, curvilinearGrid.m_grid[0][2].y, tolerance);
-    ASSERT_NEAR(324.65368699999999, curvilinearGrid.m_grid[0][3].y, tolerance);
-    ASSERT_NEAR(266.56158399999998, curvilinearGrid.m_grid[0][4].y, tolerance);
-    ASSERT_NEAR(-999.0000000000000, curvilinearGrid.m_grid[0][5].y, tolerance);
-
-    ASSERT_NEAR(427.73178100000001, curvilinearGrid.m_grid[1][0].x, tolerance);
-    ASSERT_NEAR(455.85723540740742, curvilinearGrid.m_grid[1][1].x, tolerance);
-    ASSERT_NEAR(483.98268981481488, curvilinearGrid.m_grid[1][2].x, tolerance);
-    ASSERT_NEAR(506.38081040740741, curvilinearGrid.m_grid[1][3].x, tolerance);
-    ASSERT_NEAR(528.77893099999994, curvilinearGrid.m_grid[1][4].x, tolerance);
-    ASSERT_NEAR(-999.0000000000000, curvilinearGrid.m_grid[1][5].x, tolerance);
-
-    ASSERT_NEAR(382.74575800000002, curvilinearGrid.m_grid[1][0].y, tolerance);
-    ASSERT_NEAR(362.14685592592593, curvilinearGrid.m_grid[1][1].y, tolerance);
-    ASSERT_NEAR(341.54795385185184, curvilinearGrid.m_grid[1][2].y, tolerance);
-    ASSERT_NEAR(302.41837092592596, curvilinearGrid.m_grid[1][3].y, tolerance);
-    ASSERT_NEAR(263.28878800000001, curvilinearGrid.m_grid[1][4].y, tolerance);
-    ASSERT_NEAR(-999.0000000000000, curvilinearGrid.m_grid[1][5].y, tolerance);
+    ASSERT_NEAR(444.50479100000001, curvilinearGrid.Node(0, 0).x, tolerance);
+    ASSERT_NEAR(444.09570300000001, curvilinearGrid.Node(0, 1).x, tolerance);
+    ASSERT_NEAR(526.73339799999997, curvilinearGrid.Node(0, 2).x, tolerance);
+    ASSERT_NEAR(558.64300500000002, curvilinearGrid.Node(0, 3).x, tolerance);
+    ASSERT_NEAR(593.41625999999997, curvilinearGrid.Node(0, 4).x, tolerance);
+    ASSERT_NEAR(-999.0000000000000, curvilinearGrid.Node(0, 5).x, tolerance);
+
+    ASSERT_NEAR(437.15594499999997, curvilinearGrid.Node(0, 0).y, tolerance);
+    ASSERT_NEAR(436.74685699999998, curvilinearGrid.Node(0, 1).y, tolerance);
+    ASSERT_NEAR(377.83657799999997, curvilinearGrid.Node(0, 2).y, tolerance);
+    ASSERT_NEAR(324.65368699999999, curvilinearGrid.Node(0, 3).y, tolerance);
+    ASSERT_NEAR(266.56158399999998, curvilinearGrid.Node(0, 4).y, tolerance);
+    ASSERT_NEAR(-999.0000000000000, curvilinearGrid.Node(0, 5).y, tolerance);
+
+    ASSERT_NEAR(427.73178100000001, curvilinearGrid.Node(1, 0).x, tolerance);
+    ASSERT_NEAR(455.85723540740742, curvilinearGrid.Node(1, 1).x, tolerance);
+    ASSERT_NEAR(483.98268981481488, curvilinearGrid.Node(1, 2).x, tolerance);
+    ASSERT_NEAR(506.38081040740741, curvilinearGrid.Node(1, 3).x, tolerance);
+    ASSERT_NEAR(528.77893099999994, curvilinearGrid.Node(1, 4).x, tolerance);
+    ASSERT_NEAR(-999.0000000000000, curvilinearGrid.Node(1, 5).x, tolerance);
+
+    ASSERT_NEAR(382.74575800000002, curvilinearGrid.Node(1, 0).y, tolerance);
+    ASSERT_NEAR(362.14685592592593, curvilinearGrid.Node(1, 1).y, tolerance);
+    ASSERT_NEAR(341.54795385185184, curvilinearGrid.Node(1, 2).y, tolerance);
+    ASSERT_NEAR(302.41837092592596, curvilinearGrid.Node(1, 3).y, tolerance);
+    ASSERT_NEAR(263.28878800000001, curvilinearGrid.Node(1, 4).y, tolerance);
+    ASSERT_NEAR(-999.0000000000000, curvilinearGrid.Node(1, 5).y, tolerance);
 }
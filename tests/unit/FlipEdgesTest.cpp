@@ -1,11 +1,15 @@
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include <MeshKernel/Constants.hpp>
 #include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Exceptions.hpp>
 #include <MeshKernel/FlipEdges.hpp>
 #include <MeshKernel/LandBoundaries.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/Polygons.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 #include <TestUtils/MakeMeshes.hpp>
 
 TEST(FlipEdges, FlipEdgesWithLandBoundary)
@@ -30,6 +34,34 @@ TEST(FlipEdges, FlipEdgesWithLandBoundary)
     ASSERT_EQ(16, mesh->GetNumEdges());
 }
 
+TEST(FlipEdges, FlipEdgesReportsProgressAndStopsWhenCancelled)
+{
+    //1 Setup
+    auto mesh = MakeRectangularMeshForTesting(3, 3, 10, meshkernel::Projection::cartesian, {0.0, 0.0});
+    auto polygon = std::make_shared<meshkernel::Polygons>();
+    std::vector<meshkernel::Point> landBoundary;
+    auto landBoundaries = std::make_shared<meshkernel::LandBoundaries>(landBoundary, mesh, polygon);
+
+    std::vector<double> reportedProgress;
+    meshkernel::ProgressMonitor progressMonitor([&reportedProgress](double progress) { reportedProgress.emplace_back(progress); });
+    const meshkernel::ProgressMonitorScope progressMonitorScope(progressMonitor);
+
+    //2 Execute
+    meshkernel::FlipEdges flipEdges(mesh, landBoundaries, true, false);
+    flipEdges.Compute();
+
+    //3 Assert the progress is reported once per sweep
+    ASSERT_FALSE(reportedProgress.empty());
+    ASSERT_TRUE(std::is_sorted(reportedProgress.begin(), reportedProgress.end()));
+    ASSERT_GE(reportedProgress.front(), 0.0);
+    ASSERT_LE(reportedProgress.back(), 1.0);
+    ASSERT_DOUBLE_EQ(reportedProgress.back(), progressMonitor.GetProgress());
+
+    //4 Assert the operation stops once cancelled
+    progressMonitor.RequestCancellation();
+    ASSERT_THROW(flipEdges.Compute(), meshkernel::OperationCancelledError);
+}
+
 TEST(FlipEdges, FlipEdgesMediumTriangularMesh)
 {
     //1 Setup
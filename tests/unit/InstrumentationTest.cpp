@@ -0,0 +1,42 @@
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MeshKernel/Instrumentation.hpp>
+
+TEST(Instrumentation, ReportMergesTheEntriesOfAllThreads)
+{
+    meshkernel::Instrumentation::Reset();
+
+    // Execute
+    meshkernel::Instrumentation::Record("Section", 1.0);
+    std::thread worker([] {
+        meshkernel::Instrumentation::Record("Section", 3.0);
+        meshkernel::Instrumentation::Count("Counter", 5);
+    });
+    worker.join();
+    meshkernel::Instrumentation::Count("Counter", 2);
+    {
+        const meshkernel::ScopedTimer scopedTimer("Timer");
+    }
+
+    // Assert, the entries are sorted by decreasing total time
+    const auto report = meshkernel::Instrumentation::GetReport();
+    ASSERT_EQ(3, report.size());
+
+    ASSERT_EQ("Section", report[0].m_name);
+    ASSERT_EQ(2, report[0].m_count);
+    ASSERT_DOUBLE_EQ(4.0, report[0].m_totalSeconds);
+    ASSERT_DOUBLE_EQ(3.0, report[0].m_maxSeconds);
+
+    ASSERT_EQ("Timer", report[1].m_name);
+    ASSERT_EQ(1, report[1].m_count);
+
+    ASSERT_EQ("Counter", report[2].m_name);
+    ASSERT_EQ(7, report[2].m_count);
+    ASSERT_DOUBLE_EQ(0.0, report[2].m_totalSeconds);
+
+    // Reset clears the entries of all threads
+    meshkernel::Instrumentation::Reset();
+    ASSERT_TRUE(meshkernel::Instrumentation::GetReport().empty());
+}
@@ -0,0 +1,48 @@
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <MeshKernelApi/JobPool.hpp>
+
+TEST(JobPool, JobsOfTheSameStrandRunInSubmissionOrder)
+{
+    // Setup: enough workers to run all jobs at once
+    meshkernelapi::JobPool jobPool(4);
+    std::mutex mutex;
+    std::vector<int> values;
+
+    // Execute: the first job of the strand takes longer than the second one, which depends on it
+    const auto firstJob = jobPool.Submit(0, [&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const std::scoped_lock lock(mutex);
+        values.emplace_back(1);
+        return meshkernelapi::JobResult{};
+    });
+    const auto secondJob = jobPool.Submit(0, [&] {
+        const std::scoped_lock lock(mutex);
+        values.emplace_back(values.empty() ? -1 : values.back() * 10);
+        return meshkernelapi::JobResult{};
+    });
+
+    // a job of another strand does not wait for the first strand
+    const auto otherJob = jobPool.Submit(1, [&] {
+        const std::scoped_lock lock(mutex);
+        values.emplace_back(0);
+        return meshkernelapi::JobResult{};
+    });
+
+    meshkernelapi::JobPool::Status status;
+    static_cast<void>(jobPool.Wait(otherJob, status));
+    ASSERT_EQ(meshkernelapi::JobPool::Status::Completed, status);
+    static_cast<void>(jobPool.Wait(firstJob, status));
+    ASSERT_EQ(meshkernelapi::JobPool::Status::Completed, status);
+    static_cast<void>(jobPool.Wait(secondJob, status));
+    ASSERT_EQ(meshkernelapi::JobPool::Status::Completed, status);
+
+    // Assert
+    const std::vector<int> expected{0, 1, 10};
+    ASSERT_EQ(expected, values);
+}
@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <MeshKernel/Exceptions.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/MeshRefinement.hpp>
 #include <MeshKernel/Polygons.hpp>
+#include <MeshKernel/ProgressMonitor.hpp>
 #include <MeshKernelApi/InterpolationParameters.hpp>
 #include <MeshKernelApi/SampleRefineParameters.hpp>
 #include <TestUtils/MakeMeshes.hpp>
@@ -603,6 +605,75 @@ TEST(MeshRefinement, RefineBasedOnPolygon)
     ASSERT_EQ(27, mesh->m_edges[48].second);
 }
 
+TEST(MeshRefinement, RefineBasedOnPolygonCancelledAfterFirstLevelCompletesTheMesh)
+{
+    // Prepare: the same refinement as RefineBasedOnPolygon, with two levels
+    auto mesh = MakeRectangularMeshForTesting(5, 5, 10.0, meshkernel::Projection::cartesian);
+
+    std::vector<meshkernel::Point> point{
+        {25.0, -10.0},
+        {25.0, 15.0},
+        {45.0, 15.0},
+        {45.0, -10.0},
+        {25.0, -10.0}};
+
+    meshkernel::Polygons polygon(point, mesh->m_projection);
+
+    meshkernelapi::InterpolationParameters interpolationParameters;
+    interpolationParameters.MaxNumberOfRefinementIterations = 2;
+    interpolationParameters.RefineIntersected = 0;
+    interpolationParameters.UseMassCenterWhenRefining = 0;
+
+    meshkernel::MeshRefinement meshRefinement(mesh, polygon, interpolationParameters);
+
+    // the cancellation is requested while the first level is refined
+    meshkernel::ProgressMonitor progressMonitor([&progressMonitor](double) { progressMonitor.RequestCancellation(); });
+    const meshkernel::ProgressMonitorScope progressMonitorScope(progressMonitor);
+
+    // Execute
+    ASSERT_THROW(meshRefinement.Compute(), meshkernel::OperationCancelledError);
+
+    // Assert, the mesh is the one refined once and administrated
+    ASSERT_EQ(30, mesh->GetNumNodes());
+    ASSERT_EQ(52, mesh->GetNumEdges());
+    ASSERT_EQ(mesh->GetNumEdges(), mesh->m_edgesNumFaces.size());
+}
+
+TEST(MeshRefinement, RefineBasedOnPolygonSamplesTheMemoryUsageOfTheRefinedMesh)
+{
+    // Prepare: the same refinement as RefineBasedOnPolygon, with two levels
+    auto mesh = MakeRectangularMeshForTesting(5, 5, 10.0, meshkernel::Projection::cartesian);
+
+    std::vector<meshkernel::Point> point{
+        {25.0, -10.0},
+        {25.0, 15.0},
+        {45.0, 15.0},
+        {45.0, -10.0},
+        {25.0, -10.0}};
+
+    meshkernel::Polygons polygon(point, mesh->m_projection);
+
+    meshkernelapi::InterpolationParameters interpolationParameters;
+    interpolationParameters.MaxNumberOfRefinementIterations = 2;
+    interpolationParameters.RefineIntersected = 0;
+    interpolationParameters.UseMassCenterWhenRefining = 0;
+
+    meshkernel::MeshRefinement meshRefinement(mesh, polygon, interpolationParameters);
+    const auto initialMemoryUsage = mesh->GetMemoryUsage().GetTotal();
+
+    meshkernel::ProgressMonitor progressMonitor;
+    progressMonitor.EnableMemoryUsageSampling();
+    const meshkernel::ProgressMonitorScope progressMonitorScope(progressMonitor);
+
+    // Execute
+    meshRefinement.Compute();
+
+    // Assert, the sample is taken on the refined mesh, larger than the initial mesh with the refinement masks
+    meshkernel::MemoryUsage refinementMemoryUsage;
+    meshRefinement.AccumulateMemoryUsage(refinementMemoryUsage);
+    ASSERT_GT(progressMonitor.GetLargestMemoryUsage(), initialMemoryUsage + refinementMemoryUsage.GetTotal());
+}
+
 TEST(MeshRefinement, RefineBasedOnPolygonThreeByThree)
 {
     // Prepare
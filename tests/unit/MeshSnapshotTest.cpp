@@ -0,0 +1,126 @@
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/MeshSnapshot.hpp>
+#include <TestUtils/MakeMeshes.hpp>
+
+TEST(MeshSnapshot, WriteAndMapSnapshot)
+{
+    // Setup
+    const auto mesh = MakeRectangularMeshForTesting(4, 5, 10.0, meshkernel::Projection::cartesian);
+    const std::string filePath{"MeshSnapshotTest.mksnap"};
+
+    // Execute
+    meshkernel::MeshSnapshot::Write(filePath, *mesh);
+    {
+        const meshkernel::MeshSnapshot snapshot(filePath);
+
+        // Assert
+        ASSERT_EQ(meshkernel::Projection::cartesian, snapshot.GetProjection());
+        ASSERT_EQ(mesh->GetNumNodes(), snapshot.NodesX().size());
+        ASSERT_EQ(mesh->GetNumNodes(), snapshot.NodesY().size());
+        ASSERT_EQ(mesh->GetNumEdges(), snapshot.Edges().size());
+        ASSERT_EQ(mesh->GetNumFaces(), snapshot.FacesCircumcenters().size());
+        ASSERT_EQ(mesh->GetNumFaces() + 1, snapshot.FacesOffsets().size());
+        ASSERT_EQ(4 * mesh->GetNumFaces(), snapshot.FacesNodes().size());
+
+        constexpr double tolerance = 1e-12;
+        for (auto f = 0; f < mesh->GetNumFaces(); ++f)
+        {
+            ASSERT_NEAR(mesh->m_facesCircumcenters[f].x, snapshot.FacesCircumcenters()[f].x, tolerance);
+            ASSERT_NEAR(mesh->m_facesMassCenters[f].y, snapshot.FacesMassCenters()[f].y, tolerance);
+            ASSERT_NEAR(mesh->m_faceArea[f], snapshot.FacesAreas()[f], tolerance);
+            ASSERT_EQ(mesh->m_facesNodes[f][2], snapshot.FacesNodes()[snapshot.FacesOffsets()[f] + 2]);
+        }
+        for (auto n = 0; n < mesh->GetNumNodes(); ++n)
+        {
+            ASSERT_EQ(mesh->m_nodes.GetX()[n], snapshot.NodesX()[n]);
+            ASSERT_EQ(mesh->m_nodes.GetY()[n], snapshot.NodesY()[n]);
+            ASSERT_EQ(mesh->m_nodesTypes[n], snapshot.NodesTypes()[n]);
+            ASSERT_EQ(mesh->m_nodesNumEdges[n], snapshot.NodesEdgesOffsets()[n + 1] - snapshot.NodesEdgesOffsets()[n]);
+        }
+    }
+    std::remove(filePath.c_str());
+}
+
+TEST(MeshSnapshot, ToMesh2DRestoresTheAdministration)
+{
+    // Setup
+    const auto mesh = MakeRectangularMeshForTesting(3, 3, 1.0, meshkernel::Projection::spherical);
+    const std::string filePath{"MeshSnapshotRestoreTest.mksnap"};
+    meshkernel::MeshSnapshot::Write(filePath, *mesh);
+
+    // Execute
+    std::shared_ptr<meshkernel::Mesh2D> restoredMesh;
+    {
+        const meshkernel::MeshSnapshot snapshot(filePath);
+        restoredMesh = snapshot.ToMesh2D();
+    }
+    std::remove(filePath.c_str());
+
+    // Assert
+    ASSERT_EQ(meshkernel::Projection::spherical, restoredMesh->m_projection);
+    ASSERT_EQ(mesh->GetNumNodes(), restoredMesh->GetNumNodes());
+    ASSERT_EQ(mesh->GetNumEdges(), restoredMesh->GetNumEdges());
+    ASSERT_EQ(mesh->GetNumFaces(), restoredMesh->GetNumFaces());
+    ASSERT_EQ(mesh->m_nodesEdges, restoredMesh->m_nodesEdges);
+    ASSERT_EQ(mesh->m_nodesNumEdges, restoredMesh->m_nodesNumEdges);
+    ASSERT_EQ(mesh->m_nodesTypes, restoredMesh->m_nodesTypes);
+    ASSERT_EQ(mesh->m_edgesFaces, restoredMesh->m_edgesFaces);
+    ASSERT_EQ(mesh->m_edgesNumFaces, restoredMesh->m_edgesNumFaces);
+    ASSERT_EQ(mesh->m_facesNodes, restoredMesh->m_facesNodes);
+    ASSERT_EQ(mesh->m_facesEdges, restoredMesh->m_facesEdges);
+    ASSERT_EQ(mesh->m_numFacesNodes, restoredMesh->m_numFacesNodes);
+    ASSERT_EQ(mesh->m_faceArea, restoredMesh->m_faceArea);
+    ASSERT_EQ(mesh->m_nodeMask, restoredMesh->m_nodeMask);
+    ASSERT_TRUE(restoredMesh->HasUpToDateFaceAdministration());
+    mesh->ComputeEdgesLengths();
+    ASSERT_EQ(mesh->m_edgeLengths.size(), restoredMesh->m_edgeLengths.size());
+    for (auto e = 0; e < mesh->GetNumEdges(); ++e)
+    {
+        ASSERT_NEAR(mesh->m_edgeLengths[e], restoredMesh->m_edgeLengths[e], 1e-12);
+    }
+}
+
+TEST(MeshSnapshot, OpeningAnInvalidFileThrows)
+{
+    // Setup
+    const std::string filePath{"MeshSnapshotInvalidTest.mksnap"};
+    {
+        std::ofstream file(filePath, std::ios::binary);
+        file << std::string(512, 'x');
+    }
+
+    // Execute and assert
+    ASSERT_THROW(meshkernel::MeshSnapshot snapshot(filePath), std::invalid_argument);
+    ASSERT_THROW(meshkernel::MeshSnapshot snapshot("MeshSnapshotNotExisting.mksnap"), std::invalid_argument);
+    std::remove(filePath.c_str());
+}
+
+TEST(MeshSnapshot, OpeningASnapshotWithOutOfRangeEdgeNodesThrows)
+{
+    // Setup
+    const auto mesh = MakeRectangularMeshForTesting(3, 3, 1.0, meshkernel::Projection::cartesian);
+    const std::string filePath{"MeshSnapshotCorruptTest.mksnap"};
+    meshkernel::MeshSnapshot::Write(filePath, *mesh);
+
+    // overwrite the first node of the first edge. The section table follows the 24 bytes of the header fields,
+    // each entry holds the offset and the count of a section and the edges are the sixth section
+    {
+        std::fstream file(filePath, std::ios::binary | std::ios::in | std::ios::out);
+        std::uint64_t edgesOffset = 0;
+        file.seekg(24 + 5 * 2 * sizeof(std::uint64_t));
+        file.read(reinterpret_cast<char*>(&edgesOffset), sizeof(edgesOffset));
+        const std::uint64_t outOfRangeNode = mesh->GetNumNodes();
+        file.seekp(static_cast<std::streamoff>(edgesOffset));
+        file.write(reinterpret_cast<const char*>(&outOfRangeNode), sizeof(outOfRangeNode));
+    }
+
+    // Execute and assert
+    ASSERT_THROW(meshkernel::MeshSnapshot snapshot(filePath), std::invalid_argument);
+    std::remove(filePath.c_str());
+}
@@ -1,10 +1,15 @@
+#include <algorithm>
 #include <chrono>
 #include <gtest/gtest.h>
 #include <random>
 
 #include <MeshKernel/Constants.hpp>
+#include <MeshKernel/CurvilinearGrid.hpp>
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/NodeCoordinates.hpp>
+#include <MeshKernel/MeshQuality.hpp>
+#include <MeshKernel/Operations.hpp>
 #include <MeshKernel/Polygons.hpp>
 #include <TestUtils/MakeMeshes.hpp>
 
@@ -255,6 +260,109 @@ TEST(Mesh, TriangulateSamples)
     meshkernel::Mesh2D mesh(generatedPoints[0], polygons, meshkernel::Projection::cartesian);
 }
 
+TEST(Mesh, TriangulateSamplesInTilesMatchesSingleTriangulation)
+{
+    // Prepare: a perturbed regular grid of nodes
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> perturbation(-0.2, 0.2);
+    std::vector<meshkernel::Point> nodes;
+    for (auto i = 0; i < 40; ++i)
+    {
+        for (auto j = 0; j < 40; ++j)
+        {
+            nodes.push_back({i + perturbation(generator), j + perturbation(generator)});
+        }
+    }
+    const meshkernel::Polygons polygons;
+
+    // Execute
+    meshkernel::Mesh2D mesh(nodes, polygons, meshkernel::Projection::cartesian, 0);
+    meshkernel::Mesh2D tiledMesh(nodes, polygons, meshkernel::Projection::cartesian, 300);
+
+    // Assert: the tiles produce the same edges
+    const auto sortedEdges = [](const meshkernel::Mesh2D& m) {
+        std::vector<meshkernel::Edge> edges;
+        for (const auto& [first, second] : m.m_edges)
+        {
+            edges.emplace_back(std::min(first, second), std::max(first, second));
+        }
+        std::sort(edges.begin(), edges.end());
+        return edges;
+    };
+    ASSERT_GT(mesh.GetNumEdges(), 0);
+    ASSERT_EQ(mesh.GetNumEdges(), tiledMesh.GetNumEdges());
+    ASSERT_EQ(sortedEdges(mesh), sortedEdges(tiledMesh));
+}
+
+TEST(Mesh, TriangulateClusteredSamplesInTilesMatchesSingleTriangulation)
+{
+    // Prepare: dense clusters in a sparse background, so that many tile triangles reach far outside their tile
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> background(0.0, 100.0);
+    std::normal_distribution<double> cluster(0.0, 1.5);
+    std::vector<meshkernel::Point> nodes;
+    for (auto i = 0; i < 200; ++i)
+    {
+        nodes.push_back({background(generator), background(generator)});
+    }
+    const std::vector<meshkernel::Point> clusterCenters{{20.0, 25.0}, {70.0, 40.0}, {45.0, 80.0}};
+    for (const auto& center : clusterCenters)
+    {
+        for (auto i = 0; i < 800; ++i)
+        {
+            nodes.push_back({center.x + cluster(generator), center.y + cluster(generator)});
+        }
+    }
+    const meshkernel::Polygons polygons;
+
+    // Execute
+    meshkernel::Mesh2D mesh(nodes, polygons, meshkernel::Projection::cartesian, 0);
+    meshkernel::Mesh2D tiledMesh(nodes, polygons, meshkernel::Projection::cartesian, 100);
+
+    // Assert: the tiles produce the same edges as the untiled triangulation
+    const auto sortedEdges = [](const meshkernel::Mesh2D& m) {
+        std::vector<meshkernel::Edge> edges;
+        for (const auto& [first, second] : m.m_edges)
+        {
+            edges.emplace_back(std::min(first, second), std::max(first, second));
+        }
+        std::sort(edges.begin(), edges.end());
+        return edges;
+    };
+    ASSERT_GT(mesh.GetNumEdges(), 0);
+    ASSERT_EQ(mesh.GetNumEdges(), tiledMesh.GetNumEdges());
+    ASSERT_EQ(sortedEdges(mesh), sortedEdges(tiledMesh));
+}
+
+TEST(Mesh, TriangulateRegularGridInTilesGivesAPlanarTriangulation)
+{
+    // Prepare: a regular grid of nodes, the four corners of each cell are on a circle and either diagonal is Delaunay
+    const size_t numNodesPerSide = 40;
+    std::vector<meshkernel::Point> nodes;
+    for (size_t i = 0; i < numNodesPerSide; ++i)
+    {
+        for (size_t j = 0; j < numNodesPerSide; ++j)
+        {
+            nodes.push_back({static_cast<double>(i), static_cast<double>(j)});
+        }
+    }
+    const meshkernel::Polygons polygons;
+
+    // Execute
+    meshkernel::Mesh2D mesh(nodes, polygons, meshkernel::Projection::cartesian, 0);
+    meshkernel::Mesh2D tiledMesh(nodes, polygons, meshkernel::Projection::cartesian, 300);
+    mesh.Administrate(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    tiledMesh.Administrate(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+
+    // Assert: each cell is split by exactly one diagonal, no tile adds a crossing diagonal
+    const auto numCells = (numNodesPerSide - 1) * (numNodesPerSide - 1);
+    const auto numEdges = 3 * numCells + 2 * (numNodesPerSide - 1);
+    ASSERT_EQ(numEdges, mesh.GetNumEdges());
+    ASSERT_EQ(numEdges, tiledMesh.GetNumEdges());
+    ASSERT_EQ(2 * numCells, mesh.GetNumFaces());
+    ASSERT_EQ(2 * numCells, tiledMesh.GetNumFaces());
+}
+
 TEST(Mesh, TwoTrianglesDuplicatedEdges)
 {
     //1 Setup
@@ -313,6 +421,44 @@ TEST(Mesh, MeshBoundaryToPolygon)
     ASSERT_NEAR(0.0, meshBoundaryPolygon[4].y, tolerance);
 }
 
+TEST(Mesh, MeshBoundaryToPolygonClipsTheCachedBoundaryLoops)
+{
+    // Setup
+    const auto mesh = MakeRectangularMeshForTesting(4, 4, 10.0, meshkernel::Projection::cartesian);
+
+    // One closed loop made of the 12 boundary edges
+    const auto& boundaryLoops = mesh->GetBoundaryLoops();
+    ASSERT_EQ(1, boundaryLoops.size());
+    ASSERT_EQ(13, boundaryLoops[0].size());
+    ASSERT_EQ(boundaryLoops[0].front(), boundaryLoops[0].back());
+
+    // Execute, the polygon contains the two left columns of nodes
+    const std::vector<meshkernel::Point> polygonNodes{{-1.0, -1.0}, {15.0, -1.0}, {15.0, 31.0}, {-1.0, 31.0}, {-1.0, -1.0}};
+    const auto meshBoundaryPolygon = mesh->MeshBoundaryToPolygon(polygonNodes);
+
+    // Assert, a single polyline ending at the first nodes outside the polygon
+    ASSERT_EQ(9, meshBoundaryPolygon.size());
+    ASSERT_EQ(meshkernel::doubleMissingValue, meshBoundaryPolygon[8].x);
+    ASSERT_NEAR(20.0, meshBoundaryPolygon[0].x, 1e-12);
+    ASSERT_NEAR(20.0, meshBoundaryPolygon[7].x, 1e-12);
+    for (auto n = 1; n < 7; ++n)
+    {
+        ASSERT_LE(meshBoundaryPolygon[n].x, 10.0);
+    }
+
+    // An administration without renumbering keeps the loops, as moving nodes does
+    mesh->m_nodes[5] = {12.0, 12.0};
+    mesh->Administrate(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    ASSERT_FALSE(mesh->m_boundaryLoopsRequireUpdate);
+
+    // The loops are rebuilt after the topology changed: without the first face, the corner node is left on a hanging edge
+    mesh->DeleteEdge(mesh->FindEdge(0, 1));
+    const auto& updatedBoundaryLoops = mesh->GetBoundaryLoops();
+    ASSERT_EQ(1, updatedBoundaryLoops.size());
+    ASSERT_EQ(13, updatedBoundaryLoops[0].size());
+    ASSERT_EQ(updatedBoundaryLoops[0].end(), std::find(updatedBoundaryLoops[0].begin(), updatedBoundaryLoops[0].end(), 0));
+}
+
 TEST(Mesh, HangingEdge)
 {
     //1 Setup
@@ -675,6 +821,62 @@ TEST(Mesh, DeleteSmallTrianglesAtBoundaries)
     ASSERT_NEAR(398.59295654296875, mesh->m_nodes[3].y, tolerance);
 }
 
+TEST(Mesh, DeleteSmallFlowEdgesAndSmallTrianglesAtBoundaries)
+{
+    // Setup two squares, each split by a diagonal: the circumcenters of the triangles coincide
+    std::vector<meshkernel::Point> nodes{{0.0, 0.0}, {1.0, 0.0}, {2.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {2.0, 1.0}};
+    std::vector<meshkernel::Edge> edges{{0, 1}, {1, 2}, {3, 4}, {4, 5}, {0, 3}, {1, 4}, {2, 5}, {0, 4}, {1, 5}};
+    meshkernel::Mesh2D mesh(edges, nodes, meshkernel::Projection::cartesian);
+    ASSERT_EQ(4, mesh.GetNumFaces());
+
+    // Execute
+    mesh.DeleteSmallFlowEdgesAndSmallTrianglesAtBoundaries(0.1, 0.6);
+
+    // Assert, the diagonals are removed and the squares are preserved
+    ASSERT_EQ(2, mesh.GetNumFaces());
+    ASSERT_EQ(7, mesh.GetNumEdges());
+    ASSERT_EQ(4, mesh.m_numFacesNodes[0]);
+    ASSERT_EQ(4, mesh.m_numFacesNodes[1]);
+}
+
+TEST(Mesh, DeleteSmallFlowEdgesAndSmallTrianglesAtBoundariesMergesTheTrianglesLeftNextToQuads)
+{
+    // Setup two squares split by a diagonal, and a small right triangle at the boundary of the second square
+    const std::vector<meshkernel::Point> nodes{{0.0, 0.0}, {1.0, 0.0}, {2.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {2.0, 1.0}, {2.2, 0.0}};
+    const std::vector<meshkernel::Edge> edges{{0, 1}, {1, 2}, {3, 4}, {4, 5}, {0, 3}, {1, 4}, {2, 5}, {0, 4}, {1, 5}, {2, 6}, {5, 6}};
+    meshkernel::Mesh2D mesh(edges, nodes, meshkernel::Projection::cartesian);
+    meshkernel::Mesh2D trianglesOnlyMesh(edges, nodes, meshkernel::Projection::cartesian);
+    meshkernel::Mesh2D sequentialMesh(edges, nodes, meshkernel::Projection::cartesian);
+    ASSERT_EQ(5, mesh.GetNumFaces());
+
+    // Execute
+    mesh.DeleteSmallFlowEdgesAndSmallTrianglesAtBoundaries(0.1, 0.6);
+    trianglesOnlyMesh.DeleteSmallTrianglesAtBoundaries(0.6);
+    sequentialMesh.DeleteSmallFlowEdges(0.1);
+    sequentialMesh.DeleteSmallTrianglesAtBoundaries(0.6);
+
+    // Assert: the small triangle is merged only once the diagonals are removed, its neighbour is then a quad
+    ASSERT_EQ(7, trianglesOnlyMesh.GetNumNodes());
+    ASSERT_EQ(11, trianglesOnlyMesh.GetNumEdges());
+    ASSERT_EQ(5, trianglesOnlyMesh.GetNumFaces());
+
+    ASSERT_EQ(6, mesh.GetNumNodes());
+    ASSERT_EQ(7, mesh.GetNumEdges());
+    ASSERT_EQ(2, mesh.GetNumFaces());
+    ASSERT_EQ(3, mesh.m_numFacesNodes[0]);
+    ASSERT_EQ(4, mesh.m_numFacesNodes[1]);
+
+    // Assert: detecting both stages on a single administration gives the result of the stages run in sequence
+    ASSERT_EQ(sequentialMesh.GetNumNodes(), mesh.GetNumNodes());
+    ASSERT_EQ(sequentialMesh.GetNumEdges(), mesh.GetNumEdges());
+    ASSERT_EQ(sequentialMesh.GetNumFaces(), mesh.GetNumFaces());
+    for (size_t n = 0; n < mesh.GetNumNodes(); ++n)
+    {
+        ASSERT_EQ(sequentialMesh.m_nodes[n].x, mesh.m_nodes[n].x);
+        ASSERT_EQ(sequentialMesh.m_nodes[n].y, mesh.m_nodes[n].y);
+    }
+}
+
 TEST(Mesh, DeleteHangingEdge)
 {
     //1 Setup
@@ -711,3 +913,408 @@ TEST(Mesh, DeleteHangingEdge)
     // Assert
     ASSERT_EQ(0, hangingEdges.size());
 }
+
+TEST(Mesh, SetFlatCopiesResetsFaceNodesPadding)
+{
+    // Setup: a single quad
+    std::vector<meshkernel::Point> nodes;
+    nodes.push_back({0.0, 0.0});
+    nodes.push_back({10.0, 0.0});
+    nodes.push_back({10.0, 10.0});
+    nodes.push_back({0.0, 10.0});
+
+    std::vector<meshkernel::Edge> edges;
+    edges.push_back({0, 1});
+    edges.push_back({1, 2});
+    edges.push_back({2, 3});
+    edges.push_back({3, 0});
+
+    meshkernel::Mesh2D mesh(edges, nodes, meshkernel::Projection::cartesian);
+    mesh.SetFlatCopies(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    ASSERT_EQ(1, mesh.GetNumFaces());
+    ASSERT_EQ(3, mesh.m_faceNodes[3]);
+
+    // Execute: the quad becomes a triangle and the flat copies are refreshed
+    mesh.DeleteNode(3);
+    mesh.ConnectNodes(2, 0);
+    mesh.SetFlatCopies(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+
+    // Assert: the node slot of the deleted corner is padding again
+    ASSERT_EQ(1, mesh.GetNumFaces());
+    ASSERT_EQ(3, mesh.m_numFacesNodes[0]);
+    ASSERT_EQ(meshkernel::intMissingValue, mesh.m_faceNodes[3]);
+}
+
+TEST(Mesh, ComputeEdgesLengthsAndCenters)
+{
+    // Setup
+    const auto mesh = MakeRectangularMeshForTesting(4, 3, 2.0, meshkernel::Projection::cartesian, {1.0, 1.0});
+    mesh->m_nodes[5].x += 0.5;
+
+    // Execute
+    mesh->ComputeEdgesLengths();
+    mesh->ComputeEdgesCenters();
+
+    // Assert: the cartesian kernels match the point-wise operations
+    ASSERT_EQ(mesh->GetNumEdges(), mesh->m_edgeLengths.size());
+    ASSERT_EQ(mesh->GetNumEdges(), mesh->m_edgesCenters.size());
+    for (auto e = 0; e < mesh->GetNumEdges(); ++e)
+    {
+        const meshkernel::Point firstNode = mesh->m_nodes[mesh->m_edges[e].first];
+        const meshkernel::Point secondNode = mesh->m_nodes[mesh->m_edges[e].second];
+        const auto middlePoint = meshkernel::ComputeMiddlePoint(firstNode, secondNode, meshkernel::Projection::cartesian);
+        ASSERT_NEAR(meshkernel::ComputeDistance(firstNode, secondNode, meshkernel::Projection::cartesian), mesh->m_edgeLengths[e], 1e-12);
+        ASSERT_NEAR(middlePoint.x, mesh->m_edgesCenters[e].x, 1e-12);
+        ASSERT_NEAR(middlePoint.y, mesh->m_edgesCenters[e].y, 1e-12);
+    }
+}
+
+TEST(Mesh, NodeCoordinatesAssignThroughTheCoordinateArrays)
+{
+    // Setup
+    meshkernel::NodeCoordinates nodes(std::vector<meshkernel::Point>{{0.0, 1.0}, {2.0, 3.0}, {4.0, 5.0}});
+
+    // Execute: a node is modified through its view, a copied point is not
+    const meshkernel::Point firstNode = nodes[0];
+    nodes[0] = nodes[2];
+    nodes[1].y += 1.0;
+    nodes[2] = {meshkernel::doubleMissingValue, meshkernel::doubleMissingValue};
+
+    // Assert
+    ASSERT_EQ(0.0, firstNode.x);
+    ASSERT_EQ(1.0, firstNode.y);
+    ASSERT_EQ(4.0, nodes.GetX()[0]);
+    ASSERT_EQ(5.0, nodes.GetY()[0]);
+    ASSERT_EQ(4.0, nodes.GetY()[1]);
+
+    nodes.RemoveInvalid();
+    ASSERT_EQ(2, nodes.size());
+    ASSERT_EQ(nodes.GetX().data(), nodes.GetXData());
+    ASSERT_EQ(2.0, nodes.GetX()[1]);
+}
+
+TEST(Mesh, CurvilinearGridConversionMatchesFaceSearch)
+{
+    // Setup: a clockwise oriented grid with a missing interior node and a missing corner
+    meshkernel::CurvilinearGrid curvilinearGrid(5, 4);
+    for (auto m = 0; m < curvilinearGrid.GetNumMNodes(); ++m)
+    {
+        for (auto n = 0; n < curvilinearGrid.GetNumNNodes(); ++n)
+        {
+            curvilinearGrid.Node(m, n) = {m * 10.0 + n, -n * 5.0};
+        }
+    }
+    curvilinearGrid.Node(2, 2) = {meshkernel::doubleMissingValue, meshkernel::doubleMissingValue};
+    curvilinearGrid.Node(5, 4) = {meshkernel::doubleMissingValue, meshkernel::doubleMissingValue};
+
+    // Execute
+    meshkernel::Mesh2D mesh(curvilinearGrid, meshkernel::Projection::cartesian);
+    auto referenceMesh = mesh;
+    referenceMesh.Administrate(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+
+    // Assert: same faces as the recursive face search, stored counterclockwise
+    ASSERT_EQ(28, mesh.GetNumNodes());
+    ASSERT_EQ(43, mesh.GetNumEdges());
+    ASSERT_EQ(15, mesh.GetNumFaces());
+    ASSERT_EQ(referenceMesh.GetNumFaces(), mesh.GetNumFaces());
+    ASSERT_EQ(referenceMesh.m_nodesTypes, mesh.m_nodesTypes);
+    ASSERT_EQ(referenceMesh.m_edgesNumFaces, mesh.m_edgesNumFaces);
+
+    const double tolerance = 1e-9;
+    double totalArea = 0.0;
+    double referenceTotalArea = 0.0;
+    for (auto f = 0; f < mesh.GetNumFaces(); ++f)
+    {
+        totalArea += mesh.m_faceArea[f];
+        referenceTotalArea += referenceMesh.m_faceArea[f];
+
+        std::vector<meshkernel::Point> polygon;
+        for (const auto& node : mesh.m_facesNodes[f])
+        {
+            polygon.emplace_back(mesh.m_nodes[node]);
+        }
+        polygon.emplace_back(polygon.front());
+        double area;
+        meshkernel::Point centerOfMass;
+        bool isCounterClockWise;
+        meshkernel::FaceAreaAndCenterOfMass(polygon, meshkernel::Projection::cartesian, area, centerOfMass, isCounterClockWise);
+        ASSERT_TRUE(isCounterClockWise);
+
+        for (auto e = 0; e < mesh.m_facesEdges[f].size(); ++e)
+        {
+            const auto& edge = mesh.m_edges[mesh.m_facesEdges[f][e]];
+            const auto node = mesh.m_facesNodes[f][e];
+            ASSERT_TRUE(edge.first == node || edge.second == node);
+        }
+    }
+    ASSERT_NEAR(referenceTotalArea, totalArea, tolerance);
+}
+
+TEST(Mesh, MaskNodesInPolygonsOnCurvilinearGridConversion)
+{
+    // Setup
+    meshkernel::CurvilinearGrid curvilinearGrid(4, 4);
+    for (auto m = 0; m < curvilinearGrid.GetNumMNodes(); ++m)
+    {
+        for (auto n = 0; n < curvilinearGrid.GetNumNNodes(); ++n)
+        {
+            curvilinearGrid.Node(m, n) = {m * 10.0, n * 10.0};
+        }
+    }
+    meshkernel::Mesh2D mesh(curvilinearGrid, meshkernel::Projection::cartesian);
+    ASSERT_EQ(mesh.GetNumNodes(), mesh.m_nodeMask.size());
+
+    const std::vector<meshkernel::Point> polygonNodes{{-5.0, -5.0}, {15.0, -5.0}, {15.0, 15.0}, {-5.0, 15.0}, {-5.0, -5.0}};
+    const meshkernel::Polygons polygons(polygonNodes, meshkernel::Projection::cartesian);
+
+    // Execute
+    mesh.MaskNodesInPolygons(polygons, true);
+
+    // Assert: the nodes at (0,0), (0,10), (10,0) and (10,10) are masked
+    ASSERT_EQ(mesh.GetNumNodes(), mesh.m_nodeMask.size());
+    ASSERT_EQ(4, std::count(mesh.m_nodeMask.begin(), mesh.m_nodeMask.end(), 1));
+    for (auto n = 0; n < mesh.GetNumNodes(); ++n)
+    {
+        const auto isInside = mesh.m_nodes[n].x < 15.0 && mesh.m_nodes[n].y < 15.0;
+        ASSERT_EQ(isInside ? 1 : 0, mesh.m_nodeMask[n]);
+    }
+}
+
+TEST(Mesh, ShrinkReleasesCachesAndFlatCopies)
+{
+    // Setup
+    auto mesh = MakeRectangularMeshForTesting(10, 10, 10, meshkernel::Projection::cartesian, {0.0, 0.0});
+    mesh->SetFlatCopies(meshkernel::Mesh2D::AdministrationOptions::AdministrateMeshEdgesAndFaces);
+    mesh->BuildTree(meshkernel::MeshLocations::Nodes);
+
+    const auto memoryUsage = mesh->GetMemoryUsage();
+    const auto& subsystems = memoryUsage.GetSubsystems();
+    ASSERT_GE(subsystems.at("Mesh nodes"), mesh->GetNumNodes() * sizeof(meshkernel::Point));
+    ASSERT_GT(subsystems.at("Mesh flat copies"), 0);
+    ASSERT_GT(subsystems.at("Mesh R-trees"), 0);
+
+    // Execute
+    mesh->Shrink();
+
+    // Assert the caches are released and the topology is kept
+    const auto shrunkMemoryUsage = mesh->GetMemoryUsage();
+    ASSERT_EQ(0, shrunkMemoryUsage.GetSubsystems().at("Mesh flat copies"));
+    ASSERT_EQ(0, shrunkMemoryUsage.GetSubsystems().at("Mesh R-trees"));
+    ASSERT_EQ(subsystems.at("Mesh nodes"), shrunkMemoryUsage.GetSubsystems().at("Mesh nodes"));
+    ASSERT_LT(shrunkMemoryUsage.GetTotal(), memoryUsage.GetTotal());
+
+    // The R-tree is rebuilt on demand
+    mesh->BuildTree(meshkernel::MeshLocations::Nodes);
+    mesh->SearchNearestNeighbors({0.0, 0.0}, meshkernel::MeshLocations::Nodes);
+    ASSERT_EQ(1, mesh->GetNumNearestNeighbors(meshkernel::MeshLocations::Nodes));
+}
+
+TEST(Mesh, QualityMetricsOnRegularMesh)
+{
+    // Setup: 3x3 square faces with 12 internal edges
+    const auto mesh = MakeRectangularMeshForTesting(4, 4, 10.0, meshkernel::Projection::cartesian);
+
+    // Execute
+    meshkernel::MeshQuality meshQuality(mesh, 5);
+    meshQuality.Compute();
+
+    // Assert
+    const auto& orthogonality = meshQuality.GetStatistics(meshkernel::MeshQuality::Metric::Orthogonality);
+    ASSERT_EQ(12, orthogonality.m_numValues);
+    ASSERT_NEAR(0.0, orthogonality.m_maximum, 1e-12);
+    ASSERT_EQ(5, orthogonality.m_histogram.size());
+    ASSERT_EQ(12, orthogonality.m_histogram[0]);
+
+    const auto& smoothness = meshQuality.GetStatistics(meshkernel::MeshQuality::Metric::Smoothness);
+    ASSERT_EQ(12, smoothness.m_numValues);
+    ASSERT_NEAR(1.0, smoothness.m_mean, 1e-12);
+
+    const auto& flowEdgeLengthRatio = meshQuality.GetStatistics(meshkernel::MeshQuality::Metric::FlowEdgeLengthRatio);
+    ASSERT_EQ(12, flowEdgeLengthRatio.m_numValues);
+    ASSERT_NEAR(1.0, flowEdgeLengthRatio.m_minimum, 1e-12);
+    ASSERT_TRUE(meshQuality.GetEdgesCrossingSmallFlowEdges(0.9).empty());
+    ASSERT_EQ(12, meshQuality.GetEdgesCrossingSmallFlowEdges(1.1).size());
+
+    ASSERT_EQ(mesh->GetNumEdges(), meshQuality.GetValues(meshkernel::MeshQuality::Metric::AspectRatio).size());
+    ASSERT_TRUE(meshQuality.GetObtuseTriangles().empty());
+}
+
+TEST(Mesh, QualityMetricsOnSkewedMesh)
+{
+    // Setup: a row of three quadrilaterals with areas 110, 190 and 100, the first internal edge skewed
+    std::vector<meshkernel::Point> nodes{{0.0, 0.0}, {10.0, 0.0}, {30.0, 0.0}, {40.0, 0.0}, {0.0, 10.0}, {12.0, 10.0}, {30.0, 10.0}, {40.0, 10.0}};
+    std::vector<meshkernel::Edge> edges{{0, 1}, {1, 2}, {2, 3}, {4, 5}, {5, 6}, {6, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}};
+    const auto mesh = std::make_shared<meshkernel::Mesh2D>(edges, nodes, meshkernel::Projection::cartesian);
+    ASSERT_EQ(3, mesh->GetNumFaces());
+
+    // Execute
+    const auto orthogonality = mesh->GetOrthogonality();
+    const auto smoothness = mesh->GetSmoothness();
+    meshkernel::MeshQuality meshQuality(mesh, 5);
+    meshQuality.Compute();
+
+    // Assert: only the internal edges have values
+    constexpr double tolerance = 1e-9;
+    ASSERT_EQ(edges.size(), orthogonality.size());
+    ASSERT_EQ(edges.size(), smoothness.size());
+    for (auto e = 0; e < 7; ++e)
+    {
+        ASSERT_EQ(meshkernel::doubleMissingValue, orthogonality[e]);
+        ASSERT_EQ(meshkernel::doubleMissingValue, smoothness[e]);
+    }
+    ASSERT_EQ(meshkernel::doubleMissingValue, orthogonality[9]);
+    ASSERT_EQ(meshkernel::doubleMissingValue, smoothness[9]);
+
+    // the face circumcenters lie on y = 5, the skewed edge has direction (2, 10)
+    ASSERT_NEAR(1.0 / std::sqrt(26.0), orthogonality[7], tolerance);
+    ASSERT_NEAR(0.0, orthogonality[8], tolerance);
+    // the smoothness is the ratio of the larger to the smaller face area
+    ASSERT_NEAR(190.0 / 110.0, smoothness[7], tolerance);
+    ASSERT_NEAR(190.0 / 100.0, smoothness[8], tolerance);
+
+    const auto& orthogonalityStatistics = meshQuality.GetStatistics(meshkernel::MeshQuality::Metric::Orthogonality);
+    ASSERT_EQ(2, orthogonalityStatistics.m_numValues);
+    ASSERT_NEAR(1.0 / std::sqrt(26.0), orthogonalityStatistics.m_maximum, tolerance);
+    ASSERT_NEAR(1.0 / std::sqrt(26.0), meshQuality.GetValues(meshkernel::MeshQuality::Metric::Orthogonality)[7], tolerance);
+
+    const auto& smoothnessStatistics = meshQuality.GetStatistics(meshkernel::MeshQuality::Metric::Smoothness);
+    ASSERT_EQ(2, smoothnessStatistics.m_numValues);
+    ASSERT_NEAR(1.9, smoothnessStatistics.m_maximum, tolerance);
+    ASSERT_NEAR(190.0 / 110.0, meshQuality.GetValues(meshkernel::MeshQuality::Metric::Smoothness)[7], tolerance);
+}
+
+TEST(Mesh, SmoothnessIsMissingNextToDegeneratedFaces)
+{
+    // Setup: two unit quadrilaterals, the area of the second one set below minimumCellArea
+    // (the administration clamps the face areas to minimumFaceArea, degenerated faces only come from modified areas)
+    std::vector<meshkernel::Point> nodes{{0.0, 0.0}, {1.0, 0.0}, {2.0, 0.0}, {0.0, 1.0}, {1.0, 1.0}, {2.0, 1.0}};
+    std::vector<meshkernel::Edge> edges{{0, 1}, {1, 2}, {3, 4}, {4, 5}, {0, 3}, {1, 4}, {2, 5}};
+    const auto mesh = std::make_shared<meshkernel::Mesh2D>(edges, nodes, meshkernel::Projection::cartesian);
+    ASSERT_EQ(2, mesh->GetNumFaces());
+    ASSERT_NEAR(1.0, mesh->GetSmoothness()[5], 1e-12);
+    mesh->m_faceArea[1] = 0.0;
+
+    // Execute
+    const auto smoothness = mesh->GetSmoothness();
+
+    // Assert: the shared edge has no area ratio
+    ASSERT_EQ(meshkernel::doubleMissingValue, smoothness[5]);
+}
+
+namespace
+{
+    /// @brief Makes two disjoint meshes from curvilinear grids, with an administration from the structured faces
+    std::pair<meshkernel::Mesh2D, meshkernel::Mesh2D> MakeDisjointMeshesToAdd()
+    {
+        meshkernel::CurvilinearGrid firstGrid(3, 4);
+        meshkernel::CurvilinearGrid secondGrid(2, 2);
+        for (auto m = 0; m < firstGrid.GetNumMNodes(); ++m)
+        {
+            for (auto n = 0; n < firstGrid.GetNumNNodes(); ++n)
+            {
+                firstGrid.Node(m, n) = {m * 10.0, n * 10.0};
+            }
+        }
+        for (auto m = 0; m < secondGrid.GetNumMNodes(); ++m)
+        {
+            for (auto n = 0; n < secondGrid.GetNumNNodes(); ++n)
+            {
+                secondGrid.Node(m, n) = {100.0 + m * 5.0 + n, n * 5.0};
+            }
+        }
+        return {meshkernel::Mesh2D(firstGrid, meshkernel::Projection::cartesian),
+                meshkernel::Mesh2D(secondGrid, meshkernel::Projection::cartesian)};
+    }
+
+    /// @brief Makes the sum of two meshes with a face search on the whole mesh
+    meshkernel::Mesh2D MakeReferenceSum(const meshkernel::Mesh2D& firstMesh, const meshkernel::Mesh2D& secondMesh)
+    {
+        auto nodes = firstMesh.m_nodes.ToPoints();
+        auto edges = firstMesh.m_edges;
+        for (const auto& [firstNode, secondNode] : secondMesh.m_edges)
+        {
+            edges.emplace_back(firstNode + nodes.size(), secondNode + nodes.size());
+        }
+        const auto secondNodes = secondMesh.m_nodes.ToPoints();
+        nodes.insert(nodes.end(), secondNodes.begin(), secondNodes.end());
+        return meshkernel::Mesh2D(edges, nodes, meshkernel::Projection::cartesian);
+    }
+
+    /// @brief Asserts two meshes have the same administration, up to the face order
+    void AssertSameAdministration(const meshkernel::Mesh2D& referenceMesh, const meshkernel::Mesh2D& mesh)
+    {
+        ASSERT_EQ(referenceMesh.GetNumNodes(), mesh.GetNumNodes());
+        ASSERT_EQ(referenceMesh.GetNumEdges(), mesh.GetNumEdges());
+        ASSERT_EQ(referenceMesh.GetNumFaces(), mesh.GetNumFaces());
+        ASSERT_EQ(referenceMesh.m_edges, mesh.m_edges);
+        ASSERT_EQ(referenceMesh.m_nodesNumEdges, mesh.m_nodesNumEdges);
+        ASSERT_EQ(referenceMesh.m_nodesEdges, mesh.m_nodesEdges);
+        ASSERT_EQ(referenceMesh.m_nodesTypes, mesh.m_nodesTypes);
+        ASSERT_EQ(referenceMesh.m_edgesNumFaces, mesh.m_edgesNumFaces);
+        ASSERT_EQ(mesh.GetNumNodes(), mesh.m_nodeMask.size());
+
+        auto recomputedMesh = mesh;
+        recomputedMesh.ComputeFaceCircumcentersMassCentersAndAreas(true);
+
+        const double tolerance = 1e-9;
+        const auto sorted = [](std::vector<size_t> indices) {
+            std::sort(indices.begin(), indices.end());
+            return indices;
+        };
+        for (auto f = 0; f < mesh.GetNumFaces(); ++f)
+        {
+            // each face is found in the reference mesh, with the same nodes, edges and geometry
+            size_t referenceFaceIndex = meshkernel::sizetMissingValue;
+            for (auto r = 0; r < referenceMesh.GetNumFaces(); ++r)
+            {
+                if (sorted(referenceMesh.m_facesNodes[r]) == sorted(mesh.m_facesNodes[f]))
+                {
+                    referenceFaceIndex = r;
+                }
+            }
+            ASSERT_NE(meshkernel::sizetMissingValue, referenceFaceIndex);
+            ASSERT_EQ(sorted(referenceMesh.m_facesEdges[referenceFaceIndex]), sorted(mesh.m_facesEdges[f]));
+            ASSERT_NEAR(referenceMesh.m_faceArea[referenceFaceIndex], mesh.m_faceArea[f], tolerance);
+            ASSERT_NEAR(referenceMesh.m_facesMassCenters[referenceFaceIndex].x, mesh.m_facesMassCenters[f].x, tolerance);
+            ASSERT_NEAR(referenceMesh.m_facesMassCenters[referenceFaceIndex].y, mesh.m_facesMassCenters[f].y, tolerance);
+
+            // the circumcenters are iterated from the first face node, which differs from the face search
+            ASSERT_NEAR(recomputedMesh.m_facesCircumcenters[f].x, mesh.m_facesCircumcenters[f].x, tolerance);
+            ASSERT_NEAR(recomputedMesh.m_facesCircumcenters[f].y, mesh.m_facesCircumcenters[f].y, tolerance);
+
+            for (const auto& edge : mesh.m_facesEdges[f])
+            {
+                const auto& edgeFaces = mesh.m_edgesFaces[edge];
+                ASSERT_TRUE(edgeFaces[0] == f || edgeFaces[1] == f);
+            }
+        }
+    }
+} // namespace
+
+TEST(Mesh, AddMeshesAppendsTheAdministrationOfTheSecondMesh)
+{
+    // Setup
+    auto [mesh, secondMesh] = MakeDisjointMeshesToAdd();
+    const auto referenceMesh = MakeReferenceSum(mesh, secondMesh);
+
+    // Execute
+    mesh += secondMesh;
+
+    // Assert: the same administration as a face search on the whole mesh
+    AssertSameAdministration(referenceMesh, mesh);
+}
+
+TEST(Mesh, AddMeshesAfterMovingANodeRecomputesTheFaceGeometry)
+{
+    // Setup: moving a node changes the geometry, not the topology
+    auto [mesh, secondMesh] = MakeDisjointMeshesToAdd();
+    mesh.MoveNode({12.0, 13.0}, 5);
+    secondMesh.MoveNode({107.0, 6.0}, 5);
+    const auto referenceMesh = MakeReferenceSum(mesh, secondMesh);
+
+    // Execute
+    mesh += secondMesh;
+
+    // Assert
+    AssertSameAdministration(referenceMesh, mesh);
+}
@@ -74,6 +74,45 @@ TEST(Polygons, CreatePointsInPolygons)
     ASSERT_NEAR(471.38037100000003, generatedPoints[0][4].y, tolerance);
 }
 
+TEST(Polygons, CreatePointsInMultiplePolygonsInParallel)
+{
+    // Prepare: three closed polygons and a polyline, which is skipped
+    const std::vector<meshkernel::Point> firstPolygon{{0.0, 0.0}, {10.0, 0.0}, {10.0, 10.0}, {0.0, 10.0}, {0.0, 0.0}};
+    const std::vector<meshkernel::Point> secondPolygon{{20.0, 0.0}, {40.0, 0.0}, {30.0, 15.0}, {20.0, 0.0}};
+    const std::vector<meshkernel::Point> thirdPolygon{{0.0, 20.0}, {5.0, 20.0}, {5.0, 40.0}, {0.0, 40.0}, {0.0, 20.0}};
+    const std::vector<meshkernel::Point> polyline{{50.0, 0.0}, {60.0, 0.0}, {60.0, 10.0}};
+
+    std::vector<meshkernel::Point> nodes;
+    for (const auto& part : {firstPolygon, polyline, secondPolygon, thirdPolygon})
+    {
+        if (!nodes.empty())
+        {
+            nodes.emplace_back(meshkernel::doubleMissingValue, meshkernel::doubleMissingValue);
+        }
+        nodes.insert(nodes.end(), part.begin(), part.end());
+    }
+    const meshkernel::Polygons polygons(nodes, meshkernel::Projection::cartesian);
+
+    // Execute
+    const auto generatedPoints = polygons.ComputePointsInPolygons();
+
+    // Assert, the points of each polygon are the same as when the polygon is processed alone
+    ASSERT_EQ(3, generatedPoints.size());
+    size_t index = 0;
+    for (const auto& polygon : {firstPolygon, secondPolygon, thirdPolygon})
+    {
+        const auto expectedPoints = meshkernel::Polygons(polygon, meshkernel::Projection::cartesian).ComputePointsInPolygons();
+        ASSERT_EQ(1, expectedPoints.size());
+        ASSERT_EQ(expectedPoints[0].size(), generatedPoints[index].size());
+        for (size_t i = 0; i < expectedPoints[0].size(); ++i)
+        {
+            ASSERT_EQ(expectedPoints[0][i].x, generatedPoints[index][i].x);
+            ASSERT_EQ(expectedPoints[0][i].y, generatedPoints[index][i].y);
+        }
+        index++;
+    }
+}
+
 TEST(Polygons, RefinePolygon)
 {
     // Prepare
@@ -159,6 +198,27 @@ TEST(Polygons, RefinePolygonOneSide)
     ASSERT_NEAR(0.0, refinedPolygon[6].y, tolerance);
 }
 
+TEST(Polygons, RefinePolygonOneSideOfTheSecondPolygon)
+{
+    // Prepare: the refined part only depends on the nodes of the second polygon
+    std::vector<meshkernel::Point> nodes{{10, 10}, {20, 10}, {20, 20}, {10, 10}, {meshkernel::doubleMissingValue, meshkernel::doubleMissingValue}, {0, 0}, {3, 0}, {3, 3}, {0, 3}, {0, 0}};
+    meshkernel::Polygons polygons(nodes, meshkernel::Projection::cartesian);
+
+    // Execute
+    const auto refinedPolygon = polygons.RefineFirstPolygon(5, 6, 1.0);
+
+    // Assert, the refined second polygon is returned
+    ASSERT_EQ(7, refinedPolygon.size());
+    const double tolerance = 1e-5;
+    const std::vector<double> expectedX{0.0, 1.0, 2.0, 3.0, 3.0, 0.0, 0.0};
+    const std::vector<double> expectedY{0.0, 0.0, 0.0, 0.0, 3.0, 3.0, 0.0};
+    for (size_t i = 0; i < refinedPolygon.size(); ++i)
+    {
+        ASSERT_NEAR(expectedX[i], refinedPolygon[i].x, tolerance);
+        ASSERT_NEAR(expectedY[i], refinedPolygon[i].y, tolerance);
+    }
+}
+
 TEST(Polygons, RefinePolygonLongerSquare)
 {
     // Prepare
@@ -93,3 +93,57 @@ TEST(Splines, SplineIntersection)
     ASSERT_NEAR(0.485216749175026, secondSplineRatio, tolerance);
     ASSERT_NEAR(-0.996215079635043, crossProductIntersection, tolerance);
 }
+
+TEST(Splines, SplineLengthFromStartMatchesIntegration)
+{
+    std::vector<meshkernel::Point> splineNodes;
+    splineNodes.push_back(meshkernel::Point{212.001953125000, 155.627197265625});
+    splineNodes.push_back(meshkernel::Point{529.253906250000, 432.379974365234});
+    splineNodes.push_back(meshkernel::Point{930.506469726562, 453.380187988281});
+
+    meshkernel::Splines splines(meshkernel::Projection::cartesian);
+    splines.AddSpline(splineNodes, 0, splineNodes.size());
+
+    const double tolerance = 1e-8;
+    for (const auto accountForCurvature : {false, true})
+    {
+        for (const auto endIndex : {0.0, 0.05, 0.3, 0.7345, 1.0, 1.55, 2.0})
+        {
+            const auto integratedLength = splines.GetSplineLength(0, 0.0, endIndex, 10, accountForCurvature, 50.0, 0.1);
+            const auto tabulatedLength = splines.GetSplineLengthFromStart(0, endIndex, accountForCurvature, 50.0);
+            ASSERT_NEAR(integratedLength, tabulatedLength, tolerance);
+        }
+    }
+
+    // The table is recomputed when the spline nodes change
+    splines.m_splineNodes[0][2] = meshkernel::Point{1030.506469726562, 553.380187988281};
+    meshkernel::Splines::SecondOrderDerivative(splines.m_splineNodes[0], splines.m_splineNodes[0].size(), splines.m_splineDerivatives[0]);
+    splines.InvalidateArcLengthTable(0);
+    ASSERT_NEAR(splines.GetSplineLength(0, 0.0, 1.75, 10, false, 1.0, 0.1), splines.GetSplineLengthFromStart(0, 1.75, false, 1.0), tolerance);
+}
+
+TEST(Splines, FindCrossingCandidates)
+{
+    meshkernel::Splines splines(meshkernel::Projection::cartesian);
+
+    std::vector<meshkernel::Point> firstSpline{{152.001571655273, 86.6264953613281},
+                                               {374.752960205078, 336.378997802734},
+                                               {850.255920410156, 499.130676269531}};
+    splines.AddSpline(firstSpline, 0, firstSpline.size());
+
+    std::vector<meshkernel::Point> secondSpline{{72.5010681152344, 391.129577636719},
+                                                {462.503479003906, 90.3765411376953}};
+    splines.AddSpline(secondSpline, 0, secondSpline.size());
+
+    // Far away from the other splines
+    std::vector<meshkernel::Point> thirdSpline{{2000.0, 2000.0},
+                                               {2100.0, 2100.0}};
+    splines.AddSpline(thirdSpline, 0, thirdSpline.size());
+
+    const auto crossingCandidates = splines.FindCrossingCandidates();
+
+    ASSERT_EQ(3, crossingCandidates.size());
+    ASSERT_EQ(std::vector<size_t>{1}, crossingCandidates[0]);
+    ASSERT_EQ(std::vector<size_t>{0}, crossingCandidates[1]);
+    ASSERT_TRUE(crossingCandidates[2].empty());
+}
@@ -1,8 +1,11 @@
+#include <cmath>
 #include <gtest/gtest.h>
+#include <random>
 
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/TriangulationInterpolation.hpp>
-#include <Meshkernel/Entities.hpp>
+#include <MeshKernel/TriangulationWrapper.hpp>
+#include <MeshKernel/Entities.hpp>
 #include <TestUtils/MakeMeshes.hpp>
 #include <TestUtils/SampleFileReader.hpp>
 
@@ -13,7 +16,8 @@ TEST(TriangleInterpolation, InterpolateOnNodes)
     auto mesh = ReadLegacyMeshFromFile("../../../../tests/data/TriangleInterpolationTests/simple_grid_net.nc");
     ASSERT_GT(mesh->GetNumNodes(), 0);
 
-    meshkernel::TriangulationInterpolation triangulationInterpolation(mesh->m_nodes, samples, meshkernel::Projection::cartesian);
+    const auto nodes = mesh->m_nodes.ToPoints();
+    meshkernel::TriangulationInterpolation triangulationInterpolation(nodes, samples, meshkernel::Projection::cartesian);
     triangulationInterpolation.Compute();
 
     const auto results = triangulationInterpolation.GetResults();
@@ -122,3 +126,198 @@ TEST(TriangleInterpolation, InterpolateOnFacesUsingSphericalAccurateOption)
     ASSERT_NEAR(-26.988893382269104, results[18], tolerance);
     ASSERT_NEAR(-29.549320886988440, results[19], tolerance);
 }
+
+TEST(TriangleInterpolation, TriangulationWrapperProducesConsistentConnectivity)
+{
+    // Set up: a square with a node in the middle
+    std::vector<meshkernel::Point> nodes{{0.0, 0.0}, {10.0, 0.0}, {10.0, 10.0}, {0.0, 10.0}, {5.0, 4.0}};
+
+    // Execute
+    meshkernel::TriangulationWrapper triangulationWrapper;
+    triangulationWrapper.Compute(nodes,
+                                 meshkernel::TriangulationWrapper::TriangulationOptions::TriangulatePointsAndGenerateFaces,
+                                 0.0);
+
+    // Assert: four triangles, four boundary edges and four internal edges
+    ASSERT_EQ(4, triangulationWrapper.m_numFaces);
+    ASSERT_EQ(8, triangulationWrapper.m_numEdges);
+
+    size_t numBoundaryEdges = 0;
+    for (size_t e = 0; e < triangulationWrapper.m_numEdges; ++e)
+    {
+        const auto firstFace = triangulationWrapper.GetEdgeFace(e, 0);
+        const auto secondFace = triangulationWrapper.GetEdgeFace(e, 1);
+        ASSERT_LT(firstFace, triangulationWrapper.m_numFaces);
+        if (secondFace == meshkernel::sizetMissingValue)
+        {
+            numBoundaryEdges++;
+            continue;
+        }
+        ASSERT_LT(firstFace, secondFace);
+    }
+    ASSERT_EQ(4, numBoundaryEdges);
+
+    for (size_t f = 0; f < triangulationWrapper.m_numFaces; ++f)
+    {
+        for (size_t n = 0; n < meshkernel::numNodesInTriangle; ++n)
+        {
+            // each face edge connects two nodes of the face and lists the face among its faces
+            const auto edge = triangulationWrapper.GetFaceEdge(f, n);
+            ASSERT_LT(edge, triangulationWrapper.m_numEdges);
+            ASSERT_TRUE(triangulationWrapper.GetEdgeFace(edge, 0) == f || triangulationWrapper.GetEdgeFace(edge, 1) == f);
+            for (size_t i = 0; i < 2; ++i)
+            {
+                const auto node = triangulationWrapper.GetEdgeNode(edge, i);
+                ASSERT_TRUE(node == triangulationWrapper.GetFaceNode(f, 0) || node == triangulationWrapper.GetFaceNode(f, 1) || node == triangulationWrapper.GetFaceNode(f, 2));
+            }
+        }
+        ASSERT_LT(triangulationWrapper.GetFaceEdge(f, 0), triangulationWrapper.GetFaceEdge(f, 1));
+        ASSERT_LT(triangulationWrapper.GetFaceEdge(f, 1), triangulationWrapper.GetFaceEdge(f, 2));
+    }
+}
+
+TEST(TriangleInterpolation, InterpolateInTilesMatchesSingleTriangulation)
+{
+    // Set up: perturbed regular samples of a non linear function, and random locations
+    // inside the sample cloud (the thin convex hull triangles along its boundary may differ between tiles)
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> perturbation(-0.2, 0.2);
+    std::vector<meshkernel::Sample> samples;
+    for (auto i = 0; i < 50; ++i)
+    {
+        for (auto j = 0; j < 50; ++j)
+        {
+            const double x = i + perturbation(generator);
+            const double y = j + perturbation(generator);
+            samples.push_back({x, y, x * y + std::sin(x)});
+        }
+    }
+    std::uniform_real_distribution<double> coordinate(0.5, 48.5);
+    std::vector<meshkernel::Point> locations;
+    for (auto i = 0; i < 2000; ++i)
+    {
+        locations.push_back({coordinate(generator), coordinate(generator)});
+    }
+
+    // Execute
+    meshkernel::TriangulationInterpolation triangulationInterpolation(locations, samples, meshkernel::Projection::cartesian, 0);
+    triangulationInterpolation.Compute();
+    meshkernel::TriangulationInterpolation tiledTriangulationInterpolation(locations, samples, meshkernel::Projection::cartesian, 400);
+    tiledTriangulationInterpolation.Compute();
+
+    // Assert
+    const auto& results = triangulationInterpolation.GetResults();
+    const auto& tiledResults = tiledTriangulationInterpolation.GetResults();
+    ASSERT_EQ(results.size(), tiledResults.size());
+    size_t numInterpolated = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        ASSERT_NEAR(results[i], tiledResults[i], 1e-9);
+        if (results[i] != meshkernel::doubleMissingValue)
+        {
+            numInterpolated++;
+        }
+    }
+    ASSERT_GT(numInterpolated, 0);
+}
+
+TEST(TriangleInterpolation, InterpolateClusteredSamplesInTilesMatchesSingleTriangulation)
+{
+    // Set up: dense sample clusters in a sparse background and locations spread over the whole domain,
+    // so that many locations lie in large triangles crossing several tiles
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> background(0.0, 100.0);
+    std::normal_distribution<double> cluster(0.0, 2.0);
+    std::vector<meshkernel::Sample> samples;
+    const auto addSample = [&samples](double x, double y) { samples.push_back({x, y, x * y + std::sin(x)}); };
+    for (auto i = 0; i < 150; ++i)
+    {
+        addSample(background(generator), background(generator));
+    }
+    const std::vector<meshkernel::Point> clusterCenters{{25.0, 30.0}, {75.0, 60.0}};
+    for (const auto& center : clusterCenters)
+    {
+        for (auto i = 0; i < 1000; ++i)
+        {
+            addSample(center.x + cluster(generator), center.y + cluster(generator));
+        }
+    }
+    std::vector<meshkernel::Point> locations;
+    for (auto i = 0; i < 2000; ++i)
+    {
+        locations.push_back({background(generator), background(generator)});
+    }
+
+    // Execute
+    meshkernel::TriangulationInterpolation triangulationInterpolation(locations, samples, meshkernel::Projection::cartesian, 0);
+    triangulationInterpolation.Compute();
+    meshkernel::TriangulationInterpolation tiledTriangulationInterpolation(locations, samples, meshkernel::Projection::cartesian, 200);
+    tiledTriangulationInterpolation.Compute();
+
+    // Assert
+    const auto& results = triangulationInterpolation.GetResults();
+    const auto& tiledResults = tiledTriangulationInterpolation.GetResults();
+    ASSERT_EQ(results.size(), tiledResults.size());
+    size_t numInterpolated = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        ASSERT_NEAR(results[i], tiledResults[i], 1e-9);
+        if (results[i] != meshkernel::doubleMissingValue)
+        {
+            numInterpolated++;
+        }
+    }
+    ASSERT_GT(numInterpolated, 0);
+}
+
+TEST(TriangleInterpolation, InterpolateRegularGridInTilesUsesTheTrianglesOfEachCell)
+{
+    // Set up: samples on a regular grid, the four corners of each cell are on a circle and either diagonal is Delaunay
+    const auto nonLinearValue = [](double x, double y) { return x * y + std::sin(x); };
+    const auto linearValue = [](double x, double y) { return 2.0 * x + 3.0 * y + 1.0; };
+    std::vector<meshkernel::Sample> nonLinearSamples;
+    std::vector<meshkernel::Sample> linearSamples;
+    for (auto i = 0; i < 50; ++i)
+    {
+        for (auto j = 0; j < 50; ++j)
+        {
+            nonLinearSamples.push_back({static_cast<double>(i), static_cast<double>(j), nonLinearValue(i, j)});
+            linearSamples.push_back({static_cast<double>(i), static_cast<double>(j), linearValue(i, j)});
+        }
+    }
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> coordinate(0.0, 49.0);
+    std::vector<meshkernel::Point> locations;
+    for (auto i = 0; i < 2000; ++i)
+    {
+        locations.push_back({coordinate(generator), coordinate(generator)});
+    }
+
+    // Execute
+    meshkernel::TriangulationInterpolation tiledTriangulationInterpolation(locations, nonLinearSamples, meshkernel::Projection::cartesian, 400);
+    tiledTriangulationInterpolation.Compute();
+    meshkernel::TriangulationInterpolation linearTriangulationInterpolation(locations, linearSamples, meshkernel::Projection::cartesian, 0);
+    linearTriangulationInterpolation.Compute();
+    meshkernel::TriangulationInterpolation linearTiledTriangulationInterpolation(locations, linearSamples, meshkernel::Projection::cartesian, 400);
+    linearTiledTriangulationInterpolation.Compute();
+
+    // Assert: each location is interpolated in a triangle of its cell, with either diagonal
+    const auto& tiledResults = tiledTriangulationInterpolation.GetResults();
+    for (size_t i = 0; i < locations.size(); ++i)
+    {
+        const auto x = std::floor(locations[i].x);
+        const auto y = std::floor(locations[i].y);
+        const auto cornerValues = {nonLinearValue(x, y), nonLinearValue(x + 1.0, y), nonLinearValue(x, y + 1.0), nonLinearValue(x + 1.0, y + 1.0)};
+        ASSERT_GE(tiledResults[i], std::min(cornerValues) - 1e-9);
+        ASSERT_LE(tiledResults[i], std::max(cornerValues) + 1e-9);
+    }
+
+    // Assert: a linear field does not depend on the diagonals, the tiles match the untiled triangulation
+    const auto& results = linearTriangulationInterpolation.GetResults();
+    const auto& linearTiledResults = linearTiledTriangulationInterpolation.GetResults();
+    for (size_t i = 0; i < locations.size(); ++i)
+    {
+        ASSERT_NEAR(linearValue(locations[i].x, locations[i].y), results[i], 1e-9);
+        ASSERT_NEAR(results[i], linearTiledResults[i], 1e-9);
+    }
+}
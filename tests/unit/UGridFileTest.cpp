@@ -0,0 +1,135 @@
+#include <cstdio>
+#include <limits>
+#include <gtest/gtest.h>
+
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Mesh1D.hpp>
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/UGridFile.hpp>
+#include <TestUtils/MakeMeshes.hpp>
+
+TEST(UGridFile, WriteAndReadMesh2D)
+{
+    // Setup
+    const auto mesh = MakeRectangularMeshForTesting(4, 3, 10.0, meshkernel::Projection::cartesian, {5.0, 7.0});
+    const std::string filePath{"UGridFileTestMesh2D_net.nc"};
+
+    // Execute
+    {
+        meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Write);
+        file.WriteMesh2D(*mesh);
+    }
+    const meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Read);
+    const auto readMesh = file.ReadMesh2D(meshkernel::Projection::cartesian);
+    std::remove(filePath.c_str());
+
+    // Assert
+    ASSERT_EQ(mesh->GetNumNodes(), readMesh->GetNumNodes());
+    ASSERT_EQ(mesh->GetNumEdges(), readMesh->GetNumEdges());
+    ASSERT_EQ(mesh->GetNumFaces(), readMesh->GetNumFaces());
+
+    constexpr double tolerance = 1e-12;
+    for (auto n = 0; n < mesh->GetNumNodes(); ++n)
+    {
+        ASSERT_NEAR(mesh->m_nodes[n].x, readMesh->m_nodes[n].x, tolerance);
+        ASSERT_NEAR(mesh->m_nodes[n].y, readMesh->m_nodes[n].y, tolerance);
+    }
+    for (auto e = 0; e < mesh->GetNumEdges(); ++e)
+    {
+        ASSERT_EQ(mesh->m_edges[e].first, readMesh->m_edges[e].first);
+        ASSERT_EQ(mesh->m_edges[e].second, readMesh->m_edges[e].second);
+    }
+}
+
+TEST(UGridFile, WriteAndReadMesh1DAndMesh2DInTheSameFile)
+{
+    // Setup
+    const auto mesh2d = MakeRectangularMeshForTesting(3, 3, 1.0, meshkernel::Projection::cartesian);
+    const std::vector<meshkernel::Point> nodes{{0.5, 0.5}, {1.5, 0.5}, {1.5, 1.5}};
+    const std::vector<meshkernel::Edge> edges{{0, 1}, {1, 2}};
+    const meshkernel::Mesh1D mesh1d(edges, nodes, meshkernel::Projection::cartesian);
+    const std::string filePath{"UGridFileTestMesh1D_net.nc"};
+
+    // Execute
+    {
+        meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Write);
+        file.WriteMesh2D(*mesh2d);
+        file.WriteMesh1D(mesh1d);
+    }
+    const meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Read);
+    const auto readMesh1d = file.ReadMesh1D(meshkernel::Projection::cartesian);
+    const auto readMesh2d = file.ReadMesh2D(meshkernel::Projection::cartesian);
+    std::remove(filePath.c_str());
+
+    // Assert
+    ASSERT_EQ(3, readMesh1d->m_nodes.size());
+    ASSERT_EQ(2, readMesh1d->m_edges.size());
+    ASSERT_EQ(1, readMesh1d->m_edges[1].first);
+    ASSERT_EQ(2, readMesh1d->m_edges[1].second);
+    ASSERT_NEAR(1.5, readMesh1d->m_nodes[2].y, 1e-12);
+
+    ASSERT_EQ(9, readMesh2d->GetNumNodes());
+    ASSERT_EQ(4, readMesh2d->GetNumFaces());
+}
+
+TEST(UGridFile, WritingAMeshWithAnExistingDimensionOfAnotherLengthThrows)
+{
+    // Setup
+    const auto mesh = MakeRectangularMeshForTesting(3, 3, 1.0, meshkernel::Projection::cartesian);
+    const auto largerMesh = MakeRectangularMeshForTesting(4, 3, 1.0, meshkernel::Projection::cartesian);
+    const std::string filePath{"UGridFileTestDimensions_net.nc"};
+
+    // Execute and assert: the node dimension of the second mesh2d does not match the first one
+    {
+        meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Write);
+        file.WriteMesh2D(*mesh);
+        EXPECT_THROW(file.WriteMesh2D(*largerMesh), std::invalid_argument);
+    }
+    std::remove(filePath.c_str());
+}
+
+TEST(UGridFile, WritingAnEdgeNodeIndexLargerThanANetCDFIntegerThrows)
+{
+    // Setup
+    const std::vector<meshkernel::Point> nodes{{0.0, 0.0}, {1.0, 0.0}};
+    const std::vector<meshkernel::Edge> edges{{0, static_cast<size_t>(std::numeric_limits<int>::max()) + 1}};
+    const meshkernel::Mesh1D mesh1d(edges, nodes, meshkernel::Projection::cartesian);
+    const std::string filePath{"UGridFileTestIntRange_net.nc"};
+
+    // Execute and assert: the edge nodes are written as NC_INT and must not be narrowed
+    {
+        meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Write);
+        EXPECT_THROW(file.WriteMesh1D(mesh1d), std::invalid_argument);
+    }
+    std::remove(filePath.c_str());
+}
+
+TEST(UGridFile, WritingAFaceNodeIndexLargerThanANetCDFIntegerThrows)
+{
+    // Setup
+    const auto mesh = MakeRectangularMeshForTesting(3, 3, 1.0, meshkernel::Projection::cartesian);
+    mesh->m_facesNodes[0][0] = static_cast<size_t>(std::numeric_limits<int>::max()) + 1;
+    const std::string filePath{"UGridFileTestFaceIntRange_net.nc"};
+
+    // Execute and assert: the face nodes are written as NC_INT and must not be narrowed
+    {
+        meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Write);
+        EXPECT_THROW(file.WriteMesh2D(*mesh), std::invalid_argument);
+    }
+    std::remove(filePath.c_str());
+}
+
+TEST(UGridFile, ReadLegacyMesh)
+{
+    // Execute
+    const meshkernel::UGridFile file("../../../../tests/data/SmallTriangularGrid_net.nc", meshkernel::UGridFile::AccessMode::Read);
+    const auto mesh = file.ReadMesh2D(meshkernel::Projection::cartesian);
+
+    // Assert, the legacy edge nodes are 1-based
+    ASSERT_GT(mesh->GetNumNodes(), 0);
+    for (const auto& [firstNode, secondNode] : mesh->m_edges)
+    {
+        ASSERT_LT(firstNode, mesh->GetNumNodes());
+        ASSERT_LT(secondNode, mesh->GetNumNodes());
+    }
+}
@@ -1,144 +1,47 @@
 #pragma once
 
-#if defined(_WIN32)
-#ifndef NOMINMAX
-#define NOMINMAX
-#endif
-#include <Windows.h>
-#endif
-
-#include "../../../extern/netcdf/netCDF 4.6.1/include/netcdf.h"
-
 #include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/UGridFile.hpp>
 #include <TestUtils/MakeMeshes.hpp>
 #include <stdexcept>
 
 std::tuple<meshkernelapi::MeshGeometry, meshkernelapi::MeshGeometryDimensions> ReadLegacyMeshFromFileForApiTesting(std::string filePath)
 {
-    auto netcdf = LoadLibrary("netcdf.dll");
-
-    if (!netcdf)
-    {
-        throw std::invalid_argument("ReadLegacyMeshFromFile: Could not load 'netcdf.dll'.");
-    }
-
-    typedef int(__stdcall * nc_open_dll)(const char* path, int mode, int* ncidp);
-    auto nc_open = (nc_open_dll)GetProcAddress(netcdf, "nc_open");
-
-    typedef int(__stdcall * nc_inq_dimid_dll)(int ncid, const char* name, int* idp);
-    auto nc_inq_dimid = (nc_inq_dimid_dll)GetProcAddress(netcdf, "nc_inq_dimid");
-
-    typedef int(__stdcall * nc_inq_dim_dll)(int ncid, int dimid, char* name, std::size_t* lenp);
-    auto nc_inq_dim = (nc_inq_dim_dll)GetProcAddress(netcdf, "nc_inq_dim");
-
-    typedef int(__stdcall * nc_inq_varid_dll)(int ncid, const char* name, int* varidp);
-    auto nc_inq_varid = (nc_inq_varid_dll)GetProcAddress(netcdf, "nc_inq_varid");
-
-    typedef int(__stdcall * nc_get_var_double_dll)(int ncid, int varid, double* ip);
-    auto nc_get_var_double = (nc_get_var_double_dll)GetProcAddress(netcdf, "nc_get_var_double");
-
-    typedef int(__stdcall * nc_get_var_int_dll)(int ncid, int varid, int* ip);
-    auto nc_get_var_int = (nc_get_var_int_dll)GetProcAddress(netcdf, "nc_get_var_int");
-
-    int ncidp = 0;
-    int err = nc_open(filePath.c_str(), NC_NOWRITE, &ncidp);
-    if (err != 0)
-    {
-        throw std::invalid_argument("ReadLegacyMeshFromFile: Could not load netcdf file.");
-    }
-
-    std::string mesh2dNodes{"nNetNode"};
-    int dimid = 0;
-    err = nc_inq_dimid(ncidp, mesh2dNodes.c_str(), &dimid);
-    if (err != 0)
-    {
-        throw std::invalid_argument("ReadLegacyMeshFromFile: Could not find the ID of a dimension of 'nNetNode'.");
-    }
+    meshkernel::NodeCoordinates nodes;
+    std::vector<meshkernel::Edge> edges;
+    const meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Read);
+    file.ReadNodesAndEdges(2, nodes, edges);
 
     meshkernelapi::MeshGeometryDimensions meshgeometryDimensions{};
-
-    std::size_t num_nodes;
-    auto read_name = new char[NC_MAX_NAME];
-    err = nc_inq_dim(ncidp, dimid, read_name, &num_nodes);
-    if (err != 0)
-    {
-        throw std::invalid_argument("ReadLegacyMeshFromFile: Could not gind the length of dimension of 'nNetNode'.");
-    }
-    meshgeometryDimensions.numnode = static_cast<int>(num_nodes);
-
-    std::string mesh2dEdges{"nNetLink"};
-    err = nc_inq_dimid(ncidp, mesh2dEdges.c_str(), &dimid);
-    if (err != 0)
-    {
-        throw std::invalid_argument("ReadLegacyMeshFromFile: Could not find the ID of a dimension of 'nNetLink'.");
-    }
-
-    std::size_t num_edges;
-    err = nc_inq_dim(ncidp, dimid, read_name, &num_edges);
-    delete[] read_name;
-    meshgeometryDimensions.numedge = static_cast<int>(num_edges);
+    meshgeometryDimensions.numnode = static_cast<int>(nodes.size());
+    meshgeometryDimensions.numedge = static_cast<int>(edges.size());
 
     meshkernelapi::MeshGeometry meshgeometry{};
     meshgeometry.nodex = new double[meshgeometryDimensions.numnode];
     meshgeometry.nodey = new double[meshgeometryDimensions.numnode];
-
-    std::string mesh2dNodeX{"NetNode_x"};
-    int varid = 0;
-    err = nc_inq_varid(ncidp, mesh2dNodeX.c_str(), &varid);
-    err = nc_get_var_double(ncidp, varid, meshgeometry.nodex);
-
-    std::string mesh2dNodeY{"NetNode_y"};
-    err = nc_inq_varid(ncidp, mesh2dNodeY.c_str(), &varid);
-    err = nc_get_var_double(ncidp, varid, meshgeometry.nodey);
-
-    std::string mesh2dEdgeNodes{"NetLink"};
-    err = nc_inq_varid(ncidp, mesh2dEdgeNodes.c_str(), &varid);
-
-    meshgeometry.edge_nodes = new int[meshgeometryDimensions.numedge * 2];
-    err = nc_get_var_int(ncidp, varid, meshgeometry.edge_nodes);
-
-    // transform into 0 based indexing
-    for (auto i = 0; i < meshgeometryDimensions.numedge * 2; i++)
-    {
-        meshgeometry.edge_nodes[i] -= 1;
-    }
-
-    return std::make_tuple(meshgeometry, meshgeometryDimensions);
-}
-
-std::shared_ptr<meshkernel::Mesh2D> ReadLegacyMeshFromFile(std::string filePath, meshkernel::Projection projection)
-{
-
-    auto meshData = ReadLegacyMeshFromFileForApiTesting(filePath);
-    std::tuple<meshkernelapi::MeshGeometry, meshkernelapi::MeshGeometryDimensions> ReadLegacyMeshFromFileForApiTesting(std::string filePath);
-
-    const auto meshgeometry = std::get<0>(meshData);
-    const auto meshgeometryDimensions = std::get<1>(meshData);
-
-    std::vector<meshkernel::Edge> edges(meshgeometryDimensions.numedge);
-    std::vector<meshkernel::Point> nodes(meshgeometryDimensions.numnode);
-
     for (auto i = 0; i < nodes.size(); i++)
     {
-        nodes[i].x = meshgeometry.nodex[i];
-        nodes[i].y = meshgeometry.nodey[i];
+        meshgeometry.nodex[i] = nodes.GetX()[i];
+        meshgeometry.nodey[i] = nodes.GetY()[i];
     }
 
+    meshgeometry.edge_nodes = new int[meshgeometryDimensions.numedge * 2];
     auto index = 0;
     for (auto i = 0; i < edges.size(); i++)
     {
-        edges[i].first = meshgeometry.edge_nodes[index];
+        meshgeometry.edge_nodes[index] = static_cast<int>(edges[i].first);
         index++;
-        edges[i].second = meshgeometry.edge_nodes[index];
+        meshgeometry.edge_nodes[index] = static_cast<int>(edges[i].second);
         index++;
     }
 
-    auto mesh = std::make_shared<meshkernel::Mesh2D>(edges, nodes, projection);
-
-    // clean up c memory
-    DeleteRectangularMeshForApiTesting(meshgeometry);
+    return std::make_tuple(meshgeometry, meshgeometryDimensions);
+}
 
-    return mesh;
+std::shared_ptr<meshkernel::Mesh2D> ReadLegacyMeshFromFile(std::string filePath, meshkernel::Projection projection)
+{
+    const meshkernel::UGridFile file(filePath, meshkernel::UGridFile::AccessMode::Read);
+    return file.ReadMesh2D(projection);
 }
 
 std::shared_ptr<meshkernel::Mesh2D> MakeRectangularMeshForTesting(int n, int m, double delta, meshkernel::Projection projection, meshkernel::Point origin)